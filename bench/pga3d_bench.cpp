@@ -0,0 +1,247 @@
+// Throughput of every pga3d product for every type pair. The pairs come from PGA3D_TYPE_LIST
+// and an operator is benchmarked wherever the expression compiles, so new generator output
+// is picked up without touching this file. Built twice, pga3d_bench_scalar and
+// pga3d_bench_simd, run both with --csv and feed one to the other with --compare.
+//
+//   pga3d_bench [op...] [--iters N] [--repeats N] [--csv] [--compare baseline.csv]
+
+#include <pga3d.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+// Operands per batch, small enough that both inputs and outputs stay in L1
+constexpr size_t Count = 256;
+
+#if PGA3D_SIMD_AVX
+constexpr const char* Build = "avx";
+#elif PGA3D_SIMD_KERNELS
+constexpr const char* Build = "sse";
+#else
+constexpr const char* Build = "scalar";
+#endif
+
+// Keeps the results alive without adding work to the timed loop
+inline void escape(void* p) {
+#if defined(_MSC_VER)
+    static void* volatile sink;
+    sink = p;
+#else
+    asm volatile("" : : "g"(p) : "memory");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+struct type_name;
+
+#define PGA3D_BENCH_NAME(T) \
+    template <> struct type_name<T> { static constexpr const char* value = #T; };
+PGA3D_TYPE_LIST(PGA3D_BENCH_NAME)
+#undef PGA3D_BENCH_NAME
+
+// Random coefficients, horizon_t and origin_t have no storage and are left alone
+template <typename T, typename = void>
+struct coeffs {
+    static void fill(T&, std::mt19937&) {}
+};
+
+template <typename T>
+struct coeffs<T, std::void_t<decltype(std::declval<T&>().d)>> {
+    static void fill(T& v, std::mt19937& rng) {
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+        for (auto& x : v.d) x = u(rng);
+    }
+};
+
+template <>
+struct coeffs<scalar_t, void> {
+    static void fill(scalar_t& v, std::mt19937& rng) { v = std::uniform_real_distribution<float>(-1.0f, 1.0f)(rng); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Operators
+////////////////////////////////////////////////////////////////////////////////
+
+#define PGA3D_BENCH_OPS(X) \
+    X(add, a + b) X(sub, a - b) X(gp, a * b) X(op, a ^ b) X(ip, a | b) X(rp, a & b) X(sw, a >> b) \
+    X(lip, lip(a, b)) X(rip, rip(a, b)) X(prj, prj(a, b)) X(cp, cp(a, b))
+
+#define PGA3D_BENCH_OP(NAME, EXPR)                                              \
+    struct op_##NAME {                                                          \
+        static constexpr const char* name = #NAME;                              \
+        template <typename A, typename B>                                       \
+        static auto apply(const A& a, const B& b) -> decltype(EXPR) { return EXPR; } \
+    };
+PGA3D_BENCH_OPS(PGA3D_BENCH_OP)
+#undef PGA3D_BENCH_OP
+
+// Pairs without an overload (or with an ambiguous one) drop out here
+template <typename Op, typename A, typename B, typename = void>
+struct has_op : std::false_type {};
+
+template <typename Op, typename A, typename B>
+struct has_op<Op, A, B, std::void_t<decltype(Op::apply(std::declval<const A&>(), std::declval<const B&>()))>> : std::true_type {};
+
+////////////////////////////////////////////////////////////////////////////////
+// Runner
+////////////////////////////////////////////////////////////////////////////////
+
+struct options {
+    std::vector<std::string> ops;
+    size_t iterations = 1000;
+    size_t repeats = 3;
+    bool csv = false;
+    std::string compare;
+
+    bool wants(const char* op) const {
+        if (ops.empty()) return true;
+        for (const auto& o : ops)
+            if (o == op) return true;
+        return false;
+    }
+};
+
+struct result {
+    const char* op;
+    const char* a;
+    const char* b;
+    double ns;
+};
+
+template <typename Op, typename A, typename B>
+void run(const options& opt, std::vector<result>& out) {
+    if constexpr (has_op<Op, A, B>::value) {
+        using R = std::decay_t<decltype(Op::apply(std::declval<const A&>(), std::declval<const B&>()))>;
+
+        std::mt19937 rng(1234);
+        std::vector<A> as(Count);
+        std::vector<B> bs(Count);
+        std::vector<R> rs(Count);
+        for (auto& a : as) coeffs<A>::fill(a, rng);
+        for (auto& b : bs) coeffs<B>::fill(b, rng);
+
+        // Best of the repeats, the first one doubles as warm up
+        double best = 1e30;
+        for (size_t r = 0; r < opt.repeats; ++r) {
+            const auto start = clock_type::now();
+            for (size_t it = 0; it < opt.iterations; ++it) {
+                escape(as.data());
+                escape(bs.data());
+                for (size_t i = 0; i < Count; ++i) rs[i] = Op::apply(as[i], bs[i]);
+                escape(rs.data());
+            }
+            const double ns = std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+            best = std::min(best, ns / double(opt.iterations * Count));
+        }
+
+        out.push_back({ Op::name, type_name<A>::value, type_name<B>::value, best });
+    }
+}
+
+template <typename Op, typename A>
+void run_rhs(const options& opt, std::vector<result>& out) {
+#define PGA3D_BENCH_RHS(B) run<Op, A, B>(opt, out);
+    PGA3D_TYPE_LIST(PGA3D_BENCH_RHS)
+#undef PGA3D_BENCH_RHS
+}
+
+template <typename Op>
+void run_lhs(const options& opt, std::vector<result>& out) {
+#define PGA3D_BENCH_LHS(A) run_rhs<Op, A>(opt, out);
+    PGA3D_TYPE_LIST(PGA3D_BENCH_LHS)
+#undef PGA3D_BENCH_LHS
+}
+
+using key_type = std::tuple<std::string, std::string, std::string>;
+
+// op,a,b,ns_per_op,... as written by --csv
+std::map<key_type, double> load_baseline(const std::string& path) {
+    std::map<key_type, double> res;
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string op, a, b, ns;
+        if (std::getline(ss, op, ',') && std::getline(ss, a, ',') && std::getline(ss, b, ',') && std::getline(ss, ns, ','))
+            res[{ op, a, b }] = std::stod(ns);
+    }
+    return res;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    options opt;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--iters") && i + 1 < argc) opt.iterations = std::stoul(argv[++i]);
+        else if (!std::strcmp(argv[i], "--repeats") && i + 1 < argc) opt.repeats = std::stoul(argv[++i]);
+        else if (!std::strcmp(argv[i], "--csv")) opt.csv = true;
+        else if (!std::strcmp(argv[i], "--compare") && i + 1 < argc) opt.compare = argv[++i];
+        else opt.ops.push_back(argv[i]);
+    }
+    if (opt.iterations == 0) opt.iterations = 1;
+    if (opt.repeats == 0) opt.repeats = 1;
+
+    std::vector<result> results;
+#define PGA3D_BENCH_RUN(NAME, EXPR) if (opt.wants(#NAME)) run_lhs<op_##NAME>(opt, results);
+    PGA3D_BENCH_OPS(PGA3D_BENCH_RUN)
+#undef PGA3D_BENCH_RUN
+
+    if (opt.csv) {
+        std::printf("op,a,b,ns_per_op,mops_per_s,build\n");
+        for (const auto& r : results)
+            std::printf("%s,%s,%s,%.4f,%.2f,%s\n", r.op, r.a, r.b, r.ns, 1e3 / r.ns, Build);
+        return 0;
+    }
+
+    if (opt.compare.empty()) {
+        std::printf("%-4s %-14s %-14s %10s %12s   (%s)\n", "op", "a", "b", "ns/op", "Mops/s", Build);
+        for (const auto& r : results)
+            std::printf("%-4s %-14s %-14s %10.3f %12.1f\n", r.op, r.a, r.b, r.ns, 1e3 / r.ns);
+        return 0;
+    }
+
+    // Ratios against a baseline run, anything 25% slower is flagged and fails the run
+    const auto baseline = load_baseline(opt.compare);
+    if (baseline.empty()) {
+        std::fprintf(stderr, "pga3d_bench: no results in %s\n", opt.compare.c_str());
+        return 2;
+    }
+
+    size_t matched = 0, slower = 0;
+    double logSum = 0.0;
+    std::printf("%-4s %-14s %-14s %10s %10s %8s   (%s vs %s)\n", "op", "a", "b", "base ns", "ns/op", "speedup", Build, opt.compare.c_str());
+    for (const auto& r : results) {
+        const auto it = baseline.find({ r.op, r.a, r.b });
+        if (it == baseline.end()) continue;
+        const double speedup = it->second / r.ns;
+        const bool regressed = speedup < 0.8;
+        std::printf("%-4s %-14s %-14s %10.3f %10.3f %7.2fx%s\n", r.op, r.a, r.b, it->second, r.ns, speedup, regressed ? "  SLOWER" : "");
+        logSum += std::log(speedup);
+        ++matched;
+        slower += regressed;
+    }
+    if (matched)
+        std::printf("%zu pairs, geometric mean speedup %.2fx, %zu slower\n", matched, std::exp(logSum / double(matched)), slower);
+
+    return slower ? 1 : 0;
+}
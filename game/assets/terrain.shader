@@ -10,13 +10,27 @@ struct VertexOutput
     vec3 tangent;
     vec4 color;
     vec4 light;
+    vec4 ambient;
+    float occlusion;
 };
 
 #ifdef VERTEX
 layout (location = 0) in vec3 v_position;
 layout (location = 1) in vec3 v_normal;
 layout (location = 2) in vec3 v_tangent;
+layout (location = 3) in float v_occlusion;
 
+#ifdef SHADOW
+layout (std140) uniform ShadowBuffer
+{
+    mat4 LightViewProjMtx;
+};
+
+void main()
+{
+    gl_Position = LightViewProjMtx * vec4(v_position, 1.0);
+}
+#else
 layout (std140) uniform ConstantBuffer
 {
     mat4 ViewProjMtx;
@@ -26,6 +40,7 @@ layout (std140) uniform DrawBuffer
 {
     vec4 color;
     vec4 light;
+    vec4 ambient;
 };
 
 out VertexOutput io;
@@ -40,8 +55,11 @@ void main()
     io.tangent = v_tangent;
     io.color = color;
     io.light = light;
+    io.ambient = ambient;
+    io.occlusion = v_occlusion;
 }
 #endif
+#endif
 
 #ifdef PIXEL
 layout (location = 0) out vec4 p_color;
@@ -50,18 +68,99 @@ in VertexOutput io;
 
 uniform sampler2D Albedo;
 
+layout (std140) uniform CascadeBuffer
+{
+    mat4 CascadeViewProj[3];
+    vec4 CascadeSplits;
+    vec4 CameraPos;
+    vec4 ShadowParams;
+};
+
+uniform sampler2D ShadowMap0;
+uniform sampler2D ShadowMap1;
+uniform sampler2D ShadowMap2;
+
+layout (std140) uniform ClipmapBuffer
+{
+    vec4 ClipmapLevels[6];
+    vec4 ClipmapParams;
+};
+
+uniform sampler2D AlbedoCache;
+
+float SampleShadow(sampler2D shadowMap, mat4 viewProj, vec3 position)
+{
+    vec4 lightPos = viewProj * vec4(position, 1.0);
+    vec3 uvz = (lightPos.xyz / lightPos.w) * 0.5 + 0.5;
+    if (any(lessThan(uvz, vec3(0.0))) || any(greaterThan(uvz, vec3(1.0))))
+        return 1.0;
+
+    float depth = texture(shadowMap, uvz.xy).r;
+    return (uvz.z - ShadowParams.y) > depth ? 0.0 : 1.0;
+}
+
+float ComputeShadow(vec3 position)
+{
+    if (ShadowParams.x < 0.5)
+        return 1.0;
+
+    float dist = length(position - CameraPos.xyz);
+    if (dist < CascadeSplits.x)
+        return SampleShadow(ShadowMap0, CascadeViewProj[0], position);
+    if (dist < CascadeSplits.y)
+        return SampleShadow(ShadowMap1, CascadeViewProj[1], position);
+    if (dist < CascadeSplits.z)
+        return SampleShadow(ShadowMap2, CascadeViewProj[2], position);
+    return 1.0;
+}
+
+bool SampleClipmap(vec3 position, out vec4 albedo)
+{
+    albedo = vec4(0.0);
+    if (ClipmapParams.x < 0.5)
+        return false;
+
+    float size = ClipmapParams.y;
+    float numLevels = ClipmapParams.z;
+
+    // Finest resident level that contains the position, one fetch from the toroidal atlas
+    for (int i = 0; i < 6; ++i)
+    {
+        vec4 level = ClipmapLevels[i];
+        if (level.w < 0.5)
+            continue;
+
+        vec2 texel = position.xz * level.z;
+        vec2 local = texel - level.xy;
+        if (any(lessThan(local, vec2(1.0))) || any(greaterThanEqual(local, vec2(size - 1.0))))
+            continue;
+
+        vec2 wrapped = clamp(mod(texel, size), vec2(0.5), vec2(size - 0.5));
+        vec2 uv = vec2((float(i) * size + wrapped.x) / (size * numLevels), wrapped.y / size);
+        albedo = textureLod(AlbedoCache, uv, 0.0);
+        return albedo.a > 0.0;
+    }
+
+    return false;
+}
+
 void main()
 {
     vec3 N = normalize(io.normal);
     vec3 Ld = normalize(-io.light.xyz);
     float Li = io.light.w;
 
-    float diffuse = Li * max(0.0, dot(N, Ld));
+    float shadow = ComputeShadow(io.position);
+    float diffuse = Li * max(0.0, dot(N, Ld)) * shadow;
 
     vec2 uv = io.position.xz * 0.25;
-    vec4 albedo = texture(Albedo, uv);
+    vec4 albedo;
+    if (!SampleClipmap(io.position, albedo))
+        albedo = texture(Albedo, uv);
+
+    vec3 ambient = io.ambient.rgb * io.occlusion;
 
-    vec3 color = io.color.rgb * albedo.rgb * diffuse;
+    vec3 color = io.color.rgb * albedo.rgb * (diffuse + ambient);
     float alpha = io.color.a * albedo.a;
     p_color = vec4(color, alpha);
 
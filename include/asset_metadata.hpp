@@ -0,0 +1,13 @@
+#pragma once
+
+#include <engine/string.hpp>
+
+// The metadata block at the head of a JSON asset, read without parsing the rest of the file
+struct AssetMetadata
+{
+    u64 uuid{ 0 };
+    String type{};
+
+    // Zero uuid and empty type if the file is missing or has no metadata
+    static AssetMetadata Peek(StringView path);
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+
+// Single file archive of asset files for distribution. The head holds the index, entries sorted
+// by path hash and a uuid table sorted by uuid, followed by the path names and the file data,
+// each file aligned so it can be used in place once the archive is memory mapped.
+//
+//   AssetPackHeader | AssetPackEntry[numEntries] | AssetPackUuid[numUuids] | names | data...
+//
+// Paths are stored exactly as the game requests them ("[assets]/save_asset.json"), lookups are
+// a binary search over the mapped index so resolving a path or uuid never touches the disk.
+// Only data read from memory belongs in a pack: cooked images, and their JSON sources for
+// AssetMetadata::Peek. JSON without a cooked image is parsed from its file and terrain files
+// are streamed with file reads, both stay loose next to the pack.
+struct AssetPackHeader
+{
+    static constexpr u32 Magic = 0x4B415053; // "SPAK"
+    static constexpr u32 Version = 1;
+
+    u32 magic{ Magic };
+    u32 version{ Version };
+    u32 numEntries{ 0 };
+    u32 numUuids{ 0 };
+    u32 alignment{ 0 };
+    u32 reserved{ 0 };
+    u64 namesOffset{ 0 };
+    u64 namesSize{ 0 };
+};
+
+struct AssetPackEntry
+{
+    u64 pathHash{ 0 };
+    u64 offset{ 0 };    // From the start of the archive
+    u64 size{ 0 };
+    u32 nameOffset{ 0 };
+    u32 nameLength{ 0 };
+};
+
+struct AssetPackUuid
+{
+    u64 uuid{ 0 };
+    u32 entry{ 0 };
+    u32 reserved{ 0 };
+};
+
+class AssetPack
+{
+public:
+    struct Blob
+    {
+        const u8* data{ nullptr };
+        u64 size{ 0 };
+    };
+
+    AssetPack() = default;
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Fails unless the index and every entry lie inside the file
+    bool Open(StringView path);
+    void Close();
+
+    inline bool IsOpen() const { return m_base != nullptr; }
+    inline u32 GetNumEntries() const { return m_header != nullptr ? m_header->numEntries : 0; }
+
+    bool Find(StringView path, Blob& blob) const;
+    bool Find(u64 uuid, Blob& blob) const;
+
+    static u64 HashPath(StringView path);
+
+    // Packs mounted here are searched by Resolve in mount order, mount before loading starts
+    static bool Mount(StringView path);
+    static void UnmountAll();
+    static bool Resolve(StringView path, Blob& blob);
+    static bool Resolve(u64 uuid, Blob& blob);
+
+private:
+    StringView GetName(const AssetPackEntry& entry) const;
+
+    const u8* m_base{ nullptr };
+    u64 m_size{ 0 };
+    const AssetPackHeader* m_header{ nullptr };
+    const AssetPackEntry* m_entries{ nullptr };
+    const AssetPackUuid* m_uuids{ nullptr };
+    const char* m_names{ nullptr };
+
+#ifdef _WIN32
+    void* m_file{ nullptr };
+    void* m_mapping{ nullptr };
+#else
+    i32 m_file{ -1 };
+#endif
+};
+
+class AssetPackBuilder
+{
+public:
+    static constexpr u32 DefaultAlignment = 4096;
+
+    // Adds one file by its engine path, the uuid is taken from JSON metadata or a cooked header
+    bool Add(StringView path);
+
+    // Adds every file under dir that is read from the pack, .pak and terrain .bin files and
+    // JSON sources without a fresh cooked image are skipped. Returns how many were added
+    u32 AddDirectory(StringView dir);
+
+    bool Build(StringView dstPath, u32 alignment = DefaultAlignment) const;
+
+    inline u32 GetNumFiles() const { return (u32)m_files.size(); }
+
+private:
+    // Contents are streamed from disk in Build so large terrain files aren't held in memory
+    struct PackedFile
+    {
+        String path{};
+        String filepath{};
+        u64 uuid{ 0 };
+        u64 size{ 0 };
+    };
+
+    List<PackedFile> m_files{};
+};
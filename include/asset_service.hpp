@@ -0,0 +1,176 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+#include <engine/asset.hpp>
+
+#include <cooked_asset.hpp>
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <optional>
+#include <deque>
+#include <list>
+#include <unordered_map>
+
+struct AssetHandle
+{
+    static constexpr u32 Invalid = 0xFFFFFFFF;
+
+    u32 id{ Invalid };
+
+    inline bool IsValid() const { return id != Invalid; }
+    inline bool operator==(const AssetHandle& other) const { return id == other.id; }
+    inline bool operator!=(const AssetHandle& other) const { return id != other.id; }
+};
+
+// Deferred asset loading on worker threads, wraps CookedAsset::Load<T> (the cooked image when
+// it's fresh, Asset::FromFile + Load<T> otherwise).
+// Requests made during a frame are queued and dispatched together, a path is only ever loaded
+// once and paths whose metadata uuid is already loaded resolve to that asset instead of parsing
+// the same data twice. Handles resolve once the worker finishes, poll with IsReady/Get, block
+// with Wait or register a main thread callback with Then.
+//
+// Loaded assets are cached and reference counted, every Request holds a reference until it is
+// given back with Release. Unreferenced assets stay resident so repeat requests are free, once
+// the resident size goes over the budget Update evicts them least recently released first.
+// Sizes are approximated by the size of the source file. An evicted asset keeps its handle and
+// is loaded again by the next Request, Wait or Then on it.
+class AssetService
+{
+public:
+    using LoadFn = std::function<Asset(const String& path)>;
+    using ReadyFn = std::function<void(Asset&)>;
+
+    static constexpr u64 DefaultBudget = 256ull << 20;
+
+    static AssetService& Get();
+
+    AssetService() = default;
+    ~AssetService();
+
+    AssetService(const AssetService&) = delete;
+    AssetService& operator=(const AssetService&) = delete;
+
+    // Queues a load, returns the existing handle if the path was requested before.
+    // Each call adds a reference, pair it with Release
+    AssetHandle Request(StringView path, LoadFn load);
+    void Release(AssetHandle handle);
+
+    template <typename T>
+    inline AssetHandle Load(StringView path)
+    {
+        return Request(path, [](const String& file) { return CookedAsset::Load<T>(file); });
+    }
+
+    // Loads the asset at path again if it is loaded, for hot reloading. The old data stays in
+    // use until Update swaps the new one in place, pointers from Get stay valid
+    void Refresh(StringView path);
+
+    // Hands the queued requests to the workers, starting them on first use
+    void Dispatch();
+
+    // Dispatches, runs the callbacks of finished loads and evicts down to the budget,
+    // call once per frame on the main thread
+    void Update();
+
+    bool IsReady(AssetHandle handle) const;
+    bool IsFailed(AssetHandle handle) const;
+
+    // nullptr until the load finished. Without a reference the pointer is only valid until
+    // the next Update. Every handle of the same path or uuid gets the same shared Asset, copy
+    // the object into a new Asset before changing it
+    Asset* Get(AssetHandle handle);
+
+    // Blocks until the handle resolved, true if it loaded
+    bool Wait(AssetHandle handle);
+    void WaitAll();
+
+    // Called from Update once the asset is ready, immediately if it already is. The callback
+    // gets the shared Asset like Get
+    void Then(AssetHandle handle, ReadyFn callback);
+
+    // Drains the queue and joins the workers, loaded assets stay valid
+    void Shutdown();
+
+    inline void SetBudget(u64 bytes) { m_budget = bytes; }
+    inline u64 GetBudget() const { return m_budget; }
+    u64 GetResidentBytes() const;
+
+    inline u32 GetNumWorkers() const { return (u32)m_workers.size(); }
+    inline u32 GetNumRequests() const { return (u32)m_entries.size(); }
+
+private:
+    enum class State : u8
+    {
+        Pending,
+        Queued,
+        Ready,
+        Failed,
+        Evicted
+    };
+
+    struct Entry
+    {
+        String path{};
+        u64 uuid{ 0 };
+        State state{ State::Pending };
+        u32 alias{ AssetHandle::Invalid };
+        u32 refs{ 0 };
+        u64 bytes{ 0 };
+        bool cached{ false };
+        bool refreshing{ false };
+        bool queued{ false };       // In m_pending or m_queue, at most once
+
+        std::list<u32>::iterator lru{};
+        LoadFn load{};
+        std::optional<Asset> asset{};
+        std::optional<Asset> staged{};
+        List<ReadyFn> callbacks{};
+    };
+
+    void WorkerMain();
+    void Process(u32 id, Entry& entry);
+    void ProcessRefresh(Entry& entry);
+
+    // Everything below must hold m_mutex
+    void DispatchLocked();
+
+    // Follows uuid aliases
+    u32 Resolve(u32 id) const;
+
+    // Moves a loaded entry in or out of the eviction list as its references change
+    void Acquire(u32 id);
+    void Cache(u32 id);
+    void Uncache(u32 id);
+
+    // Puts an evicted entry back in the queue, a refresh still queued for it becomes the load
+    void Reload(u32 id);
+
+    void Trim();
+
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_workCv{};
+    std::condition_variable m_doneCv{};
+
+    // deque so entries keep their address while requests are added
+    std::deque<Entry> m_entries{};
+    std::unordered_map<String, u32> m_byPath{};
+    std::unordered_map<u64, u32> m_byUuid{};
+
+    List<u32> m_pending{};
+    std::deque<u32> m_queue{};
+    List<u32> m_completed{};
+    List<u32> m_refreshed{};
+    u32 m_inFlight{ 0 };
+
+    // Unreferenced loaded entries, least recently released at the front
+    std::list<u32> m_lru{};
+    u64 m_budget{ DefaultBudget };
+    u64 m_residentBytes{ 0 };
+
+    List<std::thread> m_workers{};
+    bool m_stop{ false };
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+
+#include <functional>
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
+
+// Reports files changed under the watched directories so assets can be rebuilt while running.
+// Uses inotify on Linux and scans modification times twice a second elsewhere.
+// Changes are collected while the file is still being written and only reported once it has
+// been quiet for a moment, callbacks run from Update on the main thread between frames so a
+// listener can swap its resources without the renderer seeing a half built state.
+class AssetWatcher
+{
+public:
+    using ChangeFn = std::function<void(StringView path)>;
+
+    static AssetWatcher& Get();
+
+    AssetWatcher() = default;
+    ~AssetWatcher();
+
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    // Watches every file under dir, paths passed to callbacks are relative to it in the same
+    // form ("[assets]/terrain.shader")
+    bool Watch(StringView dir);
+
+    // Called when the file at path changes, any form of the path that resolves to it works
+    u32 Subscribe(StringView path, ChangeFn callback);
+
+    // Called for every changed file
+    u32 SubscribeAll(ChangeFn callback);
+
+    void Unsubscribe(u32 id);
+
+    // Polls for changes and runs the callbacks, call once per frame on the main thread
+    void Update();
+
+    // Stops watching, subscriptions are kept
+    void Shutdown();
+
+    inline bool IsWatching() const { return !m_roots.empty(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Root
+    {
+        String path{};          // As passed to Watch
+        String filepath{};      // Canonical on disk
+    };
+
+    struct Subscription
+    {
+        u32 id{ 0 };
+        String filepath{};      // Empty for SubscribeAll
+        ChangeFn callback{};
+    };
+
+    static String Canonical(StringView filepath);
+
+    void Poll();
+    void Changed(const String& filepath);
+
+#ifdef __linux__
+    void AddWatches(const String& dir);
+
+    i32 m_inotify{ -1 };
+    std::unordered_map<i32, String> m_watches{};
+#else
+    void Scan(bool report);
+
+    std::unordered_map<String, std::filesystem::file_time_type> m_modified{};
+    Clock::time_point m_lastScan{};
+#endif
+
+    List<Root> m_roots{};
+    List<Subscription> m_subscriptions{};
+    u32 m_nextId{ 1 };
+
+    // Canonical path to the time of its last event
+    std::unordered_map<String, Clock::time_point> m_changed{};
+};
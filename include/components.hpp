@@ -0,0 +1,16 @@
+#pragma once
+
+#include <engine/math.hpp>
+
+// Plain data components stored in the EntityStore
+
+struct UnitTransform
+{
+    Vec3 position{};
+    f32 yaw{ 0 };
+};
+
+struct UnitVelocity
+{
+    Vec3 value{};
+};
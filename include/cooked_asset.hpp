@@ -0,0 +1,160 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+#include <engine/asset.hpp>
+
+#include <asset_metadata.hpp>
+
+#include <rttr/type>
+
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+// Binary images of reflected assets, written next to the JSON source as <path>.cooked.
+// The JSON stays the source of truth, a cooked file is only used while it is newer than the
+// source and was written for the same type layout, otherwise loads fall back to the JSON.
+// Images inside a mounted AssetPack are used without the freshness check.
+//
+// Trivially copyable types are stored as their raw bytes and loaded with a memcpy. Everything
+// else is stored as its reflected properties packed in declaration order with strings in a
+// trailing pool, loads copy the values back and patch the string offsets.
+struct CookedAssetHeader
+{
+    static constexpr u32 Magic = 0x4B4F4F43; // "COOK"
+    static constexpr u16 Version = 1;
+
+    enum Layout : u16
+    {
+        Raw = 0,
+        Reflected = 1
+    };
+
+    u32 magic{ Magic };
+    u16 version{ Version };
+    u16 layout{ Raw };
+    u64 uuid{ 0 };      // Of the source, restored on load
+    u64 typeHash{ 0 };  // Type name and layout, stale images are rejected
+    u32 dataSize{ 0 };
+    u32 stringsSize{ 0 };
+};
+
+class CookedAsset
+{
+public:
+    // Makes T available to Cook(path) and CookAll, cooking itself works without it
+    template <typename T>
+    static void Register();
+
+    // Loads the cooked image if it is valid, the JSON source otherwise
+    template <typename T>
+    static Asset Load(StringView path);
+
+    template <typename T>
+    static bool Cook(StringView srcPath);
+
+    // Cooks by the type in the asset's metadata, false if it isn't registered
+    static bool Cook(StringView srcPath);
+
+    // Cooks every registered .json asset under a directory, returns how many were written
+    static u32 CookAll(StringView dir);
+
+    static String GetCookedPath(StringView srcPath);
+
+    // Cooked file exists and is at least as new as its source
+    static bool IsFresh(StringView srcPath);
+
+private:
+    using CookFn = bool (*)(StringView);
+
+    static std::unordered_map<String, CookFn>& GetRegistry();
+
+    template <typename T>
+    static constexpr bool IsRaw() { return std::is_trivially_copyable_v<T>; }
+
+    static u64 TypeHash(const rttr::type& type, u32 size, bool raw);
+
+    static bool Write(StringView srcPath, const CookedAssetHeader& header, const List<u8>& data, const List<u8>& strings);
+    static bool Read(StringView srcPath, u64 typeHash, CookedAssetHeader& header, List<u8>& data, List<u8>& strings);
+
+    static bool Pack(const rttr::instance& object, const rttr::type& type, List<u8>& data, List<u8>& strings);
+    static bool Unpack(const rttr::instance& object, const rttr::type& type, const List<u8>& data, const List<u8>& strings);
+};
+
+template <typename T>
+void CookedAsset::Register()
+{
+    GetRegistry()[String(rttr::type::get<T>().get_name().to_string())] = &CookedAsset::Cook<T>;
+}
+
+template <typename T>
+Asset CookedAsset::Load(StringView path)
+{
+    const bool raw = IsRaw<T>();
+    const auto type = rttr::type::get<T>();
+
+    CookedAssetHeader header{};
+    List<u8> data{};
+    List<u8> strings{};
+    // A raw image has to be exactly one T, anything else is truncated or corrupt
+    if (Read(path, TypeHash(type, (u32)sizeof(T), raw), header, data, strings) && (!raw || data.size() == sizeof(T)))
+    {
+        // FromMemory makes a new asset, it takes the identity of the source it was cooked from
+        Asset asset = Asset::FromMemory(Object<T>::New());
+        auto& metadata = asset.GetMetadata();
+        metadata.uuid = header.uuid;
+        metadata.assetPath = String(path);
+        metadata.type = String(type.get_name().to_string());
+
+        T* value = asset.GetObject().As<T>();
+
+        if constexpr (IsRaw<T>())
+        {
+            std::memcpy((void*)value, data.data(), sizeof(T));
+            return asset;
+        }
+        else
+        {
+            if (Unpack(rttr::instance(*value), type, data, strings))
+                return asset;
+        }
+    }
+
+    Asset asset = Asset::FromFile(path);
+    asset.Load<T>();
+    return asset;
+}
+
+template <typename T>
+bool CookedAsset::Cook(StringView srcPath)
+{
+    const bool raw = IsRaw<T>();
+    const auto type = rttr::type::get<T>();
+
+    Asset asset = Asset::FromFile(srcPath);
+    asset.Load<T>();
+    const T* value = asset.GetObject().As<T>();
+    if (value == nullptr)
+        return false;
+
+    CookedAssetHeader header{};
+    header.layout = raw ? CookedAssetHeader::Raw : CookedAssetHeader::Reflected;
+    header.uuid = AssetMetadata::Peek(srcPath).uuid;
+    header.typeHash = TypeHash(type, (u32)sizeof(T), raw);
+
+    List<u8> data{};
+    List<u8> strings{};
+    if constexpr (IsRaw<T>())
+    {
+        data.resize(sizeof(T));
+        std::memcpy(data.data(), (const void*)value, sizeof(T));
+    }
+    else
+    {
+        if (!Pack(rttr::instance(*value), type, data, strings))
+            return false;
+    }
+
+    return Write(srcPath, header, data, strings);
+}
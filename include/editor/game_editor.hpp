@@ -2,6 +2,7 @@
 
 #include <game.hpp>
 #include <editor/editor.hpp>
+#include <editor/script_profiler_view.hpp>
 
 class SkyPiEditor final : public EditorApplication
 {
@@ -16,4 +17,8 @@ public:
 
 private:
 	SkyPiGame m_game;
+
+	// Drawn from the menu bar while open, Views > Script Profiler
+	EditorInspector<ScriptProfiler> m_scriptProfilerView{ ScriptProfiler::Get() };
+	bool m_showScriptProfiler{ false };
 };
\ No newline at end of file
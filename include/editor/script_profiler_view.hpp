@@ -0,0 +1,19 @@
+#pragma once
+
+#include <script_profiler.hpp>
+#include <editor/editor.hpp>
+
+template <>
+class EditorInspector<ScriptProfiler> final : public EditorWindow
+{
+public:
+	EditorInspector(ScriptProfiler& profiler);
+	void OnGui(EditorApplication& app) override;
+
+private:
+	ScriptProfiler& m_profiler;
+	i32 m_maxRows{ 20 };
+	bool m_paused{ false };
+	List<ScriptProfiler::Stat> m_stats{};
+	u32 m_samples{ 0 };
+};
@@ -14,6 +14,7 @@ public:
 
 private:
 	bool m_wireframe{ false };
+	bool m_bakeOcclusion{ true };
 	Terrain& m_terrain;
 
 	CString<512> m_heightmapSrcPath{};
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+#include <engine/guard.hpp>
+
+#include <cstring>
+#include <cstddef>
+#include <typeinfo>
+#include <type_traits>
+#include <unordered_map>
+
+struct Entity
+{
+    static constexpr u32 Invalid = 0xFFFFFFFF;
+
+    u32 index{ Invalid };
+    u32 generation{ 0 };
+
+    inline bool IsValid() const { return index != Invalid; }
+    inline bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    inline bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+// Archetype based component storage. Entities with the same set of components share an
+// archetype, which keeps one contiguous array per component plus the entity of every row,
+// so a query walks plain arrays instead of chasing one heap object per entity.
+// Components are plain data (trivially copyable), moving an entity between archetypes or
+// swapping a removed row into place is a memcpy per column.
+//
+// Adding, removing, creating or destroying entities moves rows, don't do it from inside Each
+// or EachChunk. Component pointers are only valid until the next structural change.
+class EntityStore
+{
+public:
+    static constexpr u32 MaxComponents = 64;
+
+    EntityStore();
+
+    EntityStore(const EntityStore&) = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    Entity Create();
+
+    template <typename... T>
+    Entity Create(const T&... components);
+
+    void Destroy(Entity entity);
+    bool IsAlive(Entity entity) const;
+
+    template <typename T>
+    void Add(Entity entity, const T& component);
+
+    template <typename T>
+    void Remove(Entity entity);
+
+    template <typename T>
+    bool Has(Entity entity) const;
+
+    // nullptr if the entity is dead or doesn't have T
+    template <typename T>
+    T* Get(Entity entity);
+
+    // fn(T&...) for every entity that has all of T
+    template <typename... T, typename Fn>
+    void Each(Fn&& fn);
+
+    // fn(count, const Entity*, T*...) once per matching archetype, for bulk and vectorized work
+    template <typename... T, typename Fn>
+    void EachChunk(Fn&& fn);
+
+    template <typename... T>
+    u32 Count() const;
+
+    void Clear();
+
+    inline u32 GetNumEntities() const { return m_numAlive; }
+    inline u32 GetNumArchetypes() const { return (u32)m_archetypes.size(); }
+
+    template <typename T>
+    static u32 GetComponentId();
+
+private:
+    using Mask = u64;
+
+    struct ComponentType
+    {
+        u32 size{ 0 };
+        const char* name{ nullptr };
+    };
+
+    struct Archetype
+    {
+        Mask mask{ 0 };
+        u32 column[MaxComponents]{};    // Column of each component id, only valid for bits in mask
+        List<u32> components{};         // Ids, one per column
+        List<List<u8>> columns{};
+        List<Entity> entities{};
+
+        inline u32 GetCount() const { return (u32)entities.size(); }
+    };
+
+    struct Location
+    {
+        u32 archetype{ 0 };
+        u32 row{ 0 };
+        u32 generation{ 0 };
+        bool alive{ false };
+    };
+
+    static List<ComponentType>& GetComponentTypes();
+    static u32 RegisterComponent(u32 size, const char* name);
+
+    template <typename... T>
+    static Mask GetMask();
+
+    u32 GetArchetype(Mask mask);
+    Entity Allocate(u32 archetype);
+
+    // Appends a row, component data is left uninitialized
+    u32 AddRow(Archetype& archetype, Entity entity);
+    void RemoveRow(u32 archetype, u32 row);
+
+    // Moves the entity to the archetype with mask, components in both are copied over
+    void Move(Entity entity, Mask mask);
+
+    inline void* GetComponent(Archetype& archetype, u32 id, u32 row)
+    {
+        return archetype.columns[archetype.column[id]].data() + (size_t)row * GetComponentTypes()[id].size;
+    }
+
+    List<Archetype> m_archetypes{};
+    std::unordered_map<Mask, u32> m_byMask{};
+
+    List<Location> m_locations{};
+    List<u32> m_free{};
+    u32 m_numAlive{ 0 };
+};
+
+template <typename T>
+u32 EntityStore::GetComponentId()
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Components must be plain data");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned components aren't supported");
+
+    static const u32 s_id = RegisterComponent((u32)sizeof(T), typeid(T).name());
+    return s_id;
+}
+
+template <typename... T>
+EntityStore::Mask EntityStore::GetMask()
+{
+    return (Mask{ 0 } | ... | (Mask{ 1 } << GetComponentId<T>()));
+}
+
+template <typename... T>
+Entity EntityStore::Create(const T&... components)
+{
+    const Entity entity = Allocate(GetArchetype(GetMask<T...>()));
+    const auto& location = m_locations[entity.index];
+    auto& archetype = m_archetypes[location.archetype];
+
+    (std::memcpy(GetComponent(archetype, GetComponentId<T>(), location.row), &components, sizeof(T)), ...);
+    return entity;
+}
+
+template <typename T>
+void EntityStore::Add(Entity entity, const T& component)
+{
+    if (!IsAlive(entity))
+        return;
+
+    const u32 id = GetComponentId<T>();
+    const Mask mask = m_archetypes[m_locations[entity.index].archetype].mask;
+    if ((mask & (Mask{ 1 } << id)) == 0)
+        Move(entity, mask | (Mask{ 1 } << id));
+
+    const auto& location = m_locations[entity.index];
+    std::memcpy(GetComponent(m_archetypes[location.archetype], id, location.row), &component, sizeof(T));
+}
+
+template <typename T>
+void EntityStore::Remove(Entity entity)
+{
+    if (!IsAlive(entity))
+        return;
+
+    const Mask bit = Mask{ 1 } << GetComponentId<T>();
+    const Mask mask = m_archetypes[m_locations[entity.index].archetype].mask;
+    if (mask & bit)
+        Move(entity, mask & ~bit);
+}
+
+template <typename T>
+bool EntityStore::Has(Entity entity) const
+{
+    if (!IsAlive(entity))
+        return false;
+
+    return (m_archetypes[m_locations[entity.index].archetype].mask & (Mask{ 1 } << GetComponentId<T>())) != 0;
+}
+
+template <typename T>
+T* EntityStore::Get(Entity entity)
+{
+    if (!Has<T>(entity))
+        return nullptr;
+
+    const auto& location = m_locations[entity.index];
+    return (T*)GetComponent(m_archetypes[location.archetype], GetComponentId<T>(), location.row);
+}
+
+template <typename... T, typename Fn>
+void EntityStore::Each(Fn&& fn)
+{
+    EachChunk<T...>([&](u32 count, const Entity*, T*... components)
+    {
+        for (u32 i = 0; i < count; ++i)
+            fn(components[i]...);
+    });
+}
+
+template <typename... T, typename Fn>
+void EntityStore::EachChunk(Fn&& fn)
+{
+    const Mask query = GetMask<T...>();
+    for (auto& archetype : m_archetypes)
+    {
+        if ((archetype.mask & query) != query || archetype.entities.empty())
+            continue;
+
+        fn(archetype.GetCount(), archetype.entities.data(), (T*)archetype.columns[archetype.column[GetComponentId<T>()]].data()...);
+    }
+}
+
+template <typename... T>
+u32 EntityStore::Count() const
+{
+    const Mask query = GetMask<T...>();
+
+    u32 count = 0;
+    for (const auto& archetype : m_archetypes)
+    {
+        if ((archetype.mask & query) == query)
+            count += archetype.GetCount();
+    }
+    return count;
+}
@@ -2,6 +2,11 @@
 
 #include <engine/application.hpp>
 
+#include <entity_store.hpp>
+#include <job_system.hpp>
+
+#include <chrono>
+
 class SkyPiGame final : public Application
 {
 public:
@@ -12,7 +17,24 @@ public:
     void Update() override;
     void Render() override;
     void Shutdown() override;
+
+    inline EntityStore& GetEntities() { return m_entities; }
+
+    // Jobs run every Update after the main thread work, systems add their phases here
+    inline JobGraph& GetFrameGraph() { return m_frameGraph; }
     
 private:
     friend class SkyPiEditor;
+
+    // Debug, Units > Spawn Grid in the editor adds UnitGridSize^2 units around the origin
+    void SpawnUnits();
+    void UpdateUnits(f32 dt);
+
+    EntityStore m_entities{};
+    JobGraph m_frameGraph{};
+    std::chrono::steady_clock::time_point m_lastUpdate{};
+    f32 m_dt{ 0 };
+
+    // Shipped builds read from the pack, the editor works on the loose source files
+    bool m_mountPacks{ true };
 };
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <condition_variable>
+
+// Number of jobs that haven't finished yet, Run adds one and the job removes it when it returns
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    inline bool IsDone() const { return m_count.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<u32> m_count{ 0 };
+};
+
+// Work stealing job scheduler for frame work. Every worker has its own queue, jobs a worker
+// runs go to the back of its queue and it takes them from the back again (the most recent work
+// is the most likely to be in its cache), idle workers steal from the front of the others.
+// Threads that aren't workers (the main thread, asset loaders) share one extra queue.
+//
+// Fork/join: Run jobs against a JobCounter, then Wait on it. A waiting thread runs queued jobs
+// until the counter reaches zero instead of blocking, so jobs can fork and wait on jobs of
+// their own. Jobs are for computation, anything that blocks on IO belongs on the AssetService.
+//
+// Until Initialize, and with no workers, jobs run on the thread that waits for them.
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    static JobSystem& Get();
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Starts numWorkers threads, one less than the number of cores when negative. With 0 every
+    // job runs on the thread that waits for it
+    void Initialize(i32 numWorkers = -1);
+
+    // Finishes the queued jobs and joins the workers
+    void Shutdown();
+
+    inline u32 GetNumWorkers() const { return (u32)m_workers.size(); }
+
+    // Workers plus the thread that waits
+    inline u32 GetNumThreads() const { return GetNumWorkers() + 1; }
+
+    void Run(Job job, JobCounter& counter);
+
+    // Runs other jobs until every job of counter is done
+    void Wait(JobCounter& counter);
+
+    // fn(from, to) over [begin, end) split into ranges of about grain items, returns once all are
+    // done. A grain of 0 splits the range into a few ranges per thread
+    template <typename Fn>
+    void ParallelRanges(i32 begin, i32 end, i32 grain, Fn&& fn);
+
+    // fn(i) for every i in [begin, end)
+    template <typename Fn>
+    void ParallelFor(i32 begin, i32 end, i32 grain, Fn&& fn);
+
+private:
+    static constexpr u32 External = 0;
+
+    struct Task
+    {
+        Job job{};
+        JobCounter* counter{ nullptr };
+    };
+
+    struct Queue
+    {
+        std::mutex mutex{};
+        std::deque<Task> tasks{};
+    };
+
+    // Own queue first, then steals, false if every queue was empty
+    bool RunOne(u32 queue);
+    bool Pop(u32 queue, Task& task);
+    bool Steal(u32 thief, Task& task);
+    void Execute(Task& task);
+
+    void WorkerMain(u32 queue);
+
+    // Queue 0 is shared by every thread that isn't a worker, worker i owns queue i + 1.
+    // deque so the queues keep their address
+    std::deque<Queue> m_queues{ 1 };
+    List<std::thread> m_workers{};
+
+    // Queued tasks, workers sleep while there are none
+    std::atomic<u32> m_numQueued{ 0 };
+    std::atomic<u32> m_numSleeping{ 0 };
+    std::mutex m_sleepMutex{};
+    std::condition_variable m_sleepCv{};
+    std::atomic<bool> m_stop{ false };
+};
+
+// Per frame jobs and the order between them. Nodes are added once with the nodes they depend
+// on, Run starts every node whose dependencies are done and returns when all of them are, so
+// independent phases run side by side. A node can only depend on nodes added before it which
+// keeps the graph free of cycles.
+class JobGraph
+{
+public:
+    using Node = u32;
+
+    JobGraph() = default;
+
+    JobGraph(const JobGraph&) = delete;
+    JobGraph& operator=(const JobGraph&) = delete;
+
+    Node Add(StringView name, JobSystem::Job job, std::initializer_list<Node> dependencies = {});
+    void Clear();
+
+    void Run();
+
+    inline u32 GetNumNodes() const { return (u32)m_nodes.size(); }
+    inline const String& GetName(Node node) const { return m_nodes[node].name; }
+
+    // Time the node's job took in the last Run
+    inline f32 GetMs(Node node) const { return m_nodes[node].ms; }
+
+private:
+    struct NodeData
+    {
+        String name{};
+        JobSystem::Job job{};
+        List<Node> dependents{};
+        u32 numDependencies{ 0 };
+        std::atomic<u32> remaining{ 0 };
+        f32 ms{ 0 };
+    };
+
+    void Start(Node node, JobCounter& counter);
+
+    // deque so the atomics keep their address as nodes are added
+    std::deque<NodeData> m_nodes{};
+};
+
+template <typename Fn>
+void JobSystem::ParallelRanges(i32 begin, i32 end, i32 grain, Fn&& fn)
+{
+    if (end <= begin)
+        return;
+
+    const i32 count = end - begin;
+    if (grain <= 0)
+    {
+        const i32 numRanges = (i32)GetNumThreads() * 4;
+        grain = (count + numRanges - 1) / numRanges;
+    }
+
+    if (m_workers.empty() || count <= grain)
+    {
+        fn(begin, end);
+        return;
+    }
+
+    JobCounter counter;
+    for (i32 from = begin; from < end; from += grain)
+    {
+        const i32 to = end - from > grain ? from + grain : end;
+        Run([&fn, from, to]() { fn(from, to); }, counter);
+    }
+    Wait(counter);
+}
+
+template <typename Fn>
+void JobSystem::ParallelFor(i32 begin, i32 end, i32 grain, Fn&& fn)
+{
+    ParallelRanges(begin, end, grain, [&fn](i32 from, i32 to)
+    {
+        for (i32 i = from; i < to; ++i)
+            fn(i);
+    });
+}
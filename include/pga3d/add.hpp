@@ -0,0 +1,1715 @@
+// Written by GAmphetamine.js
+// Addition
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+#include "add_core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between scalar and quadvector  
+// a
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const scalar_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = a;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const vector_t& a, const trivector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const vector_t& a, const horizon_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1 + a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const vector_t& a, const origin_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const vector_t& a, const evector_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const vector_t& a, const dpoint_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between vector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const vector_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3] + b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between bivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const bivector_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = a.d[3];
+    res.d[5] = a.d[4];
+    res.d[6] = a.d[5];
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const trivector_t& a, const vector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const trivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3] + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const trivector_t& a, const horizon_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const trivector_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1 + a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const trivector_t& a, const point_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const trivector_t& a, const direction_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const trivector_t& a, const evector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const trivector_t& a, const dpoint_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between trivector and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const trivector_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = a.d[0] + b.d[4];
+    res.d[5] = a.d[1] + b.d[5];
+    res.d[6] = a.d[2] + b.d[6];
+    res.d[7] = a.d[3] + b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and scalar  
+// a0 e₀₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const scalar_t& b) {
+    even_t res;
+    res.d[0] = b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and bivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const bivector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = b.d[0];
+    res.d[2] = b.d[1];
+    res.d[3] = b.d[2];
+    res.d[4] = b.d[3];
+    res.d[5] = b.d[4];
+    res.d[6] = b.d[5];
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and quadvector  
+// a0 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator+(const quadvector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and ebivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const ebivector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = b.d[0];
+    res.d[2] = b.d[1];
+    res.d[3] = b.d[2];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and ibivector  
+// a0 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const ibivector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and rotation  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const rotation_t& b) {
+    even_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and translation  
+// a0 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = 1.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between quadvector and even  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const quadvector_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = a.d[0] + b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and vector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const horizon_t& a, const vector_t& b) {
+    vector_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1 + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and trivector  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const horizon_t& a, const trivector_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and horizon  
+// 1 e₀
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const horizon_t& a, const horizon_t& b) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and origin  
+// 1 e₀
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const horizon_t& a, const origin_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and point  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const horizon_t& a, const point_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and direction  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const horizon_t& a, const direction_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and evector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator+(const horizon_t& a, const evector_t& b) {
+    dpoint_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and dpoint  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const horizon_t& a, const dpoint_t& b) {
+    vector_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between horizon and odd  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const horizon_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1 + b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and vector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const origin_t& a, const vector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and trivector  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const origin_t& a, const trivector_t& b) {
+    trivector_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1 + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and horizon  
+// 1 e₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const origin_t& a, const horizon_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and origin  
+// 1 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const origin_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and point  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const origin_t& a, const point_t& b) {
+    trivector_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and direction  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator+(const origin_t& a, const direction_t& b) {
+    point_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and evector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const origin_t& a, const evector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and dpoint  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const origin_t& a, const dpoint_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between origin and odd  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const origin_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = 1 + b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const point_t& a, const trivector_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const point_t& a, const horizon_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const point_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const point_t& a, const evector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const point_t& a, const dpoint_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between point and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const point_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = a.d[0] + b.d[4];
+    res.d[5] = a.d[1] + b.d[5];
+    res.d[6] = a.d[2] + b.d[6];
+    res.d[7] = 1 + b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator+(const direction_t& a, const trivector_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const direction_t& a, const horizon_t& b) {
+    odd_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator+(const direction_t& a, const origin_t& b) {
+    point_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const direction_t& a, const evector_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const direction_t& a, const dpoint_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between direction and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const direction_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = b.d[0];
+    res.d[1] = b.d[1];
+    res.d[2] = b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = a.d[0] + b.d[4];
+    res.d[5] = a.d[1] + b.d[5];
+    res.d[6] = a.d[2] + b.d[6];
+    res.d[7] = b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between ebivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const ebivector_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between ibivector and quadvector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const ibivector_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const evector_t& a, const vector_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const evector_t& a, const trivector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator+(const evector_t& a, const horizon_t& b) {
+    dpoint_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const evector_t& a, const origin_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and point  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const evector_t& a, const point_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const evector_t& a, const direction_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 0.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator+(const evector_t& a, const evector_t& b) {
+    evector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator+(const evector_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between evector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const evector_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const dpoint_t& a, const vector_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const dpoint_t& a, const trivector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const dpoint_t& a, const horizon_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const dpoint_t& a, const origin_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const dpoint_t& a, const point_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const dpoint_t& a, const direction_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1.0;
+    res.d[4] = b.d[0];
+    res.d[5] = b.d[1];
+    res.d[6] = b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator+(const dpoint_t& a, const evector_t& b) {
+    dpoint_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator+(const dpoint_t& a, const dpoint_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 2.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between dpoint and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const dpoint_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + b.d[3];
+    res.d[4] = b.d[4];
+    res.d[5] = b.d[5];
+    res.d[6] = b.d[6];
+    res.d[7] = b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between rotation and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const rotation_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between translation and quadvector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const translation_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = 1.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between even and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator+(const even_t& a, const quadvector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7] + b.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const vector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3] + b.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const trivector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4] + b.d[0];
+    res.d[5] = a.d[5] + b.d[1];
+    res.d[6] = a.d[6] + b.d[2];
+    res.d[7] = a.d[7] + b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const horizon_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = 1 + a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const origin_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = 1 + a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const point_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4] + b.d[0];
+    res.d[5] = a.d[5] + b.d[1];
+    res.d[6] = a.d[6] + b.d[2];
+    res.d[7] = 1 + a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const direction_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4] + b.d[0];
+    res.d[5] = a.d[5] + b.d[1];
+    res.d[6] = a.d[6] + b.d[2];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const evector_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator+(const odd_t& a, const dpoint_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = 1 + a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// add between odd and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+#if !PGA3D_SIMD_KERNELS
+CONSTEXPR inline odd_t operator+(const odd_t& a, const odd_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0] + b.d[0];
+    res.d[1] = a.d[1] + b.d[1];
+    res.d[2] = a.d[2] + b.d[2];
+    res.d[3] = a.d[3] + b.d[3];
+    res.d[4] = a.d[4] + b.d[4];
+    res.d[5] = a.d[5] + b.d[5];
+    res.d[6] = a.d[6] + b.d[6];
+    res.d[7] = a.d[7] + b.d[7];
+    return res;
+}
+#endif
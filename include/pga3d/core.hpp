@@ -0,0 +1,14 @@
+// Points, directions and motors subset of pga3d: add, sub, gp, reverse, sw and inverse between
+// scalar, vector, bivector, ebivector, ibivector, point, direction, rotation, translation and even.
+// Include this instead of pga3d.hpp when that is all a translation unit needs, it parses in a
+// fraction of the time.
+
+#pragma once
+
+#include "types.hpp"
+#include "add_core.hpp"
+#include "sub_core.hpp"
+#include "gp_core.hpp"
+#include "reverse_core.hpp"
+#include "sw_core.hpp"
+#include "inverse_core.hpp"
@@ -0,0 +1,97 @@
+// Plane vs box culling on pga3d planes. A frustum is a set of inward facing unit planes
+// a e1 + b e2 + c e3 + d e0, so plane ^ point is the signed distance of a point and moving
+// the frustum with a camera motor is a sandwich of each plane rather than a re-extraction.
+// Boxes are batched as centers and half extents in the same layout as points_soa.
+
+#pragma once
+
+#include "soa.hpp"
+#include "op.hpp"
+#include <cstdint>
+
+// BOX SOA : {e032[], e013[], e021[]} centers, {x[], y[], z[]} half extents
+
+struct box_soa {
+    static constexpr size_t Lanes = 8;
+
+    // Padded to a multiple of Lanes with empty boxes at the origin
+    std::vector<float> c[3];
+    std::vector<float> e[3];
+
+    size_t size() const { return count; }
+    size_t padded_size() const { return c[0].size(); }
+
+    void resize(size_t n) {
+        count = n;
+        const size_t padded = (n + Lanes - 1) / Lanes * Lanes;
+        for (size_t k = 0; k < 3; ++k) {
+            c[k].resize(padded, 0.0f);
+            e[k].resize(padded, 0.0f);
+        }
+    }
+    void clear() { resize(0); }
+
+    void set(size_t i, const point_t& center, const float extent[3]) {
+        for (size_t k = 0; k < 3; ++k) {
+            c[k][i] = center.d[k];
+            e[k][i] = extent[k];
+        }
+    }
+    point_t center(size_t i) const { return point_t({ c[0][i], c[1][i], c[2][i] }); }
+
+private:
+    size_t count = 0;
+};
+
+// Moves planes by a unit motor, in and out may alias
+inline void sandwich(const even_t& m, const vector_t* in, vector_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) out[i] = m >> in[i];
+}
+
+// Signed distance of the box corner furthest along the plane normal, the box is outside when
+// this is negative for any plane. Conservative like the usual test, boxes straddling two
+// planes outside a frustum corner are kept
+inline float box_distance(const vector_t& plane, const point_t& center, const float extent[3]) {
+    return (plane ^ center).d[0] + std::fabs(plane.d[0]) * extent[0] + std::fabs(plane.d[1]) * extent[1] + std::fabs(plane.d[2]) * extent[2];
+}
+
+// Culls boxes [first, last) only, first and last must be multiples of box_soa::Lanes (or last
+// the box count) so separate ranges can be culled on separate threads
+inline size_t cull(const vector_t* planes, size_t numPlanes, const box_soa& boxes, size_t first, size_t last, uint8_t* visible) {
+    using namespace pga3d_detail;
+    const size_t count = last < boxes.size() ? last : boxes.size();
+    const size_t padded = (count + box_soa::Lanes - 1) / box_soa::Lanes * box_soa::Lanes;
+    const float* c[3] = { boxes.c[0].data(), boxes.c[1].data(), boxes.c[2].data() };
+    const float* e[3] = { boxes.e[0].data(), boxes.e[1].data(), boxes.e[2].data() };
+
+    size_t numVisible = 0;
+    float dist[LaneStep];
+    for (size_t i = first; i < padded; i += LaneStep) {
+        lane_t x[3], r[3];
+        for (size_t k = 0; k < 3; ++k) {
+            x[k] = lane_load(c[k] + i);
+            r[k] = lane_load(e[k] + i);
+        }
+
+        lane_t d = lane_set1(1.0f);
+        for (size_t p = 0; p < numPlanes; ++p) {
+            const float* n = planes[p].d;
+            const lane_t s = lane_set1(n[0]) * x[0] + lane_set1(n[1]) * x[1] + lane_set1(n[2]) * x[2] + lane_set1(n[3])
+                + lane_set1(std::fabs(n[0])) * r[0] + lane_set1(std::fabs(n[1])) * r[1] + lane_set1(std::fabs(n[2])) * r[2];
+            d = lane_min(d, s);
+        }
+        lane_store(dist, d);
+
+        for (size_t j = 0; j < LaneStep && i + j < count; ++j) {
+            visible[i + j] = dist[j] >= 0.0f ? 1 : 0;
+            numVisible += visible[i + j];
+        }
+    }
+    return numVisible;
+}
+
+// visible[i] is 1 when box i is inside or intersects every plane, 0 otherwise.
+// Returns the number of visible boxes
+inline size_t cull(const vector_t* planes, size_t numPlanes, const box_soa& boxes, uint8_t* visible) {
+    return cull(planes, numPlanes, boxes, 0, boxes.size(), visible);
+}
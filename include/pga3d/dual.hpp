@@ -0,0 +1,268 @@
+// Written by GAmphetamine.js
+// Dual
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of vector
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator!(const vector_t& a) {
+    trivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of bivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator!(const bivector_t& a) {
+    bivector_t res;
+    res.d[0] = a.d[3];
+    res.d[1] = a.d[4];
+    res.d[2] = a.d[5];
+    res.d[3] = a.d[0];
+    res.d[4] = a.d[1];
+    res.d[5] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of trivector
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator!(const trivector_t& a) {
+    vector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of quadvector
+// a0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator!(const quadvector_t& a) {
+
+    return a.d[0];
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of horizon
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator!(const horizon_t& a) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of origin
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator!(const origin_t& a) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of point
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator!(const point_t& a) {
+    vector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of direction
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator!(const direction_t& a) {
+    evector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of ebivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator!(const ebivector_t& a) {
+    ibivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of ibivector
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator!(const ibivector_t& a) {
+    ebivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of evector
+// a0 e₁ + a1 e₂ + a2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator!(const evector_t& a) {
+    direction_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of dpoint
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator!(const dpoint_t& a) {
+    point_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of rotation
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator!(const rotation_t& a) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[1];
+    res.d[5] = a.d[2];
+    res.d[6] = a.d[3];
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of translation
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator!(const translation_t& a) {
+    even_t res;
+    res.d[0] = 0.0;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of even
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator!(const even_t& a) {
+    even_t res;
+    res.d[0] = a.d[7];
+    res.d[1] = a.d[4];
+    res.d[2] = a.d[5];
+    res.d[3] = a.d[6];
+    res.d[4] = a.d[1];
+    res.d[5] = a.d[2];
+    res.d[6] = a.d[3];
+    res.d[7] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// dual of odd
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator!(const odd_t& a) {
+    odd_t res;
+    res.d[0] = -a.d[4];
+    res.d[1] = -a.d[5];
+    res.d[2] = -a.d[6];
+    res.d[3] = -a.d[7];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = a.d[3];
+    return res;
+}
@@ -0,0 +1,243 @@
+// Lazy sparse expressions over the pga3d types. lazy(x) wraps a value, products, sums, reverses
+// and grade selections build a tree whose possible blades are known at compile time, and eval<T>
+// walks it once per blade T stores. Intermediate multivectors are never materialized, so blades
+// the result does not keep are never computed, eval<point_t>(lazy(m) * lazy(p) * ~lazy(m)) only
+// evaluates the three point coefficients of the product.
+//
+// Blades are indexed by generator bitmask (e0 = 1, e1 = 2, e2 = 4, e3 = 8) in ascending order,
+// the layout table maps the generated types (e31, e032, e021 are reordered) onto that basis.
+// Leaves hold references, evaluate the expression before its operands go out of scope.
+
+#pragma once
+
+#include "types.hpp"
+#include <cstdint>
+#include <utility>
+
+#if __cplusplus < 201703L
+#error "pga3d/expr.hpp needs C++17"
+#endif
+
+namespace pga3d_expr {
+
+using mask_t = uint32_t;
+
+// Sign of the canonical blade product a * b, reordering swaps, e0 squares to 0 and e1..e3 to 1
+constexpr float blade_sign(int a, int b) {
+    int swaps = 0;
+    for (int j = 0; j < 4; ++j)
+        if (b & (1 << j))
+            for (int k = j + 1; k < 4; ++k)
+                if (a & (1 << k)) ++swaps;
+    return (swaps & 1) ? -1.0f : 1.0f;
+}
+
+constexpr bool blade_null(int a, int b) { return (a & b & 1) != 0; }
+
+constexpr int blade_grade(int a) { return (a & 1) + ((a >> 1) & 1) + ((a >> 2) & 1) + ((a >> 3) & 1); }
+
+constexpr bool has(mask_t mask, int blade) { return (mask >> blade) & 1; }
+
+constexpr mask_t gp_mask(mask_t a, mask_t b) {
+    mask_t res = 0;
+    for (int i = 0; i < 16; ++i)
+        for (int j = 0; j < 16; ++j)
+            if (has(a, i) && has(b, j) && !blade_null(i, j)) res |= mask_t(1) << (i ^ j);
+    return res;
+}
+
+constexpr mask_t grade_mask(int grade) {
+    mask_t res = 0;
+    for (int i = 0; i < 16; ++i)
+        if (blade_grade(i) == grade) res |= mask_t(1) << i;
+    return res;
+}
+
+// Stored coefficient i of a generated type is sign * the canonical blade
+struct blade_ref {
+    int blade;
+    float sign;
+};
+
+template <typename T>
+struct layout;
+
+#define PGA3D_EXPR_LAYOUT(T, IMPLICIT, ...)                                                     \
+    template <>                                                                                 \
+    struct layout<T> {                                                                          \
+        static constexpr int implicit = IMPLICIT;                                               \
+        static constexpr blade_ref blades[] = { __VA_ARGS__ };                                  \
+        static constexpr int size = sizeof(blades) / sizeof(blade_ref);                         \
+        static constexpr int find(int blade) {                                                  \
+            for (int i = 0; i < size; ++i) if (blades[i].blade == blade) return i;              \
+            return -1;                                                                          \
+        }                                                                                       \
+        static constexpr mask_t mask() {                                                        \
+            mask_t res = implicit >= 0 ? mask_t(1) << implicit : 0;                             \
+            for (int i = 0; i < size; ++i) res |= mask_t(1) << blades[i].blade;                 \
+            return res;                                                                         \
+        }                                                                                       \
+    };
+
+PGA3D_EXPR_LAYOUT(vector_t, -1, { 2, 1 }, { 4, 1 }, { 8, 1 }, { 1, 1 })
+PGA3D_EXPR_LAYOUT(bivector_t, -1, { 12, 1 }, { 10, -1 }, { 6, 1 }, { 3, 1 }, { 5, 1 }, { 9, 1 })
+PGA3D_EXPR_LAYOUT(trivector_t, -1, { 13, -1 }, { 11, 1 }, { 7, -1 }, { 14, 1 })
+PGA3D_EXPR_LAYOUT(quadvector_t, -1, { 15, 1 })
+PGA3D_EXPR_LAYOUT(point_t, 14, { 13, -1 }, { 11, 1 }, { 7, -1 })
+PGA3D_EXPR_LAYOUT(direction_t, -1, { 13, -1 }, { 11, 1 }, { 7, -1 })
+PGA3D_EXPR_LAYOUT(ebivector_t, -1, { 12, 1 }, { 10, -1 }, { 6, 1 })
+PGA3D_EXPR_LAYOUT(ibivector_t, -1, { 3, 1 }, { 5, 1 }, { 9, 1 })
+PGA3D_EXPR_LAYOUT(evector_t, -1, { 2, 1 }, { 4, 1 }, { 8, 1 })
+PGA3D_EXPR_LAYOUT(dpoint_t, 1, { 2, 1 }, { 4, 1 }, { 8, 1 })
+PGA3D_EXPR_LAYOUT(rotation_t, -1, { 0, 1 }, { 12, 1 }, { 10, -1 }, { 6, 1 })
+PGA3D_EXPR_LAYOUT(translation_t, 0, { 3, 1 }, { 5, 1 }, { 9, 1 })
+PGA3D_EXPR_LAYOUT(even_t, -1, { 0, 1 }, { 12, 1 }, { 10, -1 }, { 6, 1 }, { 3, 1 }, { 5, 1 }, { 9, 1 }, { 15, 1 })
+PGA3D_EXPR_LAYOUT(odd_t, -1, { 2, 1 }, { 4, 1 }, { 8, 1 }, { 1, 1 }, { 13, -1 }, { 11, 1 }, { 7, -1 }, { 14, 1 })
+
+#undef PGA3D_EXPR_LAYOUT
+
+// CRTP base, every node has a compile time mask and get<Blade>() for one canonical coefficient
+template <typename E>
+struct node {
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+template <typename T>
+struct leaf : node<leaf<T>> {
+    static constexpr mask_t mask = layout<T>::mask();
+    const T& v;
+    explicit leaf(const T& v) : v(v) {}
+
+    template <int B>
+    float get() const {
+        constexpr int i = layout<T>::find(B);
+        if constexpr (i >= 0) {
+            if constexpr (layout<T>::blades[i].sign > 0) return v.d[i];
+            else return -v.d[i];
+        } else if constexpr (B == layout<T>::implicit) {
+            return 1.0f;
+        } else {
+            return 0.0f;
+        }
+    }
+};
+
+struct scalar_leaf : node<scalar_leaf> {
+    static constexpr mask_t mask = 1;
+    float v;
+    explicit scalar_leaf(float v) : v(v) {}
+
+    template <int B>
+    float get() const { return B == 0 ? v : 0.0f; }
+};
+
+template <typename A, typename Bn>
+struct gp_node : node<gp_node<A, Bn>> {
+    static constexpr mask_t mask = gp_mask(A::mask, Bn::mask);
+    A a;
+    Bn b;
+    gp_node(const A& a, const Bn& b) : a(a), b(b) {}
+
+    template <int C>
+    float get() const { return sum<C>(std::make_integer_sequence<int, 16>{}); }
+
+private:
+    // Starting from -0 keeps the fold exact, x + -0 == x so the compiler drops the empty terms
+    template <int C, int... I>
+    float sum(std::integer_sequence<int, I...>) const { return (-0.0f + ... + term<C, I>()); }
+
+    template <int C, int I>
+    float term() const {
+        constexpr int J = I ^ C;
+        if constexpr (has(A::mask, I) && has(Bn::mask, J) && !blade_null(I, J)) {
+            if constexpr (blade_sign(I, J) > 0) return a.template get<I>() * b.template get<J>();
+            else return -(a.template get<I>() * b.template get<J>());
+        } else {
+            return -0.0f;
+        }
+    }
+};
+
+template <typename A, typename Bn, bool Sub>
+struct add_node : node<add_node<A, Bn, Sub>> {
+    static constexpr mask_t mask = A::mask | Bn::mask;
+    A a;
+    Bn b;
+    add_node(const A& a, const Bn& b) : a(a), b(b) {}
+
+    template <int C>
+    float get() const {
+        if constexpr (has(A::mask, C) && has(Bn::mask, C)) return Sub ? a.template get<C>() - b.template get<C>() : a.template get<C>() + b.template get<C>();
+        else if constexpr (has(A::mask, C)) return a.template get<C>();
+        else if constexpr (has(Bn::mask, C)) return Sub ? -b.template get<C>() : b.template get<C>();
+        else return 0.0f;
+    }
+};
+
+// Reverse flips grades 2 and 3
+template <typename A>
+struct reverse_node : node<reverse_node<A>> {
+    static constexpr mask_t mask = A::mask;
+    A a;
+    explicit reverse_node(const A& a) : a(a) {}
+
+    template <int C>
+    float get() const {
+        if constexpr (blade_grade(C) == 2 || blade_grade(C) == 3) return -a.template get<C>();
+        else return a.template get<C>();
+    }
+};
+
+template <typename A, int Grade>
+struct grade_node : node<grade_node<A, Grade>> {
+    static constexpr mask_t mask = A::mask & grade_mask(Grade);
+    A a;
+    explicit grade_node(const A& a) : a(a) {}
+
+    template <int C>
+    float get() const {
+        if constexpr (has(mask, C)) return a.template get<C>();
+        else return 0.0f;
+    }
+};
+
+template <typename A, typename Bn>
+gp_node<A, Bn> operator*(const node<A>& a, const node<Bn>& b) { return { a.self(), b.self() }; }
+
+template <typename A, typename Bn>
+add_node<A, Bn, false> operator+(const node<A>& a, const node<Bn>& b) { return { a.self(), b.self() }; }
+
+template <typename A, typename Bn>
+add_node<A, Bn, true> operator-(const node<A>& a, const node<Bn>& b) { return { a.self(), b.self() }; }
+
+template <typename A>
+reverse_node<A> operator~(const node<A>& a) { return reverse_node<A>(a.self()); }
+
+// Sandwich, a * b * ~a
+template <typename A, typename Bn>
+gp_node<gp_node<A, Bn>, reverse_node<A>> operator>>(const node<A>& a, const node<Bn>& b) {
+    return { gp_node<A, Bn>(a.self(), b.self()), reverse_node<A>(a.self()) };
+}
+
+template <int Grade, typename A>
+grade_node<A, Grade> grade(const node<A>& a) { return grade_node<A, Grade>(a.self()); }
+
+template <typename T, typename E, int... I>
+T eval(const E& e, std::integer_sequence<int, I...>) {
+    T res;
+    ((res.d[I] = layout<T>::blades[I].sign > 0 ? e.template get<layout<T>::blades[I].blade>() : -e.template get<layout<T>::blades[I].blade>()), ...);
+    return res;
+}
+
+} // namespace pga3d_expr
+
+template <typename T>
+inline pga3d_expr::leaf<T> lazy(const T& v) { return pga3d_expr::leaf<T>(v); }
+
+inline pga3d_expr::scalar_leaf lazy(scalar_t v) { return pga3d_expr::scalar_leaf(v); }
+
+// Evaluates the blades T stores, implicit ones (the e123 of a point, the 1 of a translation) are assumed
+template <typename T, typename E>
+inline T eval(const pga3d_expr::node<E>& e) {
+    return pga3d_expr::eval<T>(e.self(), std::make_integer_sequence<int, pga3d_expr::layout<T>::size>{});
+}
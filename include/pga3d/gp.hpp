@@ -0,0 +1,3714 @@
+// Written by GAmphetamine.js
+// Geometric product
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+#include "gp_core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and trivector  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const scalar_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and quadvector  
+// a
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const scalar_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = a * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and horizon  
+// a
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const scalar_t& a, const horizon_t& b) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and origin  
+// a
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const scalar_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and evector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator*(const scalar_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and dpoint  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const scalar_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and odd  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const scalar_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    res.d[6] = a * b6;
+    res.d[7] = a * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 13 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = a0 * b3;
+    res.d[2] = a1 * b3;
+    res.d[3] = a2 * b3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2 + a3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const vector_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const vector_t& a, const horizon_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = a3 * b0;
+    res.d[5] = a3 * b1;
+    res.d[6] = a3 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = a3 * b0 - a0;
+    res.d[5] = a3 * b1 - a1;
+    res.d[6] = a3 * b2 - a2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 28 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7 + a1 * b2 - a2 * b1;
+    res.d[2] = a1 * b7 + a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 + a2 * b7 - a1 * b0;
+    res.d[4] = a2 * b5 + a3 * b0 - a0 * b3 - a1 * b6;
+    res.d[5] = a0 * b6 + a3 * b1 - a1 * b3 - a2 * b4;
+    res.d[6] = a1 * b4 + a3 * b2 - a0 * b5 - a2 * b3;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6 + a3 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 15 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b3;
+    res.d[1] = -a1 * b3;
+    res.d[2] = -a2 * b3;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2 - a3 * b3;
+    res.d[5] = a0 * b2 - a2 * b0 - a4 * b3;
+    res.d[6] = a1 * b0 - a0 * b1 - a5 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const bivector_t& a, const quadvector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a1 * b0;
+    res.d[2] = -a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const bivector_t& a, const horizon_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = 0.0;
+    res.d[4] = -a3;
+    res.d[5] = -a4;
+    res.d[6] = -a5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = a3 * b0 + a4 * b1 + a5 * b2;
+    res.d[4] = a5 * b1 - a4 * b2;
+    res.d[5] = a3 * b2 - a5 * b0;
+    res.d[6] = a4 * b0 - a3 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = a3 * b0 + a4 * b1 + a5 * b2;
+    res.d[4] = a5 * b1 - a0 - a4 * b2;
+    res.d[5] = a3 * b2 - a1 - a5 * b0;
+    res.d[6] = a4 * b0 - a2 - a3 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 36 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b1 - a0 * b7 - a1 * b2;
+    res.d[1] = a0 * b2 - a1 * b7 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1 - a2 * b7;
+    res.d[3] = a0 * b4 + a1 * b5 + a2 * b6 + a3 * b0 + a4 * b1 + a5 * b2;
+    res.d[4] = a2 * b5 + a5 * b1 - a0 * b3 - a1 * b6 - a3 * b7 - a4 * b2;
+    res.d[5] = a0 * b6 + a3 * b2 - a1 * b3 - a2 * b4 - a4 * b7 - a5 * b0;
+    res.d[6] = a1 * b4 + a4 * b0 - a0 * b5 - a2 * b3 - a3 * b1 - a5 * b7;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const trivector_t& a, const scalar_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 13 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = a3 * b0;
+    res.d[2] = a3 * b1;
+    res.d[3] = a3 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 15 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const trivector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a3 * b0;
+    res.d[1] = -a3 * b1;
+    res.d[2] = -a3 * b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 + a3 * b3 - a1 * b2;
+    res.d[5] = a0 * b2 + a3 * b4 - a2 * b0;
+    res.d[6] = a1 * b0 + a3 * b5 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 7 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a3 * b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b3 - a3 * b0;
+    res.d[5] = a1 * b3 - a3 * b1;
+    res.d[6] = a2 * b3 - a3 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const trivector_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a3 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₀
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const trivector_t& a, const horizon_t& b) {
+    quadvector_t res;
+    const float a3 = a.d[3];
+    res.d[0] = -a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = -a3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0;
+    res.d[5] = a1;
+    res.d[6] = a2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 - a3 * b0;
+    res.d[5] = a1 - a3 * b1;
+    res.d[6] = a2 - a3 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const trivector_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a3 * b0;
+    res.d[1] = -a3 * b1;
+    res.d[2] = -a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const trivector_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a3 * b0;
+    res.d[1] = -a3 * b1;
+    res.d[2] = -a3 * b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const trivector_t& a, const ibivector_t& b) {
+    direction_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a3 * b0;
+    res.d[1] = a3 * b1;
+    res.d[2] = a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a3 * b0;
+    res.d[2] = a3 * b1;
+    res.d[3] = a3 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a3 * b0;
+    res.d[2] = a3 * b1;
+    res.d[3] = a3 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2 - a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 16 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const trivector_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a3 * b1;
+    res.d[1] = -a3 * b2;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = a3 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const trivector_t& a, const translation_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 + a3 * b0;
+    res.d[1] = a1 + a3 * b1;
+    res.d[2] = a2 + a3 * b2;
+    res.d[3] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 20 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const trivector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a3 * b1;
+    res.d[1] = -a3 * b2;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3 + a3 * b7;
+    res.d[4] = a0 * b0 + a2 * b2 + a3 * b4 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 + a3 * b5 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 + a3 * b6 - a0 * b2;
+    res.d[7] = a3 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between trivector and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 20 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const trivector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a3 * b7;
+    res.d[1] = a3 * b0;
+    res.d[2] = a3 * b1;
+    res.d[3] = a3 * b2;
+    res.d[4] = a0 * b7 + a1 * b2 - a2 * b1 - a3 * b4;
+    res.d[5] = a1 * b7 + a2 * b0 - a0 * b2 - a3 * b5;
+    res.d[6] = a0 * b1 + a2 * b7 - a1 * b0 - a3 * b6;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and scalar  
+// a0 e₀₁₂₃
+// b
+// -> r0 e₀₁₂₃
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const quadvector_t& a, const scalar_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = a0 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and vector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const quadvector_t& a, const vector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a0 * b1;
+    res.d[2] = -a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and bivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const quadvector_t& a, const bivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a0 * b1;
+    res.d[2] = -a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and trivector  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 1 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const quadvector_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and quadvector  
+// a0 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const quadvector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and horizon  
+// a0 e₀₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const quadvector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and origin  
+// a0 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const quadvector_t& a, const origin_t& b) {
+    vector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and point  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const quadvector_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and direction  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const quadvector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and ebivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const quadvector_t& a, const ebivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a0 * b1;
+    res.d[2] = -a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and ibivector  
+// a0 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const quadvector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and evector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const quadvector_t& a, const evector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a0 * b1;
+    res.d[2] = -a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and dpoint  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const quadvector_t& a, const dpoint_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a0 * b1;
+    res.d[2] = -a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and rotation  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const quadvector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a0 * b1;
+    res.d[5] = -a0 * b2;
+    res.d[6] = -a0 * b3;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and translation  
+// a0 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const quadvector_t& a, const translation_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and even  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const quadvector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a0 * b1;
+    res.d[5] = -a0 * b2;
+    res.d[6] = -a0 * b3;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between quadvector and odd  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 4 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const quadvector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b7;
+    res.d[4] = -a0 * b0;
+    res.d[5] = -a0 * b1;
+    res.d[6] = -a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and scalar  
+// 1 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const horizon_t& a, const scalar_t& b) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and vector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const horizon_t& a, const vector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and bivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const horizon_t& a, const bivector_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and trivector  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const horizon_t& a, const trivector_t& b) {
+    quadvector_t res;
+    const float b3 = b.d[3];
+    res.d[0] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and quadvector  
+// 1 e₀
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const horizon_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and horizon  
+// 1 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const horizon_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and origin  
+// 1 e₀
+// 1 e₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const horizon_t& a, const origin_t& b) {
+    quadvector_t res;
+    res.d[0] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and point  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const horizon_t& a, const point_t& b) {
+    quadvector_t res;
+    res.d[0] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and direction  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const horizon_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and ebivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const horizon_t& a, const ebivector_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and ibivector  
+// 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const horizon_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and evector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const horizon_t& a, const evector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and dpoint  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const horizon_t& a, const dpoint_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and rotation  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const horizon_t& a, const rotation_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    res.d[4] = -b1;
+    res.d[5] = -b2;
+    res.d[6] = -b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and translation  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator*(const horizon_t& a, const translation_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and even  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const horizon_t& a, const even_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    res.d[4] = -b1;
+    res.d[5] = -b2;
+    res.d[6] = -b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between horizon and odd  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const horizon_t& a, const odd_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0;
+    res.d[5] = b1;
+    res.d[6] = b2;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and scalar  
+// 1 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const origin_t& a, const scalar_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and vector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const origin_t& a, const vector_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = -b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and bivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const origin_t& a, const bivector_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = 0.0;
+    res.d[4] = b3;
+    res.d[5] = b4;
+    res.d[6] = b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and trivector  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const origin_t& a, const trivector_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -b0;
+    res.d[5] = -b1;
+    res.d[6] = -b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and quadvector  
+// 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const origin_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and horizon  
+// 1 e₁₂₃
+// 1 e₀
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const origin_t& a, const horizon_t& b) {
+    quadvector_t res;
+    res.d[0] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and origin  
+// 1 e₁₂₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const origin_t& a, const origin_t& b) {
+
+    return -1;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and point  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const origin_t& a, const point_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -1;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -b0;
+    res.d[5] = -b1;
+    res.d[6] = -b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and direction  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const origin_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and ebivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator*(const origin_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and ibivector  
+// 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const origin_t& a, const ibivector_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and evector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator*(const origin_t& a, const evector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and dpoint  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const origin_t& a, const dpoint_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and rotation  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const origin_t& a, const rotation_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b1;
+    res.d[1] = -b2;
+    res.d[2] = -b3;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and translation  
+// 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator*(const origin_t& a, const translation_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and even  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const origin_t& a, const even_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b1;
+    res.d[1] = -b2;
+    res.d[2] = -b3;
+    res.d[3] = b7;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between origin and odd  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const origin_t& a, const odd_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b7;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = -b4;
+    res.d[5] = -b5;
+    res.d[6] = -b6;
+    res.d[7] = -b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b3 - b0;
+    res.d[5] = a1 * b3 - b1;
+    res.d[6] = a2 * b3 - b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const point_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₀
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const point_t& a, const horizon_t& b) {
+    quadvector_t res;
+    res.d[0] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -1;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0;
+    res.d[5] = a1;
+    res.d[6] = a2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -1 - a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b7;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a0 * b7 + a1 * b2 - a2 * b1 - b4;
+    res.d[5] = a1 * b7 + a2 * b0 - a0 * b2 - b5;
+    res.d[6] = a0 * b1 + a2 * b7 - a1 * b0 - b6;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2 - b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const direction_t& a, const trivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b3;
+    res.d[1] = a1 * b3;
+    res.d[2] = a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const direction_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const direction_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const direction_t& a, const origin_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const direction_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const direction_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const direction_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b7 + a1 * b2 - a2 * b1;
+    res.d[5] = a1 * b7 + a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 + a2 * b7 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b3;
+    res.d[1] = -a1 * b3;
+    res.d[2] = -a2 * b3;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const ebivector_t& a, const quadvector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a1 * b0;
+    res.d[2] = -a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const ebivector_t& a, const horizon_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator*(const ebivector_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = -a0;
+    res.d[5] = -a1;
+    res.d[6] = -a2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b1 - a0 * b7 - a1 * b2;
+    res.d[1] = a0 * b2 - a1 * b7 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1 - a2 * b7;
+    res.d[3] = a0 * b4 + a1 * b5 + a2 * b6;
+    res.d[4] = a2 * b5 - a0 * b3 - a1 * b6;
+    res.d[5] = a0 * b6 - a1 * b3 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5 - a2 * b3;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and trivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const ibivector_t& a, const trivector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b3;
+    res.d[1] = -a1 * b3;
+    res.d[2] = -a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and quadvector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const ibivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and horizon  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const ibivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and origin  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const ibivector_t& a, const origin_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and evector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ibivector_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and dpoint  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ibivector_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and odd  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ibivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a0 * b7 - a1 * b2;
+    res.d[5] = a0 * b2 - a1 * b7 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1 - a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator*(const evector_t& a, const scalar_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = -a0 * b3;
+    res.d[5] = -a1 * b3;
+    res.d[6] = -a2 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    res.d[4] = a1 * b5 - a2 * b4;
+    res.d[5] = a2 * b3 - a0 * b5;
+    res.d[6] = a0 * b4 - a1 * b3;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = a0 * b3;
+    res.d[2] = a1 * b3;
+    res.d[3] = a2 * b3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const evector_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const evector_t& a, const horizon_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator*(const evector_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and point  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const direction_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const ibivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const evector_t& a, const evector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = -a0;
+    res.d[5] = -a1;
+    res.d[6] = -a2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and even  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const evector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = -a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7 + a1 * b6 - a2 * b5;
+    res.d[5] = a1 * b7 + a2 * b4 - a0 * b6;
+    res.d[6] = a0 * b5 + a2 * b7 - a1 * b4;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between evector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const evector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7 + a1 * b2 - a2 * b1;
+    res.d[2] = a1 * b7 + a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 + a2 * b7 - a1 * b0;
+    res.d[4] = a2 * b5 - a0 * b3 - a1 * b6;
+    res.d[5] = a0 * b6 - a1 * b3 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5 - a2 * b3;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const dpoint_t& a, const scalar_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = b0 - a0 * b3;
+    res.d[5] = b1 - a1 * b3;
+    res.d[6] = b2 - a2 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    res.d[4] = a1 * b5 - a2 * b4 - b0;
+    res.d[5] = a2 * b3 - a0 * b5 - b1;
+    res.d[6] = a0 * b4 - a1 * b3 - b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = a0 * b3;
+    res.d[2] = a1 * b3;
+    res.d[3] = a2 * b3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2 + b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const dpoint_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const dpoint_t& a, const horizon_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 1 + a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const direction_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = -b0;
+    res.d[5] = -b1;
+    res.d[6] = -b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const ibivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = b0;
+    res.d[5] = b1;
+    res.d[6] = b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = b0 - a0;
+    res.d[5] = b1 - a1;
+    res.d[6] = b2 - a2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = b0;
+    res.d[4] = -b1;
+    res.d[5] = -b2;
+    res.d[6] = -b3;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = 1 - a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const dpoint_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = b0 - a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7 + a1 * b6 - a2 * b5 - b1;
+    res.d[5] = a1 * b7 + a2 * b4 - a0 * b6 - b2;
+    res.d[6] = a0 * b5 + a2 * b7 - a1 * b4 - b3;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between dpoint and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const dpoint_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7 + a1 * b2 - a2 * b1;
+    res.d[2] = a1 * b7 + a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 + a2 * b7 - a1 * b0;
+    res.d[4] = a2 * b5 + b0 - a0 * b3 - a1 * b6;
+    res.d[5] = a0 * b6 + b1 - a1 * b3 - a2 * b4;
+    res.d[6] = a1 * b4 + b2 - a0 * b5 - a2 * b3;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6 + b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 16 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a1 * b3;
+    res.d[1] = -a2 * b3;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const rotation_t& a, const quadvector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a1 * b0;
+    res.d[5] = -a2 * b0;
+    res.d[6] = -a3 * b0;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const horizon_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0;
+    res.d[4] = -a1;
+    res.d[5] = -a2;
+    res.d[6] = -a3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = a0;
+    res.d[4] = -a1;
+    res.d[5] = -a2;
+    res.d[6] = -a3;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 32 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a3 * b1 - a1 * b7 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a2 * b7 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1 - a3 * b7;
+    res.d[3] = a0 * b3 + a1 * b4 + a2 * b5 + a3 * b6;
+    res.d[4] = a0 * b4 + a3 * b5 - a1 * b3 - a2 * b6;
+    res.d[5] = a0 * b5 + a1 * b6 - a2 * b3 - a3 * b4;
+    res.d[6] = a0 * b6 + a2 * b4 - a1 * b5 - a3 * b3;
+    res.d[7] = a0 * b7 + a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and trivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const translation_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 - a0 * b3;
+    res.d[1] = b1 - a1 * b3;
+    res.d[2] = b2 - a2 * b3;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and quadvector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator*(const translation_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator*(const translation_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and origin  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator*(const translation_t& a, const origin_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and evector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const translation_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and dpoint  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const translation_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 1 + a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and odd  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const translation_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2 + b3;
+    res.d[4] = a2 * b1 + b4 - a0 * b7 - a1 * b2;
+    res.d[5] = a0 * b2 + b5 - a1 * b7 - a2 * b0;
+    res.d[6] = a1 * b0 + b6 - a0 * b1 - a2 * b7;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 20 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a1 * b3;
+    res.d[1] = -a2 * b3;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2 - a7 * b3;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2 - a4 * b3;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0 - a5 * b3;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1 - a6 * b3;
+    res.d[7] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const quadvector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a1 * b0;
+    res.d[5] = -a2 * b0;
+    res.d[6] = -a3 * b0;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const horizon_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0;
+    res.d[4] = -a1;
+    res.d[5] = -a2;
+    res.d[6] = -a3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = -a7;
+    res.d[4] = -a4;
+    res.d[5] = -a5;
+    res.d[6] = -a6;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = a4 * b0 + a5 * b1 + a6 * b2;
+    res.d[4] = a6 * b1 - a5 * b2 - a7 * b0;
+    res.d[5] = a4 * b2 - a6 * b0 - a7 * b1;
+    res.d[6] = a5 * b0 - a4 * b1 - a7 * b2;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = a0 + a4 * b0 + a5 * b1 + a6 * b2;
+    res.d[4] = a6 * b1 - a1 - a5 * b2 - a7 * b0;
+    res.d[5] = a4 * b2 - a2 - a6 * b0 - a7 * b1;
+    res.d[6] = a5 * b0 - a3 - a4 * b1 - a7 * b2;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 48 muls / 40 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a3 * b1 - a1 * b7 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a2 * b7 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1 - a3 * b7;
+    res.d[3] = a0 * b3 + a1 * b4 + a2 * b5 + a3 * b6 + a4 * b0 + a5 * b1 + a6 * b2 - a7 * b7;
+    res.d[4] = a0 * b4 + a3 * b5 + a6 * b1 - a1 * b3 - a2 * b6 - a4 * b7 - a5 * b2 - a7 * b0;
+    res.d[5] = a0 * b5 + a1 * b6 + a4 * b2 - a2 * b3 - a3 * b4 - a5 * b7 - a6 * b0 - a7 * b1;
+    res.d[6] = a0 * b6 + a2 * b4 + a5 * b0 - a1 * b5 - a3 * b3 - a4 * b1 - a6 * b7 - a7 * b2;
+    res.d[7] = a0 * b7 + a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const scalar_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    res.d[4] = a4 * b;
+    res.d[5] = a5 * b;
+    res.d[6] = a6 * b;
+    res.d[7] = a7 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 28 muls / 21 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 + a7 * b0 - a2 * b1;
+    res.d[2] = a2 * b0 + a7 * b1 - a0 * b2;
+    res.d[3] = a0 * b1 + a7 * b2 - a1 * b0;
+    res.d[4] = a3 * b0 + a5 * b2 - a0 * b3 - a6 * b1;
+    res.d[5] = a3 * b1 + a6 * b0 - a1 * b3 - a4 * b2;
+    res.d[6] = a3 * b2 + a4 * b1 - a2 * b3 - a5 * b0;
+    res.d[7] = -a4 * b0 - a5 * b1 - a6 * b2 - a7 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 36 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2 - a7 * b0;
+    res.d[1] = a0 * b2 - a2 * b0 - a7 * b1;
+    res.d[2] = a1 * b0 - a0 * b1 - a7 * b2;
+    res.d[3] = a4 * b0 + a5 * b1 + a6 * b2 - a0 * b3 - a1 * b4 - a2 * b5;
+    res.d[4] = a1 * b5 + a6 * b1 + a7 * b3 - a2 * b4 - a3 * b0 - a5 * b2;
+    res.d[5] = a2 * b3 + a4 * b2 + a7 * b4 - a0 * b5 - a3 * b1 - a6 * b0;
+    res.d[6] = a0 * b4 + a5 * b0 + a7 * b5 - a1 * b3 - a3 * b2 - a4 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 20 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a7 * b3;
+    res.d[1] = a0 * b3;
+    res.d[2] = a1 * b3;
+    res.d[3] = a2 * b3;
+    res.d[4] = a2 * b1 + a4 * b3 - a1 * b2 - a7 * b0;
+    res.d[5] = a0 * b2 + a5 * b3 - a2 * b0 - a7 * b1;
+    res.d[6] = a1 * b0 + a6 * b3 - a0 * b1 - a7 * b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2 + a3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const quadvector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a7 * b0;
+    res.d[4] = a0 * b0;
+    res.d[5] = a1 * b0;
+    res.d[6] = a2 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const horizon_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a0;
+    res.d[5] = -a1;
+    res.d[6] = -a2;
+    res.d[7] = -a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = -a7;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a4;
+    res.d[5] = a5;
+    res.d[6] = a6;
+    res.d[7] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a7;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 + a4 - a1 * b2 - a7 * b0;
+    res.d[5] = a0 * b2 + a5 - a2 * b0 - a7 * b1;
+    res.d[6] = a1 * b0 + a6 - a0 * b1 - a7 * b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2 + a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const direction_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2 - a7 * b0;
+    res.d[5] = a0 * b2 - a2 * b0 - a7 * b1;
+    res.d[6] = a1 * b0 - a0 * b1 - a7 * b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2 - a7 * b0;
+    res.d[1] = a0 * b2 - a2 * b0 - a7 * b1;
+    res.d[2] = a1 * b0 - a0 * b1 - a7 * b2;
+    res.d[3] = a4 * b0 + a5 * b1 + a6 * b2;
+    res.d[4] = a6 * b1 - a3 * b0 - a5 * b2;
+    res.d[5] = a4 * b2 - a3 * b1 - a6 * b0;
+    res.d[6] = a5 * b0 - a3 * b2 - a4 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const ibivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 + a7 * b0 - a2 * b1;
+    res.d[5] = a2 * b0 + a7 * b1 - a0 * b2;
+    res.d[6] = a0 * b1 + a7 * b2 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 + a7 * b0 - a2 * b1;
+    res.d[2] = a2 * b0 + a7 * b1 - a0 * b2;
+    res.d[3] = a0 * b1 + a7 * b2 - a1 * b0;
+    res.d[4] = a3 * b0 + a5 * b2 - a6 * b1;
+    res.d[5] = a3 * b1 + a6 * b0 - a4 * b2;
+    res.d[6] = a3 * b2 + a4 * b1 - a5 * b0;
+    res.d[7] = -a4 * b0 - a5 * b1 - a6 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 21 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 + a7 * b0 - a2 * b1;
+    res.d[2] = a2 * b0 + a7 * b1 - a0 * b2;
+    res.d[3] = a0 * b1 + a7 * b2 - a1 * b0;
+    res.d[4] = a3 * b0 + a5 * b2 - a0 - a6 * b1;
+    res.d[5] = a3 * b1 + a6 * b0 - a1 - a4 * b2;
+    res.d[6] = a3 * b2 + a4 * b1 - a2 - a5 * b0;
+    res.d[7] = -a4 * b0 - a5 * b1 - a6 * b2 - a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 32 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3 - a7 * b1;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1 - a7 * b2;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2 - a7 * b3;
+    res.d[3] = a3 * b0 + a4 * b1 + a5 * b2 + a6 * b3;
+    res.d[4] = a4 * b0 + a6 * b2 - a3 * b1 - a5 * b3;
+    res.d[5] = a4 * b3 + a5 * b0 - a3 * b2 - a6 * b1;
+    res.d[6] = a5 * b1 + a6 * b0 - a3 * b3 - a4 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3 + a7 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3 - a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 + a4 + a7 * b0 - a2 * b1;
+    res.d[5] = a2 * b0 + a5 + a7 * b1 - a0 * b2;
+    res.d[6] = a0 * b1 + a6 + a7 * b2 - a1 * b0;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 48 muls / 40 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const odd_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3 - a7 * b1;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1 - a7 * b2;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2 - a7 * b3;
+    res.d[3] = a3 * b0 + a4 * b1 + a5 * b2 + a6 * b3 + a7 * b7 - a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7 + a1 * b6 + a4 * b0 + a6 * b2 + a7 * b4 - a2 * b5 - a3 * b1 - a5 * b3;
+    res.d[5] = a1 * b7 + a2 * b4 + a4 * b3 + a5 * b0 + a7 * b5 - a0 * b6 - a3 * b2 - a6 * b1;
+    res.d[6] = a0 * b5 + a2 * b7 + a5 * b1 + a6 * b0 + a7 * b6 - a1 * b4 - a3 * b3 - a4 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3 + a7 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between odd and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 48 muls / 40 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const odd_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2 - a7 * b7;
+    res.d[1] = a0 * b7 + a1 * b2 + a7 * b0 - a2 * b1;
+    res.d[2] = a1 * b7 + a2 * b0 + a7 * b1 - a0 * b2;
+    res.d[3] = a0 * b1 + a2 * b7 + a7 * b2 - a1 * b0;
+    res.d[4] = a2 * b5 + a3 * b0 + a4 * b7 + a5 * b2 - a0 * b3 - a1 * b6 - a6 * b1 - a7 * b4;
+    res.d[5] = a0 * b6 + a3 * b1 + a5 * b7 + a6 * b0 - a1 * b3 - a2 * b4 - a4 * b2 - a7 * b5;
+    res.d[6] = a1 * b4 + a3 * b2 + a4 * b1 + a6 * b7 - a0 * b5 - a2 * b3 - a5 * b0 - a7 * b6;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6 + a3 * b7 - a4 * b0 - a5 * b1 - a6 * b2 - a7 * b3;
+    return res;
+}
@@ -0,0 +1,2028 @@
+// Written by GAmphetamine.js
+// Geometric product, points, directions and motors only
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and vector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const scalar_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and bivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator*(const scalar_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and point  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const scalar_t& a, const point_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and direction  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const scalar_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and ebivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator*(const scalar_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and ibivector  
+// a
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const scalar_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and rotation  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const scalar_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and translation  
+// a
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const scalar_t& a, const translation_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a * b0;
+    res.d[5] = a * b1;
+    res.d[6] = a * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between scalar and even  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const scalar_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    res.d[6] = a * b6;
+    res.d[7] = a * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator*(const vector_t& a, const scalar_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 15 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a1 * b2 - a2 * b1;
+    res.d[2] = a2 * b0 - a0 * b2;
+    res.d[3] = a0 * b1 - a1 * b0;
+    res.d[4] = a3 * b0 - a0 * b3;
+    res.d[5] = a3 * b1 - a1 * b3;
+    res.d[6] = a3 * b2 - a2 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 21 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    res.d[4] = a1 * b5 - a2 * b4 - a3 * b0;
+    res.d[5] = a2 * b3 - a0 * b5 - a3 * b1;
+    res.d[6] = a0 * b4 - a1 * b3 - a3 * b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2 + a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const vector_t& a, const direction_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = -a3 * b0;
+    res.d[5] = -a3 * b1;
+    res.d[6] = -a3 * b2;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const ibivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 16 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = a3 * b0;
+    res.d[4] = -a3 * b1;
+    res.d[5] = -a3 * b2;
+    res.d[6] = -a3 * b3;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3 - a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between vector and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 28 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const vector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[2] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[3] = a3 * b0 - a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7 + a1 * b6 - a2 * b5 - a3 * b1;
+    res.d[5] = a1 * b7 + a2 * b4 - a0 * b6 - a3 * b2;
+    res.d[6] = a0 * b5 + a2 * b7 - a1 * b4 - a3 * b3;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator*(const bivector_t& a, const scalar_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    res.d[4] = a4 * b;
+    res.d[5] = a5 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 21 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = a3 * b0 + a4 * b1 + a5 * b2;
+    res.d[4] = a5 * b1 - a0 * b3 - a4 * b2;
+    res.d[5] = a3 * b2 - a1 * b3 - a5 * b0;
+    res.d[6] = a4 * b0 - a2 * b3 - a3 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 27 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[1] = a2 * b1 - a1 * b2;
+    res.d[2] = a0 * b2 - a2 * b0;
+    res.d[3] = a1 * b0 - a0 * b1;
+    res.d[4] = a2 * b4 + a5 * b1 - a1 * b5 - a4 * b2;
+    res.d[5] = a0 * b5 + a3 * b2 - a2 * b3 - a5 * b0;
+    res.d[6] = a1 * b3 + a4 * b0 - a0 * b4 - a3 * b1;
+    res.d[7] = a0 * b3 + a1 * b4 + a2 * b5 + a3 * b0 + a4 * b1 + a5 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2 - a3;
+    res.d[5] = a0 * b2 - a2 * b0 - a4;
+    res.d[6] = a1 * b0 - a0 * b1 - a5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const bivector_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const ebivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[1] = a2 * b1 - a1 * b2;
+    res.d[2] = a0 * b2 - a2 * b0;
+    res.d[3] = a1 * b0 - a0 * b1;
+    res.d[4] = a5 * b1 - a4 * b2;
+    res.d[5] = a3 * b2 - a5 * b0;
+    res.d[6] = a4 * b0 - a3 * b1;
+    res.d[7] = a3 * b0 + a4 * b1 + a5 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const ibivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[2] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[3] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[4] = a3 * b0 + a5 * b2 - a4 * b3;
+    res.d[5] = a3 * b3 + a4 * b0 - a5 * b1;
+    res.d[6] = a4 * b1 + a5 * b0 - a3 * b2;
+    res.d[7] = a3 * b1 + a4 * b2 + a5 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 + a3 - a1 * b2;
+    res.d[5] = a0 * b2 + a4 - a2 * b0;
+    res.d[6] = a1 * b0 + a5 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between bivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 36 muls / 29 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const bivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[2] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[3] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[4] = a2 * b5 + a3 * b0 + a5 * b2 - a0 * b7 - a1 * b6 - a4 * b3;
+    res.d[5] = a0 * b6 + a3 * b3 + a4 * b0 - a1 * b7 - a2 * b4 - a5 * b1;
+    res.d[6] = a1 * b4 + a4 * b1 + a5 * b0 - a0 * b5 - a2 * b7 - a3 * b2;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6 + a3 * b1 + a4 * b2 + a5 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator*(const point_t& a, const scalar_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2 - b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const point_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 + b3 - a1 * b2;
+    res.d[5] = a0 * b2 + b4 - a2 * b0;
+    res.d[6] = a1 * b0 + b5 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const point_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -1;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 - b0;
+    res.d[5] = a1 - b1;
+    res.d[6] = a2 - b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const point_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const point_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const point_t& a, const ibivector_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const point_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b1;
+    res.d[1] = -b2;
+    res.d[2] = -b3;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator*(const point_t& a, const translation_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 + b0;
+    res.d[1] = a1 + b1;
+    res.d[2] = a2 + b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between point and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const point_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b1;
+    res.d[1] = -b2;
+    res.d[2] = -b3;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3 + b7;
+    res.d[4] = a0 * b0 + a2 * b2 + b4 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 + b5 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 + b6 - a0 * b2;
+    res.d[7] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const direction_t& a, const scalar_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const direction_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const direction_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const direction_t& a, const point_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const direction_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const direction_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const direction_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const direction_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const direction_t& a, const translation_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between direction and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const direction_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b1 + a1 * b2 + a2 * b3;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator*(const ebivector_t& a, const scalar_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = 0.0;
+    res.d[4] = -a0 * b3;
+    res.d[5] = -a1 * b3;
+    res.d[6] = -a2 * b3;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ebivector_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[1] = a2 * b1 - a1 * b2;
+    res.d[2] = a0 * b2 - a2 * b0;
+    res.d[3] = a1 * b0 - a0 * b1;
+    res.d[4] = a2 * b4 - a1 * b5;
+    res.d[5] = a0 * b5 - a2 * b3;
+    res.d[6] = a1 * b3 - a0 * b4;
+    res.d[7] = a0 * b3 + a1 * b4 + a2 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ebivector_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const ebivector_t& a, const ebivector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[1] = a2 * b1 - a1 * b2;
+    res.d[2] = a0 * b2 - a2 * b0;
+    res.d[3] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ebivector_t& a, const ibivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 12 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const ebivector_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[2] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[3] = a1 * b1 + a2 * b0 - a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ebivector_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ebivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ebivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[2] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[3] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[4] = a2 * b5 - a0 * b7 - a1 * b6;
+    res.d[5] = a0 * b6 - a1 * b7 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5 - a2 * b7;
+    res.d[7] = a0 * b4 + a1 * b5 + a2 * b6;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and scalar  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const ibivector_t& a, const scalar_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and vector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const ibivector_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and bivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ibivector_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and point  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const ibivector_t& a, const point_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and direction  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const ibivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and ebivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ibivector_t& a, const ebivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and ibivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator*(const ibivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and rotation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ibivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and translation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const ibivector_t& a, const translation_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between ibivector and even  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const ibivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const rotation_t& a, const scalar_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 16 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = a0 * b3;
+    res.d[4] = -a1 * b3;
+    res.d[5] = -a2 * b3;
+    res.d[6] = -a3 * b3;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const rotation_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[2] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[3] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[4] = a0 * b3 + a3 * b4 - a2 * b5;
+    res.d[5] = a0 * b4 + a1 * b5 - a3 * b3;
+    res.d[6] = a0 * b5 + a2 * b3 - a1 * b4;
+    res.d[7] = a1 * b3 + a2 * b4 + a3 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const rotation_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 12 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator*(const rotation_t& a, const ebivector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[2] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[3] = a0 * b2 + a2 * b0 - a1 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const rotation_t& a, const ibivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 16 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+#if !PGA3D_SIMD_KERNELS
+CONSTEXPR inline rotation_t operator*(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1 + a1 * b0 + a3 * b2 - a2 * b3;
+    res.d[2] = a0 * b2 + a1 * b3 + a2 * b0 - a3 * b1;
+    res.d[3] = a0 * b3 + a2 * b1 + a3 * b0 - a1 * b2;
+    return res;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const rotation_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between rotation and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 32 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const rotation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1 + a1 * b0 + a3 * b2 - a2 * b3;
+    res.d[2] = a0 * b2 + a1 * b3 + a2 * b0 - a3 * b1;
+    res.d[3] = a0 * b3 + a2 * b1 + a3 * b0 - a1 * b2;
+    res.d[4] = a0 * b4 + a3 * b5 - a1 * b7 - a2 * b6;
+    res.d[5] = a0 * b5 + a1 * b6 - a2 * b7 - a3 * b4;
+    res.d[6] = a0 * b6 + a2 * b4 - a1 * b5 - a3 * b7;
+    res.d[7] = a0 * b7 + a1 * b4 + a2 * b5 + a3 * b6;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and scalar  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const translation_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b;
+    res.d[5] = a1 * b;
+    res.d[6] = a2 * b;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and vector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const translation_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2 + b3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and bivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const translation_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a2 * b1 + b3 - a1 * b2;
+    res.d[5] = a0 * b2 + b4 - a2 * b0;
+    res.d[6] = a1 * b0 + b5 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and point  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator*(const translation_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0 - a0;
+    res.d[1] = b1 - a1;
+    res.d[2] = b2 - a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and direction  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator*(const translation_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and ebivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const translation_t& a, const ebivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = b0;
+    res.d[2] = b1;
+    res.d[3] = b2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and ibivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator*(const translation_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and rotation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const translation_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = a0 * b0 + a2 * b2 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 - a0 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and translation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator*(const translation_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 + b0;
+    res.d[1] = a1 + b1;
+    res.d[2] = a2 + b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between translation and even  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const translation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = a0 * b0 + a2 * b2 + b4 - a1 * b3;
+    res.d[5] = a0 * b3 + a1 * b0 + b5 - a2 * b1;
+    res.d[6] = a1 * b1 + a2 * b0 + b6 - a0 * b2;
+    res.d[7] = a0 * b1 + a1 * b2 + a2 * b3 + b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = a0 * b;
+    res.d[1] = a1 * b;
+    res.d[2] = a2 * b;
+    res.d[3] = a3 * b;
+    res.d[4] = a4 * b;
+    res.d[5] = a5 * b;
+    res.d[6] = a6 * b;
+    res.d[7] = a7 * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 28 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[1] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[2] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[3] = a0 * b3 + a4 * b0 + a5 * b1 + a6 * b2;
+    res.d[4] = a6 * b1 - a1 * b3 - a5 * b2 - a7 * b0;
+    res.d[5] = a4 * b2 - a2 * b3 - a6 * b0 - a7 * b1;
+    res.d[6] = a5 * b0 - a3 * b3 - a4 * b1 - a7 * b2;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 36 muls / 29 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[2] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[3] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[4] = a0 * b3 + a3 * b4 + a6 * b1 - a2 * b5 - a5 * b2 - a7 * b0;
+    res.d[5] = a0 * b4 + a1 * b5 + a4 * b2 - a3 * b3 - a6 * b0 - a7 * b1;
+    res.d[6] = a0 * b5 + a2 * b3 + a5 * b0 - a1 * b4 - a4 * b1 - a7 * b2;
+    res.d[7] = a1 * b3 + a2 * b4 + a3 * b5 + a4 * b0 + a5 * b1 + a6 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2 - a7;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2 - a4;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0 - a5;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1 - a6;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator*(const even_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 24 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const ebivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[2] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[3] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[4] = a6 * b1 - a5 * b2 - a7 * b0;
+    res.d[5] = a4 * b2 - a6 * b0 - a7 * b1;
+    res.d[6] = a5 * b0 - a4 * b1 - a7 * b2;
+    res.d[7] = a4 * b0 + a5 * b1 + a6 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const ibivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0 + a3 * b1 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 - a1 * b1;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 32 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1 + a1 * b0 + a3 * b2 - a2 * b3;
+    res.d[2] = a0 * b2 + a1 * b3 + a2 * b0 - a3 * b1;
+    res.d[3] = a0 * b3 + a2 * b1 + a3 * b0 - a1 * b2;
+    res.d[4] = a4 * b0 + a6 * b2 - a5 * b3 - a7 * b1;
+    res.d[5] = a4 * b3 + a5 * b0 - a6 * b1 - a7 * b2;
+    res.d[6] = a5 * b1 + a6 * b0 - a4 * b2 - a7 * b3;
+    res.d[7] = a4 * b1 + a5 * b2 + a6 * b3 + a7 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator*(const even_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a0 * b0 + a3 * b1 + a4 - a2 * b2;
+    res.d[5] = a0 * b1 + a1 * b2 + a5 - a3 * b0;
+    res.d[6] = a0 * b2 + a2 * b0 + a6 - a1 * b1;
+    res.d[7] = a1 * b0 + a2 * b1 + a3 * b2 + a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// gp between even and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 48 muls / 40 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+#if !PGA3D_SIMD_KERNELS
+CONSTEXPR inline even_t operator*(const even_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1 + a1 * b0 + a3 * b2 - a2 * b3;
+    res.d[2] = a0 * b2 + a1 * b3 + a2 * b0 - a3 * b1;
+    res.d[3] = a0 * b3 + a2 * b1 + a3 * b0 - a1 * b2;
+    res.d[4] = a0 * b4 + a3 * b5 + a4 * b0 + a6 * b2 - a1 * b7 - a2 * b6 - a5 * b3 - a7 * b1;
+    res.d[5] = a0 * b5 + a1 * b6 + a4 * b3 + a5 * b0 - a2 * b7 - a3 * b4 - a6 * b1 - a7 * b2;
+    res.d[6] = a0 * b6 + a2 * b4 + a5 * b1 + a6 * b0 - a1 * b5 - a3 * b7 - a4 * b2 - a7 * b3;
+    res.d[7] = a0 * b7 + a1 * b4 + a2 * b5 + a3 * b6 + a4 * b1 + a5 * b2 + a6 * b3 + a7 * b0;
+    return res;
+}
+#endif
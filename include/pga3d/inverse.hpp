@@ -0,0 +1,121 @@
+// Written by GAmphetamine.js
+// Inverse
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+#include "inverse_core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of trivector
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t inverse(const trivector_t& a) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = (-a0) / (a3 * a3);
+    res.d[1] = (-a1) / (a3 * a3);
+    res.d[2] = (-a2) / (a3 * a3);
+    res.d[3] = (-1) / (a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of quadvector
+// a0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t inverse(const quadvector_t& a) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of horizon
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t inverse(const horizon_t& a) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of origin
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t inverse(const origin_t& a) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of evector
+// a0 e₁ + a1 e₂ + a2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t inverse(const evector_t& a) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = (a0) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[1] = (a1) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[2] = (a2) / (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of dpoint
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t inverse(const dpoint_t& a) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = (a0) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[1] = (a1) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[2] = (a2) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[3] = (1) / (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of odd
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 388 muls / 109 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t inverse(const odd_t& a) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = (a0 * a0 * a0 + a0 * a1 * a1 + a0 * a2 * a2 + a0 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[1] = (a0 * a0 * a1 + a1 * a1 * a1 + a1 * a2 * a2 + a1 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[2] = (a0 * a0 * a2 + a1 * a1 * a2 + a2 * a2 * a2 + a2 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[3] = (a0 * a0 * a3 + a1 * a1 * a3 + a2 * a2 * a3 - 2 * a0 * a4 * a7 - 2 * a1 * a5 * a7 - 2 * a2 * a6 * a7 - a3 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[4] = (a0 * a0 * a4 + 2 * a0 * a1 * a5 + 2 * a0 * a2 * a6 + 2 * a0 * a3 * a7 - a1 * a1 * a4 - a2 * a2 * a4 - a4 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[5] = (2 * a0 * a1 * a4 + a1 * a1 * a5 + 2 * a1 * a2 * a6 + 2 * a1 * a3 * a7 - a0 * a0 * a5 - a2 * a2 * a5 - a5 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[6] = (2 * a0 * a2 * a4 + 2 * a1 * a2 * a5 + a2 * a2 * a6 + 2 * a2 * a3 * a7 - a0 * a0 * a6 - a1 * a1 * a6 - a6 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    res.d[7] = (-a0 * a0 * a7 - a1 * a1 * a7 - a2 * a2 * a7 - a7 * a7 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a7 * a7 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a7 * a7 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a7 * a7 + a7 * a7 * a7 * a7);
+    return res;
+}
@@ -0,0 +1,169 @@
+// Written by GAmphetamine.js
+// Inverse, points, directions and motors only
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of scalar
+// a
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t inverse(const scalar_t& a) {
+
+    return (1) / (a);
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of vector
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t inverse(const vector_t& a) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = (a0) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[1] = (a1) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[2] = (a2) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[3] = (a3) / (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of bivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 180 muls / 51 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t inverse(const bivector_t& a) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5];
+    res.d[0] = (-a0 * a0 * a0 - a0 * a1 * a1 - a0 * a2 * a2) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    res.d[1] = (-a0 * a0 * a1 - a1 * a1 * a1 - a1 * a2 * a2) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    res.d[2] = (-a0 * a0 * a2 - a1 * a1 * a2 - a2 * a2 * a2) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    res.d[3] = (a0 * a0 * a3 + 2 * a0 * a1 * a4 + 2 * a0 * a2 * a5 - a1 * a1 * a3 - a2 * a2 * a3) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    res.d[4] = (2 * a0 * a1 * a3 + a1 * a1 * a4 + 2 * a1 * a2 * a5 - a0 * a0 * a4 - a2 * a2 * a4) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    res.d[5] = (2 * a0 * a2 * a3 + 2 * a1 * a2 * a4 + a2 * a2 * a5 - a0 * a0 * a5 - a1 * a1 * a5) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + a2 * a2 * a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of point
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t inverse(const point_t& a) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of direction
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t inverse(const direction_t& a) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of ebivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 9 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t inverse(const ebivector_t& a) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = (-a0) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[1] = (-a1) / (a0 * a0 + a1 * a1 + a2 * a2);
+    res.d[2] = (-a2) / (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of ibivector
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t inverse(const ibivector_t& a) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of rotation
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 16 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t inverse(const rotation_t& a) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = (a0) / (a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+    res.d[1] = (-a1) / (a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+    res.d[2] = (-a2) / (a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+    res.d[3] = (-a3) / (a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of translation
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t inverse(const translation_t& a) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// inverse of even
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 388 muls / 111 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t inverse(const even_t& a) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = (a0 * a0 * a0 + a0 * a1 * a1 + a0 * a2 * a2 + a0 * a3 * a3) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[1] = (-a0 * a0 * a1 - a1 * a1 * a1 - a1 * a2 * a2 - a1 * a3 * a3) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[2] = (-a0 * a0 * a2 - a1 * a1 * a2 - a2 * a2 * a2 - a2 * a3 * a3) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[3] = (-a0 * a0 * a3 - a1 * a1 * a3 - a2 * a2 * a3 - a3 * a3 * a3) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[4] = (a1 * a1 * a4 + 2 * a1 * a2 * a5 + 2 * a1 * a3 * a6 - a0 * a0 * a4 - 2 * a0 * a1 * a7 - a2 * a2 * a4 - a3 * a3 * a4) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[5] = (2 * a1 * a2 * a4 + a2 * a2 * a5 + 2 * a2 * a3 * a6 - a0 * a0 * a5 - 2 * a0 * a2 * a7 - a1 * a1 * a5 - a3 * a3 * a5) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[6] = (2 * a1 * a3 * a4 + 2 * a2 * a3 * a5 + a3 * a3 * a6 - a0 * a0 * a6 - 2 * a0 * a3 * a7 - a1 * a1 * a6 - a2 * a2 * a6) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    res.d[7] = (2 * a0 * a1 * a4 + 2 * a0 * a2 * a5 + 2 * a0 * a3 * a6 + a1 * a1 * a7 + a2 * a2 * a7 + a3 * a3 * a7 - a0 * a0 * a7) / (a0 * a0 * a0 * a0 + 2 * a0 * a0 * a1 * a1 + 2 * a0 * a0 * a2 * a2 + 2 * a0 * a0 * a3 * a3 + a1 * a1 * a1 * a1 + 2 * a1 * a1 * a2 * a2 + 2 * a1 * a1 * a3 * a3 + a2 * a2 * a2 * a2 + 2 * a2 * a2 * a3 * a3 + a3 * a3 * a3 * a3);
+    return res;
+}
@@ -0,0 +1,4710 @@
+// Written by GAmphetamine.js
+// Left contraction
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and scalar  
+// a
+// b
+// -> r
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const scalar_t& a, const scalar_t& b) {
+
+    return a * b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and vector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const scalar_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and bivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const scalar_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and trivector  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t lip(const scalar_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and quadvector  
+// a
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t lip(const scalar_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = a * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and horizon  
+// a
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const scalar_t& a, const horizon_t& b) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and origin  
+// a
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t lip(const scalar_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and point  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t lip(const scalar_t& a, const point_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and direction  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t lip(const scalar_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and ebivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t lip(const scalar_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and ibivector  
+// a
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const scalar_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and evector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const scalar_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and dpoint  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const scalar_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and rotation  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const scalar_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and translation  
+// a
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const scalar_t& a, const translation_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a * b0;
+    res.d[5] = a * b1;
+    res.d[6] = a * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and even  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const scalar_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    res.d[6] = a * b6;
+    res.d[7] = a * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between scalar and odd  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const scalar_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * b0;
+    res.d[1] = a * b1;
+    res.d[2] = a * b2;
+    res.d[3] = a * b3;
+    res.d[4] = a * b4;
+    res.d[5] = a * b5;
+    res.d[6] = a * b6;
+    res.d[7] = a * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const vector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const vector_t& a, const vector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const vector_t& a, const bivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const vector_t& a, const trivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b3;
+    res.d[1] = a1 * b3;
+    res.d[2] = a2 * b3;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t lip(const vector_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const vector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t lip(const vector_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const vector_t& a, const point_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const vector_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const vector_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const vector_t& a, const ibivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const vector_t& a, const evector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const vector_t& a, const dpoint_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const vector_t& a, const rotation_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const vector_t& a, const translation_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const vector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    res.d[3] = -a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7;
+    res.d[5] = a1 * b7;
+    res.d[6] = a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between vector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const vector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7;
+    res.d[2] = a1 * b7;
+    res.d[3] = a2 * b7;
+    res.d[4] = a2 * b5 - a1 * b6;
+    res.d[5] = a0 * b6 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const bivector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return -a0 * b0 - a1 * b1 - a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const bivector_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b3;
+    res.d[1] = -a1 * b3;
+    res.d[2] = -a2 * b3;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const bivector_t& a, const quadvector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a1 * b0;
+    res.d[2] = -a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const bivector_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const bivector_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const bivector_t& a, const direction_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const ebivector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return -a0 * b0 - a1 * b1 - a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const rotation_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    return -a0 * b1 - a1 * b2 - a2 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const bivector_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const bivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b7 = b.d[7];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a0 * b7;
+    res.d[5] = -a1 * b7;
+    res.d[6] = -a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between bivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const bivector_t& a, const odd_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a0 * b7;
+    res.d[1] = -a1 * b7;
+    res.d[2] = -a2 * b7;
+    res.d[3] = a0 * b4 + a1 * b5 + a2 * b6;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 1 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const trivector_t& b) {
+
+    const float a3 = a.d[3], b3 = b.d[3];
+    return -a3 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const trivector_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a3 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const origin_t& b) {
+
+    const float a3 = a.d[3];
+    return -a3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const point_t& b) {
+
+    const float a3 = a.d[3];
+    return -a3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const trivector_t& a, const even_t& b) {
+    vector_t res;
+    const float a3 = a.d[3], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a3 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between trivector and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 1 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const trivector_t& a, const odd_t& b) {
+
+    const float a3 = a.d[3], b7 = b.d[7];
+    return -a3 * b7;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and scalar  
+// a0 e₀₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and vector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and bivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and trivector  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and quadvector  
+// a0 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and horizon  
+// a0 e₀₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and origin  
+// a0 e₀₁₂₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and point  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and direction  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and ebivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and ibivector  
+// a0 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and evector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and dpoint  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and rotation  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and translation  
+// a0 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and even  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const even_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between quadvector and odd  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const quadvector_t& a, const odd_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and scalar  
+// 1 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and vector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and bivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and trivector  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and quadvector  
+// 1 e₀
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and horizon  
+// 1 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and origin  
+// 1 e₀
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and point  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and direction  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and ebivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and ibivector  
+// 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and evector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and dpoint  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and rotation  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and translation  
+// 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and even  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const even_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between horizon and odd  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const horizon_t& a, const odd_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and scalar  
+// 1 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and vector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and bivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and trivector  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const trivector_t& b) {
+
+    const float b3 = b.d[3];
+    return -b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and quadvector  
+// 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const origin_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and horizon  
+// 1 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and origin  
+// 1 e₁₂₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const origin_t& b) {
+
+    return -1;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and point  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const point_t& b) {
+
+    return -1;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and direction  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and ebivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and ibivector  
+// 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and evector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and dpoint  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and rotation  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and translation  
+// 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and even  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const origin_t& a, const even_t& b) {
+    vector_t res;
+    const float b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between origin and odd  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const origin_t& a, const odd_t& b) {
+
+    const float b7 = b.d[7];
+    return -b7;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const trivector_t& b) {
+
+    const float b3 = b.d[3];
+    return -b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const point_t& a, const quadvector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const origin_t& b) {
+
+    return -1;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const point_t& b) {
+
+    return -1;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const point_t& a, const even_t& b) {
+    vector_t res;
+    const float b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between point and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const point_t& a, const odd_t& b) {
+
+    const float b7 = b.d[7];
+    return -b7;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const even_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between direction and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const direction_t& a, const odd_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const bivector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return -a0 * b0 - a1 * b1 - a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const ebivector_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a0 * b3;
+    res.d[1] = -a1 * b3;
+    res.d[2] = -a2 * b3;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁₂₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const ebivector_t& a, const quadvector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = -a0 * b0;
+    res.d[1] = -a1 * b0;
+    res.d[2] = -a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const ebivector_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const ebivector_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a0;
+    res.d[1] = -a1;
+    res.d[2] = -a2;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const ebivector_t& a, const direction_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0 * b0 + a1 * b1 + a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const ebivector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return -a0 * b0 - a1 * b1 - a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const rotation_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    return -a0 * b1 - a1 * b2 - a2 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ebivector_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const ebivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b7 = b.d[7];
+    res.d[0] = -a0 * b1 - a1 * b2 - a2 * b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a0 * b7;
+    res.d[5] = -a1 * b7;
+    res.d[6] = -a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ebivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const ebivector_t& a, const odd_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -a0 * b7;
+    res.d[1] = -a1 * b7;
+    res.d[2] = -a2 * b7;
+    res.d[3] = a0 * b4 + a1 * b5 + a2 * b6;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and scalar  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and vector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and bivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and trivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and quadvector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and horizon  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and origin  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and point  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and direction  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and ebivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and ibivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and evector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and dpoint  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and rotation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const rotation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and translation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const translation_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and even  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const even_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between ibivector and odd  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const ibivector_t& a, const odd_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const evector_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const evector_t& a, const vector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const evector_t& a, const bivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const evector_t& a, const trivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b3;
+    res.d[1] = a1 * b3;
+    res.d[2] = a2 * b3;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t lip(const evector_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const evector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t lip(const evector_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and point  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const evector_t& a, const point_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const evector_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const evector_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const evector_t& a, const ibivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const evector_t& a, const evector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const evector_t& a, const dpoint_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const evector_t& a, const rotation_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const evector_t& a, const translation_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and even  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const evector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    res.d[3] = -a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7;
+    res.d[5] = a1 * b7;
+    res.d[6] = a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between evector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const evector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7;
+    res.d[2] = a1 * b7;
+    res.d[3] = a2 * b7;
+    res.d[4] = a2 * b5 - a1 * b6;
+    res.d[5] = a0 * b6 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const dpoint_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const dpoint_t& a, const vector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const dpoint_t& a, const bivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const dpoint_t& a, const trivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b3;
+    res.d[1] = a1 * b3;
+    res.d[2] = a2 * b3;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t lip(const dpoint_t& a, const quadvector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = a0 * b0;
+    res.d[1] = a1 * b0;
+    res.d[2] = a2 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const dpoint_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t lip(const dpoint_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const dpoint_t& a, const point_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const dpoint_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const dpoint_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const dpoint_t& a, const ibivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const dpoint_t& a, const evector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const dpoint_t& a, const dpoint_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const dpoint_t& a, const rotation_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const dpoint_t& a, const translation_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const dpoint_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    res.d[3] = -a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7;
+    res.d[5] = a1 * b7;
+    res.d[6] = a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between dpoint and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const dpoint_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2;
+    res.d[1] = a0 * b7;
+    res.d[2] = a1 * b7;
+    res.d[3] = a2 * b7;
+    res.d[4] = a2 * b5 - a1 * b6;
+    res.d[5] = a0 * b6 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b
+// -> r
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const rotation_t& a, const scalar_t& b) {
+
+    const float a0 = a.d[0];
+    return a0 * b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const rotation_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const rotation_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0;
+    res.d[2] = a0 * b1;
+    res.d[3] = a0 * b2;
+    res.d[4] = a0 * b3;
+    res.d[5] = a0 * b4;
+    res.d[6] = a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 10 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const rotation_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a1 * b3;
+    res.d[1] = -a2 * b3;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const rotation_t& a, const quadvector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a1 * b0;
+    res.d[5] = -a2 * b0;
+    res.d[6] = -a3 * b0;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const rotation_t& a, const horizon_t& b) {
+    vector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const rotation_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const rotation_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const rotation_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const rotation_t& a, const ebivector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0;
+    res.d[2] = a0 * b1;
+    res.d[3] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const rotation_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const rotation_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const rotation_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 7 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const rotation_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 14 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const rotation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    res.d[4] = a0 * b4 - a1 * b7;
+    res.d[5] = a0 * b5 - a2 * b7;
+    res.d[6] = a0 * b6 - a3 * b7;
+    res.d[7] = a0 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between rotation and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 14 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const rotation_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b7;
+    res.d[1] = a0 * b1 - a2 * b7;
+    res.d[2] = a0 * b2 - a3 * b7;
+    res.d[3] = a0 * b3 + a1 * b4 + a2 * b5 + a3 * b6;
+    res.d[4] = a0 * b4;
+    res.d[5] = a0 * b5;
+    res.d[6] = a0 * b6;
+    res.d[7] = a0 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and scalar  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const translation_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and vector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const translation_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and bivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t lip(const translation_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and trivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t lip(const translation_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and quadvector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t lip(const translation_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t lip(const translation_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t lip(const translation_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and point  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t lip(const translation_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and direction  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t lip(const translation_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and ebivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t lip(const translation_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and ibivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const translation_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and evector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const translation_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and dpoint  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t lip(const translation_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and rotation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const translation_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and translation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t lip(const translation_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and even  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const translation_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between translation and odd  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const translation_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b
+// -> r
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const even_t& a, const scalar_t& b) {
+
+    const float a0 = a.d[0];
+    return a0 * b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const even_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const even_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0;
+    res.d[2] = a0 * b1;
+    res.d[3] = a0 * b2;
+    res.d[4] = a0 * b3;
+    res.d[5] = a0 * b4;
+    res.d[6] = a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 10 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const even_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a1 * b3;
+    res.d[1] = -a2 * b3;
+    res.d[2] = -a3 * b3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const even_t& a, const quadvector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -a1 * b0;
+    res.d[5] = -a2 * b0;
+    res.d[6] = -a3 * b0;
+    res.d[7] = a0 * b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const even_t& a, const horizon_t& b) {
+    vector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const even_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const even_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1;
+    res.d[1] = -a2;
+    res.d[2] = -a3;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const even_t& a, const direction_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a1 * b0 + a2 * b1 + a3 * b2;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const even_t& a, const ebivector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a1 * b0 - a2 * b1 - a3 * b2;
+    res.d[1] = a0 * b0;
+    res.d[2] = a0 * b1;
+    res.d[3] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const even_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const even_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const even_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * b0;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 7 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const even_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const even_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0 * b0;
+    res.d[5] = a0 * b1;
+    res.d[6] = a0 * b2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 14 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const even_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b1 - a2 * b2 - a3 * b3;
+    res.d[1] = a0 * b1;
+    res.d[2] = a0 * b2;
+    res.d[3] = a0 * b3;
+    res.d[4] = a0 * b4 - a1 * b7;
+    res.d[5] = a0 * b5 - a2 * b7;
+    res.d[6] = a0 * b6 - a3 * b7;
+    res.d[7] = a0 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between even and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 14 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const even_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 - a1 * b7;
+    res.d[1] = a0 * b1 - a2 * b7;
+    res.d[2] = a0 * b2 - a3 * b7;
+    res.d[3] = a0 * b3 + a1 * b4 + a2 * b5 + a3 * b6;
+    res.d[4] = a0 * b4;
+    res.d[5] = a0 * b5;
+    res.d[6] = a0 * b6;
+    res.d[7] = a0 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const odd_t& a, const scalar_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const odd_t& a, const vector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const odd_t& a, const bivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    res.d[3] = -a0 * b3 - a1 * b4 - a2 * b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 10 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const odd_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -a7 * b3;
+    res.d[1] = a0 * b3;
+    res.d[2] = a1 * b3;
+    res.d[3] = a2 * b3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const odd_t& a, const quadvector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a7 * b0;
+    res.d[4] = a0 * b0;
+    res.d[5] = a1 * b0;
+    res.d[6] = a2 * b0;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const odd_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t lip(const odd_t& a, const origin_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7];
+    res.d[0] = -a7;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const odd_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -a7;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t lip(const odd_t& a, const direction_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const odd_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a2 * b1 - a1 * b2;
+    res.d[1] = a0 * b2 - a2 * b0;
+    res.d[2] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const odd_t& a, const ibivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const odd_t& a, const evector_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t lip(const odd_t& a, const dpoint_t& b) {
+
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a0 * b0 + a1 * b1 + a2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t lip(const odd_t& a, const rotation_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t lip(const odd_t& a, const translation_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 13 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t lip(const odd_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a2 * b2 - a1 * b3;
+    res.d[1] = a0 * b3 - a2 * b1;
+    res.d[2] = a1 * b1 - a0 * b2;
+    res.d[3] = a7 * b7 - a0 * b4 - a1 * b5 - a2 * b6;
+    res.d[4] = a0 * b7;
+    res.d[5] = a1 * b7;
+    res.d[6] = a2 * b7;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// lip between odd and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 13 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t lip(const odd_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a0 * b0 + a1 * b1 + a2 * b2 - a7 * b7;
+    res.d[1] = a0 * b7;
+    res.d[2] = a1 * b7;
+    res.d[3] = a2 * b7;
+    res.d[4] = a2 * b5 - a1 * b6;
+    res.d[5] = a0 * b6 - a2 * b4;
+    res.d[6] = a1 * b4 - a0 * b5;
+    res.d[7] = 0.0;
+    return res;
+}
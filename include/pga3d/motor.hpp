@@ -0,0 +1,251 @@
+// Motor helpers for pga3d, hand written on top of the generated operators.
+// A motor m is unit when m * ~m = 1, for those the reverse is the inverse and the
+// sandwich operators (>>) are exact, normalize after accumulating products.
+
+#pragma once
+
+#include "core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// norm of even, sqrt of the scalar part of a * ~a
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////
+
+CONSTEXPR inline float norm_sq(const even_t& a) {
+    return a.d[0] * a.d[0] + a.d[1] * a.d[1] + a.d[2] * a.d[2] + a.d[3] * a.d[3];
+}
+
+inline float norm(const even_t& a) {
+    return std::sqrt(norm_sq(a));
+}
+
+CONSTEXPR inline float norm_sq(const rotation_t& a) {
+    return a.d[0] * a.d[0] + a.d[1] * a.d[1] + a.d[2] * a.d[2] + a.d[3] * a.d[3];
+}
+
+inline float norm(const rotation_t& a) {
+    return std::sqrt(norm_sq(a));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// unit inverse, the reverse of a unit motor
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////
+
+CONSTEXPR inline rotation_t unit_inverse(const rotation_t& a) {
+    return ~a;
+}
+
+CONSTEXPR inline translation_t unit_inverse(const translation_t& a) {
+    return ~a;
+}
+
+CONSTEXPR inline even_t unit_inverse(const even_t& a) {
+    return ~a;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// motor inverse, same result as the generated inverse(even_t) for any motor.
+// a * ~a = n + q e0123 and (n + q e0123)^-1 = x + y e0123, the denominator is shared by every blade
+// 24 muls / 10 adds / 1 div
+////////////////////////////////////////////////////////////////////////////////
+
+CONSTEXPR inline even_t motor_inverse(const even_t& a) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7],
+        x = 1.0f / (a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3),
+        y = 2.0f * (a1 * a4 + a2 * a5 + a3 * a6 - a0 * a7) * x * x;
+    res.d[0] = a0 * x;
+    res.d[1] = -a1 * x;
+    res.d[2] = -a2 * x;
+    res.d[3] = -a3 * x;
+    res.d[4] = a1 * y - a4 * x;
+    res.d[5] = a2 * y - a5 * x;
+    res.d[6] = a3 * y - a6 * x;
+    res.d[7] = a0 * y + a7 * x;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// normalized rotation
+// 4 muls / 3 adds / 1 sqrt
+////////////////////////////////////////////////////////////////////////////////
+
+inline rotation_t normalized(const rotation_t& a) {
+    rotation_t res;
+    const float x = 1.0f / norm(a);
+    res.d[0] = a.d[0] * x;
+    res.d[1] = a.d[1] * x;
+    res.d[2] = a.d[2] * x;
+    res.d[3] = a.d[3] * x;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// normalized even, a * (n + q e0123)^-1/2 with a * ~a = n + q e0123
+// also restores the a0 a7 = a1 a4 + a2 a5 + a3 a6 constraint drifted motors lose
+// 19 muls / 7 adds / 1 sqrt
+////////////////////////////////////////////////////////////////////////////////
+
+inline even_t normalized(const even_t& a) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7],
+        x = 1.0f / std::sqrt(a0 * a0 + a1 * a1 + a2 * a2 + a3 * a3),
+        y = (a1 * a4 + a2 * a5 + a3 * a6 - a0 * a7) * x * x * x;
+    res.d[0] = a0 * x;
+    res.d[1] = a1 * x;
+    res.d[2] = a2 * x;
+    res.d[3] = a3 * x;
+    res.d[4] = a4 * x - a1 * y;
+    res.d[5] = a5 * x - a2 * y;
+    res.d[6] = a6 * x - a3 * y;
+    res.d[7] = a7 * x + a0 * y;
+    return res;
+}
+
+// True when a * ~a is within eps of 1, for asserting the unit_inverse precondition
+inline bool is_unit(const even_t& a, float eps = 1e-4f) {
+    const float q = a.d[0] * a.d[7] - a.d[1] * a.d[4] - a.d[2] * a.d[5] - a.d[3] * a.d[6];
+    return std::fabs(norm_sq(a) - 1.0f) <= eps && std::fabs(q + q) <= eps;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// exp of bivector, B = [e23,e31,e12 | e01,e02,e03] is half the screw (angle / 2
+// about the line, distance / 2 along it), the result is a unit motor
+////////////////////////////////////////////////////////////////////////////////
+
+inline rotation_t exp(const ebivector_t& a) {
+    rotation_t res;
+    const float l = a.d[0] * a.d[0] + a.d[1] * a.d[1] + a.d[2] * a.d[2];
+    const float n = std::sqrt(l), s = n > 1e-6f ? std::sin(n) / n : 1.0f - l / 6.0f;
+    res.d[0] = std::cos(n);
+    res.d[1] = a.d[0] * s;
+    res.d[2] = a.d[1] * s;
+    res.d[3] = a.d[2] * s;
+    return res;
+}
+
+CONSTEXPR inline translation_t exp(const ibivector_t& a) {
+    translation_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+inline even_t exp(const bivector_t& a) {
+    even_t res;
+    const float b0 = a.d[0], b1 = a.d[1], b2 = a.d[2], b3 = a.d[3], b4 = a.d[4], b5 = a.d[5],
+        l = b0 * b0 + b1 * b1 + b2 * b2, m = b0 * b3 + b1 * b4 + b2 * b5, n = std::sqrt(l), c = std::cos(n);
+    // s = sin(n) / n, t = m (c - s) / l, both fall back to their series near the pure translation
+    float s, t;
+    if (n > 1e-3f) {
+        s = std::sin(n) / n;
+        t = m * (c - s) / l;
+    } else {
+        s = 1.0f - l / 6.0f;
+        t = -m * (1.0f / 3.0f - l / 30.0f);
+    }
+    res.d[0] = c;
+    res.d[1] = b0 * s;
+    res.d[2] = b1 * s;
+    res.d[3] = b2 * s;
+    res.d[4] = b3 * s + b0 * t;
+    res.d[5] = b4 * s + b1 * t;
+    res.d[6] = b5 * s + b2 * t;
+    res.d[7] = m * s;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// log of unit motor, inverse of exp, picks the short way round (a0 >= 0)
+////////////////////////////////////////////////////////////////////////////////
+
+inline ebivector_t log(const rotation_t& a) {
+    ebivector_t res;
+    const float sign = a.d[0] < 0.0f ? -1.0f : 1.0f;
+    const float s = std::sqrt(a.d[1] * a.d[1] + a.d[2] * a.d[2] + a.d[3] * a.d[3]);
+    const float b = s > 1e-6f ? std::atan2(s, sign * a.d[0]) / s : 1.0f;
+    res.d[0] = sign * b * a.d[1];
+    res.d[1] = sign * b * a.d[2];
+    res.d[2] = sign * b * a.d[3];
+    return res;
+}
+
+CONSTEXPR inline ibivector_t log(const translation_t& a) {
+    ibivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+inline bivector_t log(const even_t& a) {
+    bivector_t res;
+    const float sign = a.d[0] < 0.0f ? -1.0f : 1.0f;
+    const float a0 = sign * a.d[0], a1 = sign * a.d[1], a2 = sign * a.d[2], a3 = sign * a.d[3],
+        a4 = sign * a.d[4], a5 = sign * a.d[5], a6 = sign * a.d[6], a7 = sign * a.d[7],
+        l = a1 * a1 + a2 * a2 + a3 * a3, s = std::sqrt(l);
+    // b = angle / sin(angle), c undoes the e0123 coupling exp adds to the translation
+    float b, c;
+    if (s > 1e-3f) {
+        b = std::atan2(s, a0) / s;
+        c = a7 * (1.0f - a0 * b) / l;
+    } else {
+        b = 1.0f + l / 6.0f;
+        c = a7 / 3.0f;
+    }
+    res.d[0] = b * a1;
+    res.d[1] = b * a2;
+    res.d[2] = b * a3;
+    res.d[3] = b * a4 + c * a1;
+    res.d[4] = b * a5 + c * a2;
+    res.d[5] = b * a6 + c * a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sqrt of unit motor, normalized(1 + a), halves the screw
+////////////////////////////////////////////////////////////////////////////////
+
+inline rotation_t sqrt(const rotation_t& a) {
+    rotation_t res = a.d[0] < 0.0f ? -1.0f * a : a;
+    res.d[0] += 1.0f;
+    return normalized(res);
+}
+
+CONSTEXPR inline translation_t sqrt(const translation_t& a) {
+    translation_t res;
+    res.d[0] = 0.5f * a.d[0];
+    res.d[1] = 0.5f * a.d[1];
+    res.d[2] = 0.5f * a.d[2];
+    return res;
+}
+
+inline even_t sqrt(const even_t& a) {
+    even_t res = a;
+    if (a.d[0] < 0.0f) for (size_t i = 0; i < 8; ++i) res.d[i] = -res.d[i];
+    res.d[0] += 1.0f;
+    return normalized(res);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// screw linear interpolation between unit motors, a * exp(t log(~a * b)), takes the
+// shortest screw so t = 1 may return -b (the same transform)
+////////////////////////////////////////////////////////////////////////////////
+
+inline even_t sclerp(const even_t& a, const even_t& b, float t) {
+    bivector_t l = log(~a * b);
+    for (size_t i = 0; i < 6; ++i) l.d[i] *= t;
+    return a * exp(l);
+}
+
+// Batched over count motors, one weight for all
+inline void sclerp(const even_t* a, const even_t* b, float t, even_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) out[i] = sclerp(a[i], b[i], t);
+}
+
+// Batched over count motors, one weight each
+inline void sclerp(const even_t* a, const even_t* b, const float* t, even_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) out[i] = sclerp(a[i], b[i], t[i]);
+}
@@ -0,0 +1,5385 @@
+// Written by GAmphetamine.js
+// Projection
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and scalar  
+// a
+// b
+// -> r
+// 2 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const scalar_t& b) {
+
+    return a * b * b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and vector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const vector_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a * b0 * b0 + a * b1 * b1 + a * b2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and bivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const scalar_t& a, const bivector_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = a * (b0 * b0 + b1 * b1 + b2 * b2);
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (a * (b0 * b3 + b1 * b4 + b2 * b5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and trivector  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 2 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const trivector_t& b) {
+
+    const float b3 = b.d[3];
+    return a * b3 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and quadvector  
+// a
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and horizon  
+// a
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and origin  
+// a
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const origin_t& b) {
+
+    return a;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and point  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const point_t& b) {
+
+    return a;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and direction  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and ebivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const ebivector_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a * b0 * b0 + a * b1 * b1 + a * b2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and ibivector  
+// a
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and evector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const evector_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a * b0 * b0 + a * b1 * b1 + a * b2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and dpoint  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const dpoint_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return a * b0 * b0 + a * b1 * b1 + a * b2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and rotation  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r
+// 8 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const rotation_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    return a * b0 * b0 + a * b1 * b1 + a * b2 * b2 + a * b3 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and translation  
+// a
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const scalar_t& a, const translation_t& b) {
+
+    return a;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and even  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 11 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const scalar_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (a * (b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between scalar and odd  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 11 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const scalar_t& a, const odd_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = a * (b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7);
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (a * (b0 * b4 + b1 * b5 + b2 * b6 + b3 * b7));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const vector_t& a, const scalar_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 7 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const vector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 31 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const vector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, b0b3 = b0 * b3, b1b4 = b1 * b4, b2b5 = b2 * b5,
+        t0 = b0b3 + b1b4, t1 = t0 + b2b5, t2 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t2 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t2;
+    res.d[3] = a2 * (b1 * b3 - b0 * b4) + a1 * (b0 * b5 - b2 * b3) + a0 * (b2 * b4 - b1 * b5);
+    res.d[4] = -a0 * t1;
+    res.d[5] = -a1 * t1;
+    res.d[6] = -a2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const vector_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = -b3 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const vector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const vector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const vector_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const vector_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const vector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const vector_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const vector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const vector_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const vector_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 19 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const vector_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, a3b0 = a3 * b0,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = a3b0 * b0;
+    res.d[4] = a3b0 * b1;
+    res.d[5] = a3b0 * b2;
+    res.d[6] = a3b0 * b3;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const vector_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 52 muls / 38 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const vector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, a3b0 = a3 * b0, b1b4 = b1 * b4, b2b5 = b2 * b5,
+        b3b6 = b3 * b6,
+        s0 = b1b4 + b2b5 + b3b6,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = a3b0 * b0 + a2 * (b2 * b4 - b1 * b5 - b3 * b7) + a1 * (b1 * b6 - b2 * b7 - b3 * b4) + a0 * (b3 * b5 - b1 * b7 - b2 * b6);
+    res.d[4] = b0 * (a2 * b5 + a3 * b1 - a1 * b6) + a0 * (2 * b0 * b7 - b1b4 - b2b5 - b3b6);
+    res.d[5] = b0 * (a0 * b6 + 2 * a1 * b7 + a3 * b2 - a2 * b4) - a1 * s0;
+    res.d[6] = b0 * (a1 * b4 + 2 * a2 * b7 + a3 * b3 - a0 * b5) - a2 * s0;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between vector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 40 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const vector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b0b4 = b0 * b4, b1b5 = b1 * b5,
+        b2b6 = b2 * b6, b3b7 = b3 * b7,
+        s0 = a0b0 + a1b1 + a2b2,
+        t0 = b0b4 + b1b5, t1 = t0 + b2b6, t2 = t1 + b3b7;
+    res.d[0] = b7 * (a0 * b7 + a2 * b1 - a1 * b2) + b0 * s0;
+    res.d[1] = b7 * (a0 * b2 + a1 * b7 - a2 * b0) + b1 * s0;
+    res.d[2] = b7 * (a1 * b0 + a2 * b7 - a0 * b1) + b2 * s0;
+    res.d[3] = a2 * (b0 * b5 + b2 * b3 - b1 * b4 - b6 * b7) + a1 * (b1 * b3 + b2 * b4 - b0 * b6 - b5 * b7) + a0 * (b0 * b3 + b1 * b6 - b2 * b5 - b4 * b7);
+    res.d[4] = -a0 * t2;
+    res.d[5] = -a1 * t2;
+    res.d[6] = -a2 * t2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 12 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const scalar_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b,
+        a4b = a4 * b, a5b = a5 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    res.d[4] = a4b * b;
+    res.d[5] = a5b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 25 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const vector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        s0 = a1b2 - a2b1, s1 = a2b0 - a0b2, s2 = a3b0 + a4b1 + a5b2,
+        t0 = a0b1 - a1b0;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * s0 - b0 * t0;
+    res.d[2] = b0 * s1 - b1 * s0;
+    res.d[3] = b0 * s2 + b3 * s0;
+    res.d[4] = b1 * s2 + b3 * s1;
+    res.d[5] = b2 * s2 + b3 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    res.d[4] = b4 * t1;
+    res.d[5] = b5 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 15 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const trivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = b3 * (a2 * b1 - a1 * b2);
+    res.d[4] = b3 * (a0 * b2 - a2 * b0);
+    res.d[5] = b3 * (a1 * b0 - a0 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const bivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const bivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const bivector_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const point_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const bivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const bivector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const bivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 22 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const evector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        t0 = a3b0 + a4b1, t1 = t0 + a5b2, t2 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t2 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t2;
+    res.d[3] = b0 * t1;
+    res.d[4] = b1 * t1;
+    res.d[5] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 22 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const bivector_t& a, const dpoint_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        s0 = a3b0 + a4b1 + a5b2,
+        t0 = a1b2 - a2b1, t1 = a0b1 - a1b0, t2 = a0b2 - a2b0;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 - b0 * t1;
+    res.d[2] = -b1 * t0 - b0 * t2;
+    res.d[3] = t0 + b0 * s0;
+    res.d[4] = b1 * s0 - t2;
+    res.d[5] = t1 + b2 * s0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 34 muls / 20 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const bivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = 0.0;
+    res.d[1] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[2] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[3] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[4] = b0 * (a3 * b0 + a4 * b3 - a5 * b2);
+    res.d[5] = b0 * (a4 * b0 + a5 * b1 - a3 * b3);
+    res.d[6] = b0 * (a3 * b2 + a5 * b0 - a4 * b1);
+    res.d[7] = -b0 * (a3 * b1 + a4 * b2 + a5 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const bivector_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a1 * b2 + a3 - a2 * b1;
+    res.d[5] = a2 * b0 + a4 - a0 * b2;
+    res.d[6] = a0 * b1 + a5 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 55 muls / 38 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const bivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3, a1b3 = a1 * b3, a2b2 = a2 * b2,
+        a0b3 = a0 * b3, a2b1 = a2 * b1, a0b2 = a0 * b2, a1b1 = a1 * b1,
+        s0 = a0b1 + a1b2 + a2b3,
+        t0 = a1b3 - a2b2, t1 = a0b3 - a2b1, t2 = a0b2 - a1b1;
+    res.d[0] = 0.0;
+    res.d[1] = b1 * s0 + b0 * (a0 * b0 + t0);
+    res.d[2] = b2 * s0 + b0 * (a1 * b0 - t1);
+    res.d[3] = b3 * s0 + b0 * (t2 + a2 * b0);
+    res.d[4] = b4 * s0 + b0 * (a1 * b6 + a3 * b0 + a4 * b3 - 2 * a0 * b7 - a2 * b5 - a5 * b2) - b7 * t0;
+    res.d[5] = b7 * t1 + b5 * s0 + b0 * (a2 * b4 + a4 * b0 + a5 * b1 - a0 * b6 - 2 * a1 * b7 - a3 * b3);
+    res.d[6] = b6 * s0 + b0 * (a0 * b5 + a3 * b2 + a5 * b0 - a1 * b4 - 2 * a2 * b7 - a4 * b1) - b7 * t2;
+    res.d[7] = -b0 * (a0 * b4 + a1 * b5 + a2 * b6 + a3 * b1 + a4 * b2 + a5 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between bivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 51 muls / 38 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const bivector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2,
+        b7b7 = b7 * b7, b0b0 = b0 * b0, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        b1b3 = b1 * b3, b5b7 = b5 * b7, b2b3 = b2 * b3, b6b7 = b6 * b7, b0b4 = b0 * b4,
+        b1b5 = b1 * b5, b2b6 = b2 * b6, b3b7 = b3 * b7, b0b3 = b0 * b3, b4b7 = b4 * b7,
+        s0 = a3b0 + a4b1 + a5b2, s1 = b0b4 + b1b5 + b2b6 + b3b7,
+        t0 = a0b0 + a1b1, t1 = b1b1 + b7b7, t2 = b1b3 - b5b7, t3 = b2b3 - b6b7, t4 = b0b3 - b4b7;
+    res.d[0] = -b7 * (t0 + a2b2);
+    res.d[1] = a0 * (t1 + b2b2) - b0 * (a1b1 + a2b2);
+    res.d[2] = a1 * (b0b0 + b2b2 + b7b7) - b1 * (a0b0 + a2b2);
+    res.d[3] = a2 * (b0b0 + t1) - b2 * t0;
+    res.d[4] = b0 * s0 + a1 * t3 + a0 * s1 - a2 * t2;
+    res.d[5] = b1 * s0 + a2 * t4 + a1 * s1 - a0 * t3;
+    res.d[6] = b2 * s0 + a2 * s1 + a0 * t2 - a1 * t4;
+    res.d[7] = b0 * (a2 * b5 - a1 * b6 - a3 * b7) + b2 * (a1 * b4 - a0 * b5 - a5 * b7) + b1 * (a0 * b6 - a2 * b4 - a4 * b7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const scalar_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 14 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const vector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a3b3 = a3 * b3, b1b1 = b1 * b1, b2b2 = b2 * b2,
+        b0b0 = b0 * b0, a0b0 = a0 * b0,
+        t0 = a1b1 + a3b3, t1 = b1b1 + b2b2;
+    res.d[0] = a0 * t1 - b0 * (t0 + a2b2);
+    res.d[1] = a1 * (b0b0 + b2b2) - b1 * (a0b0 + a2b2 + a3b3);
+    res.d[2] = a2 * (b0b0 + b1b1) - b2 * (a0b0 + t0);
+    res.d[3] = a3 * (b0b0 + t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 23 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const trivector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        s0 = a0b0 + a1b1 + a2b2;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a3 * (b0 * b3 + b1 * b4 + b2 * b5);
+    res.d[4] = a3 * (b1 * b5 - b2 * b4) + b0 * s0;
+    res.d[5] = a3 * (b2 * b3 - b0 * b5) + b1 * s0;
+    res.d[6] = a3 * (b0 * b4 - b1 * b3) + b2 * s0;
+    res.d[7] = a3 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 5 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a3b3 = a3 * b3;
+    res.d[0] = a3b3 * b0;
+    res.d[1] = a3b3 * b1;
+    res.d[2] = a3b3 * b2;
+    res.d[3] = a3b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const trivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const trivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a3 = a.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const point_t& b) {
+    trivector_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a3 * b0;
+    res.d[1] = a3 * b1;
+    res.d[2] = a3 * b2;
+    res.d[3] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const trivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 10 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const ebivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = a3 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const trivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 18 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const evector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = b1b1 + b2b2, t1 = a1b2 - a2b1;
+    res.d[0] = a0 * t0 - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t1 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t1;
+    res.d[3] = a3 * (b0 * b0 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 13 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const dpoint_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2, b0b0 = b0 * b0,
+        a0b0 = a0 * b0,
+        t0 = a1b1 + a3, t1 = b1b1 + b2b2;
+    res.d[0] = a0 * t1 - b0 * (t0 + a2b2);
+    res.d[1] = a1 * (b0b0 + b2b2) - b1 * (a0b0 + a2b2 + a3);
+    res.d[2] = a2 * (b0b0 + b1b1) - b2 * (a0b0 + t0);
+    res.d[3] = a3 * (b0b0 + t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 23 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const rotation_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[1] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[2] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[3] = a3 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const trivector_t& a, const translation_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 - a3 * b0;
+    res.d[1] = a1 - a3 * b1;
+    res.d[2] = a2 - a3 * b2;
+    res.d[3] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 41 muls / 26 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const trivector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = a3 * (2 * b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6);
+    res.d[4] = a3 * (b2 * b6 - b3 * b5) + b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2 - a3 * b4);
+    res.d[5] = a3 * (b3 * b4 - b1 * b6) + b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3 - a3 * b5);
+    res.d[6] = a3 * (b1 * b5 - b2 * b4) + b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1 - a3 * b6);
+    res.d[7] = a3 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between trivector and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 37 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const trivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b2 = a0 * b2, a1b7 = a1 * b7, a2b0 = a2 * b0, a3b5 = a3 * b5, a0b1 = a0 * b1,
+        a1b0 = a1 * b0, a2b7 = a2 * b7, a3b6 = a3 * b6, a0b7 = a0 * b7, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a3b4 = a3 * b4,
+        t0 = a0b2 + a1b7, t1 = t0 - a2b0, t2 = t1 - a3b5, t3 = a0b1 - a1b0, t4 = t3 - a2b7, t5 = t4 + a3b6;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -a3 * (b0 * b4 + b1 * b5 + b2 * b6 + b3 * b7);
+    res.d[4] = a3 * (b4 * b7 - b0 * b3) + b2 * t2 + b1 * t5;
+    res.d[5] = a3 * (b5 * b7 - b1 * b3) + b2 * (a1b2 + a3b4 - a0b7 - a2b1) - b0 * t5;
+    res.d[6] = a3 * (b6 * b7 - b2 * b3) + b1 * (a0b7 + a2b1 - a1b2 - a3b4) - b0 * t2;
+    res.d[7] = a3 * (b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and scalar  
+// a0 e₀₁₂₃
+// b
+// -> r0 e₀₁₂₃
+// 2 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const scalar_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0],
+        a0b = a0 * b;
+    res.d[0] = a0b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and vector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₁₂₃
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const vector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and bivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₀₁₂₃
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const bivector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and trivector  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₁₂₃
+// 2 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const trivector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b3 = b.d[3],
+        a0b3 = a0 * b3;
+    res.d[0] = a0b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and quadvector  
+// a0 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const quadvector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and horizon  
+// a0 e₀₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const quadvector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and origin  
+// a0 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const origin_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and point  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const point_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and direction  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const quadvector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and ebivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₁₂₃
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const ebivector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and ibivector  
+// a0 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const quadvector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and evector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₁₂₃
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const evector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and dpoint  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₁₂₃
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const dpoint_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and rotation  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const rotation_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and translation  
+// a0 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const translation_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0];
+    res.d[0] = a0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and even  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const even_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between quadvector and odd  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t prj(const quadvector_t& a, const odd_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7];
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and scalar  
+// 1 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const horizon_t& a, const scalar_t& b) {
+    vector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and vector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const vector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and bivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and trivector  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and quadvector  
+// 1 e₀
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and horizon  
+// 1 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and origin  
+// 1 e₀
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and point  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and direction  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and ebivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and ibivector  
+// 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and evector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const evector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and dpoint  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const dpoint_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and rotation  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const horizon_t& a, const rotation_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0 * b0;
+    res.d[4] = b0 * b1;
+    res.d[5] = b0 * b2;
+    res.d[6] = b0 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and translation  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t prj(const horizon_t& a, const translation_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and even  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const horizon_t& a, const even_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0 * b0;
+    res.d[4] = b0 * b1;
+    res.d[5] = b0 * b2;
+    res.d[6] = b0 * b3;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between horizon and odd  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const horizon_t& a, const odd_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and scalar  
+// 1 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const scalar_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and vector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 6 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const vector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b0 * b3;
+    res.d[1] = -b1 * b3;
+    res.d[2] = -b2 * b3;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and bivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 12 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const origin_t& a, const bivector_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -b0 * b3 - b1 * b4 - b2 * b5;
+    res.d[4] = b1 * b5 - b2 * b4;
+    res.d[5] = b2 * b3 - b0 * b5;
+    res.d[6] = b0 * b4 - b1 * b3;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and trivector  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 * b3;
+    res.d[1] = b1 * b3;
+    res.d[2] = b2 * b3;
+    res.d[3] = b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and quadvector  
+// 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const origin_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and horizon  
+// 1 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const origin_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t prj(const origin_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and point  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t prj(const origin_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and direction  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const origin_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and ebivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const ebivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and ibivector  
+// 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const origin_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and evector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const evector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and dpoint  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const dpoint_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and rotation  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const origin_t& a, const rotation_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and translation  
+// 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t prj(const origin_t& a, const translation_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and even  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const origin_t& a, const even_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 2 * b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6;
+    res.d[4] = b2 * b6 - b0 * b4 - b3 * b5;
+    res.d[5] = b3 * b4 - b0 * b5 - b1 * b6;
+    res.d[6] = b1 * b5 - b0 * b6 - b2 * b4;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between origin and odd  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 20 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const origin_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -b0 * b4 - b1 * b5 - b2 * b6 - b3 * b7;
+    res.d[4] = b1 * b6 + b4 * b7 - b0 * b3 - b2 * b5;
+    res.d[5] = b2 * b4 + b5 * b7 - b0 * b6 - b1 * b3;
+    res.d[6] = b0 * b5 + b6 * b7 - b1 * b4 - b2 * b3;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 7 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const scalar_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, bb = b * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = bb;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const vector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2, b0b0 = b0 * b0,
+        a0b0 = a0 * b0,
+        t0 = a1b1 + b3, t1 = b1b1 + b2b2;
+    res.d[0] = a0 * t1 - b0 * (t0 + a2b2);
+    res.d[1] = a1 * (b0b0 + b2b2) - b1 * (a0b0 + a2b2 + b3);
+    res.d[2] = a2 * (b0b0 + b1b1) - b2 * (a0b0 + t0);
+    res.d[3] = b0b0 + t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const point_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        s0 = a0b0 + a1b1 + a2b2;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -b0 * b3 - b1 * b4 - b2 * b5;
+    res.d[4] = b1 * b5 + b0 * s0 - b2 * b4;
+    res.d[5] = b2 * b3 + b1 * s0 - b0 * b5;
+    res.d[6] = b0 * b4 + b2 * s0 - b1 * b3;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 * b3;
+    res.d[1] = b1 * b3;
+    res.d[2] = b2 * b3;
+    res.d[3] = b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const point_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const point_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t prj(const point_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t prj(const point_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const point_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 9 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const ebivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const point_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 17 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const evector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = b1b1 + b2b2, t1 = a1b2 - a2b1;
+    res.d[0] = a0 * t0 - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t1 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t1;
+    res.d[3] = b0 * b0 + t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 12 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const dpoint_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2, b0b0 = b0 * b0,
+        a0b0 = a0 * b0,
+        t0 = a1b1 + 1, t1 = b1b1 + b2b2;
+    res.d[0] = a0 * t1 - b0 * (t0 + a2b2);
+    res.d[1] = a1 * (b0b0 + b2b2) - b1 * (a0b0 + a2b2 + 1);
+    res.d[2] = a2 * (b0b0 + b1b1) - b2 * (a0b0 + t0);
+    res.d[3] = b0b0 + t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 22 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t prj(const point_t& a, const rotation_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[1] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[2] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[3] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t prj(const point_t& a, const translation_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0 - b0;
+    res.d[1] = a1 - b1;
+    res.d[2] = a2 - b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 33 muls / 26 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const point_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 2 * b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6;
+    res.d[4] = b2 * b6 + b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2 - b4) - b3 * b5;
+    res.d[5] = b3 * b4 + b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3 - b5) - b1 * b6;
+    res.d[6] = b1 * b5 + b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1 - b6) - b2 * b4;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between point and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 29 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const point_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b2 = a0 * b2, a1b7 = a1 * b7, a2b0 = a2 * b0, a0b1 = a0 * b1, a1b0 = a1 * b0,
+        a2b7 = a2 * b7, a0b7 = a0 * b7, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a0b2 + a1b7, t1 = t0 - a2b0, t2 = t1 - b5, t3 = a0b1 - a1b0, t4 = t3 - a2b7, t5 = t4 + b6;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -b0 * b4 - b1 * b5 - b2 * b6 - b3 * b7;
+    res.d[4] = b4 * b7 + b2 * t2 + b1 * t5 - b0 * b3;
+    res.d[5] = b5 * b7 + b2 * (a1b2 + b4 - a0b7 - a2b1) - b1 * b3 - b0 * t5;
+    res.d[6] = b6 * b7 + b1 * (a0b7 + a2b1 - a1b2 - b4) - b2 * b3 - b0 * t2;
+    res.d[7] = b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const scalar_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const vector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const bivector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and horizon  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const ebivector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const direction_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const evector_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const dpoint_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const rotation_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[1] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[2] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const translation_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const even_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[1] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[2] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between direction and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 15 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t prj(const direction_t& a, const odd_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7],
+        a0b2 = a0 * b2, a1b7 = a1 * b7, a2b0 = a2 * b0, a0b1 = a0 * b1, a1b0 = a1 * b0,
+        a2b7 = a2 * b7, a0b7 = a0 * b7, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a0b2 + a1b7, t1 = t0 - a2b0, t2 = a0b1 - a1b0, t3 = t2 - a2b7, t4 = a0b7 - a1b2, t5 = t4 + a2b1;
+    res.d[0] = b2 * t1 + b1 * t3;
+    res.d[1] = -b2 * t5 - b0 * t3;
+    res.d[2] = b1 * t5 - b0 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const ebivector_t& a, const scalar_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 19 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const ebivector_t& a, const vector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0,
+        t0 = a1b2 - a2b1, t1 = a0b1 - a1b0, t2 = a0b2 - a2b0;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 - b0 * t1;
+    res.d[2] = -b1 * t0 - b0 * t2;
+    res.d[3] = b3 * t0;
+    res.d[4] = -b3 * t2;
+    res.d[5] = b3 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const ebivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    res.d[4] = b4 * t1;
+    res.d[5] = b5 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 15 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const ebivector_t& a, const trivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = b3 * (a2 * b1 - a1 * b2);
+    res.d[4] = b3 * (a0 * b2 - a2 * b0);
+    res.d[5] = b3 * (a1 * b0 - a0 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ebivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and horizon  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ebivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const ebivector_t& a, const origin_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const ebivector_t& a, const point_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a2 * b1 - a1 * b2;
+    res.d[4] = a0 * b2 - a2 * b0;
+    res.d[5] = a1 * b0 - a0 * b1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ebivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const ebivector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ebivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const ebivector_t& a, const evector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 16 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t prj(const ebivector_t& a, const dpoint_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0,
+        s0 = a1b2 - a2b1, s1 = a2b0 - a0b2,
+        t0 = a0b1 - a1b0;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * s0 - b0 * t0;
+    res.d[2] = b0 * s1 - b1 * s0;
+    res.d[3] = a1b2 - a2b1;
+    res.d[4] = a2b0 - a0b2;
+    res.d[5] = t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t prj(const ebivector_t& a, const rotation_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3,
+        s0 = a0b1 + a1b2 + a2b3;
+    res.d[0] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[1] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[2] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ebivector_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = a0;
+    res.d[2] = a1;
+    res.d[3] = a2;
+    res.d[4] = a1 * b2 - a2 * b1;
+    res.d[5] = a2 * b0 - a0 * b2;
+    res.d[6] = a0 * b1 - a1 * b0;
+    res.d[7] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 50 muls / 32 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ebivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b1 = a0 * b1, a1b2 = a1 * b2, a2b3 = a2 * b3, b0b5 = b0 * b5, b2b7 = b2 * b7,
+        b0b6 = b0 * b6, b3b7 = b3 * b7, b0b7 = b0 * b7, b0b4 = b0 * b4, b1b7 = b1 * b7,
+        s0 = a0b1 + a1b2 + a2b3,
+        t0 = b0b5 - b2b7, t1 = b0b6 - b3b7, t2 = b0b4 - b1b7;
+    res.d[0] = 0.0;
+    res.d[1] = b1 * s0 + b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[2] = b2 * s0 + b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[3] = b3 * s0 + b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[4] = a2 * (b3 * b4 - t0) + a1 * (t1 + b2 * b4) + a0 * (b1 * b4 - 2 * b0b7);
+    res.d[5] = a2 * (t2 + b3 * b5) + a1 * (b2 * b5 - 2 * b0b7) + a0 * (b1 * b5 - t1);
+    res.d[6] = a2 * (b3 * b6 - 2 * b0b7) + a1 * (b2 * b6 - t2) + a0 * (t0 + b1 * b6);
+    res.d[7] = -b0 * (a0 * b4 + a1 * b5 + a2 * b6);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ebivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 42 muls / 30 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ebivector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2,
+        b7b7 = b7 * b7, b0b0 = b0 * b0, b1b3 = b1 * b3, b5b7 = b5 * b7, b2b3 = b2 * b3,
+        b6b7 = b6 * b7, b0b4 = b0 * b4, b1b5 = b1 * b5, b2b6 = b2 * b6, b3b7 = b3 * b7,
+        b0b3 = b0 * b3, b4b7 = b4 * b7,
+        s0 = b0b4 + b1b5 + b2b6 + b3b7,
+        t0 = a0b0 + a1b1, t1 = b1b1 + b7b7, t2 = b1b3 - b5b7, t3 = b2b3 - b6b7, t4 = b0b3 - b4b7;
+    res.d[0] = -b7 * (t0 + a2b2);
+    res.d[1] = a0 * (t1 + b2b2) - b0 * (a1b1 + a2b2);
+    res.d[2] = a1 * (b0b0 + b2b2 + b7b7) - b1 * (a0b0 + a2b2);
+    res.d[3] = a2 * (b0b0 + t1) - b2 * t0;
+    res.d[4] = a1 * t3 + a0 * s0 - a2 * t2;
+    res.d[5] = a2 * t4 + a1 * s0 - a0 * t3;
+    res.d[6] = a2 * s0 + a0 * t2 - a1 * t4;
+    res.d[7] = a2 * (b0 * b5 - b1 * b4) + a1 * (b2 * b4 - b0 * b6) + a0 * (b1 * b6 - b2 * b5);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and scalar  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t prj(const ibivector_t& a, const scalar_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and vector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t prj(const ibivector_t& a, const vector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and bivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const bivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and trivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const trivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and quadvector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and horizon  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and origin  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const origin_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and point  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const point_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and direction  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and ebivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const ebivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and ibivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const ibivector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and evector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t prj(const ibivector_t& a, const evector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and dpoint  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t prj(const ibivector_t& a, const dpoint_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and rotation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 16 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ibivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[5] = b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[6] = b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[7] = -b0 * (a0 * b1 + a1 * b2 + a2 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and translation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t prj(const ibivector_t& a, const translation_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and even  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 16 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ibivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[5] = b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[6] = b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[7] = -b0 * (a0 * b1 + a1 * b2 + a2 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between ibivector and odd  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 7 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const ibivector_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = -b7 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const evector_t& a, const scalar_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 7 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const evector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 31 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const evector_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, b0b3 = b0 * b3, b1b4 = b1 * b4, b2b5 = b2 * b5,
+        t0 = b0b3 + b1b4, t1 = t0 + b2b5, t2 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t2 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t2;
+    res.d[3] = a2 * (b1 * b3 - b0 * b4) + a1 * (b0 * b5 - b2 * b3) + a0 * (b2 * b4 - b1 * b5);
+    res.d[4] = -a0 * t1;
+    res.d[5] = -a1 * t1;
+    res.d[6] = -a2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const evector_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = -b3 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const evector_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const evector_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const evector_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and point  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const evector_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const evector_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const evector_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const evector_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const evector_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const evector_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 14 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const evector_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const evector_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = 0.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and even  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 47 muls / 34 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const evector_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, b1b4 = b1 * b4, b2b5 = b2 * b5, b3b6 = b3 * b6,
+        s0 = b1b4 + b2b5 + b3b6,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = a2 * (b2 * b4 - b1 * b5 - b3 * b7) + a1 * (b1 * b6 - b2 * b7 - b3 * b4) + a0 * (b3 * b5 - b1 * b7 - b2 * b6);
+    res.d[4] = b0 * (a2 * b5 - a1 * b6) + a0 * (2 * b0 * b7 - b1b4 - b2b5 - b3b6);
+    res.d[5] = b0 * (a0 * b6 + 2 * a1 * b7 - a2 * b4) - a1 * s0;
+    res.d[6] = b0 * (a1 * b4 + 2 * a2 * b7 - a0 * b5) - a2 * s0;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between evector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 40 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const evector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b0b4 = b0 * b4, b1b5 = b1 * b5,
+        b2b6 = b2 * b6, b3b7 = b3 * b7,
+        s0 = a0b0 + a1b1 + a2b2,
+        t0 = b0b4 + b1b5, t1 = t0 + b2b6, t2 = t1 + b3b7;
+    res.d[0] = b7 * (a0 * b7 + a2 * b1 - a1 * b2) + b0 * s0;
+    res.d[1] = b7 * (a0 * b2 + a1 * b7 - a2 * b0) + b1 * s0;
+    res.d[2] = b7 * (a1 * b0 + a2 * b7 - a0 * b1) + b2 * s0;
+    res.d[3] = a2 * (b0 * b5 + b2 * b3 - b1 * b4 - b6 * b7) + a1 * (b1 * b3 + b2 * b4 - b0 * b6 - b5 * b7) + a0 * (b0 * b3 + b1 * b6 - b2 * b5 - b4 * b7);
+    res.d[4] = -a0 * t2;
+    res.d[5] = -a1 * t2;
+    res.d[6] = -a2 * t2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 7 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const dpoint_t& a, const scalar_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        a0b = a0 * b, bb = b * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = bb;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 7 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const dpoint_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 31 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const dpoint_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, b0b3 = b0 * b3, b1b4 = b1 * b4, b2b5 = b2 * b5,
+        t0 = b0b3 + b1b4, t1 = t0 + b2b5, t2 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t2 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t2;
+    res.d[3] = a2 * (b1 * b3 - b0 * b4) + a1 * (b0 * b5 - b2 * b3) + a0 * (b2 * b4 - b1 * b5);
+    res.d[4] = -a0 * t1;
+    res.d[5] = -a1 * t1;
+    res.d[6] = -a2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const dpoint_t& a, const trivector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = -b3 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const dpoint_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const dpoint_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const dpoint_t& a, const origin_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const dpoint_t& a, const point_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const dpoint_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 16 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const dpoint_t& a, const ebivector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = a0 * (b1 * b1 + b2 * b2) - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t0 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const dpoint_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t prj(const dpoint_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 6 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t prj(const dpoint_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 17 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const dpoint_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = b0b0;
+    res.d[4] = b0 * b1;
+    res.d[5] = b0 * b2;
+    res.d[6] = b0 * b3;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const dpoint_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = 1.0;
+    res.d[4] = a2 * b1 - a1 * b2;
+    res.d[5] = a0 * b2 - a2 * b0;
+    res.d[6] = a1 * b0 - a0 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 47 muls / 38 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const dpoint_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, b1b4 = b1 * b4, b2b5 = b2 * b5, b3b6 = b3 * b6,
+        s0 = b1b4 + b2b5 + b3b6,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + b1b1 + b3b3) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = b0b0 + a2 * (b2 * b4 - b1 * b5 - b3 * b7) + a1 * (b1 * b6 - b2 * b7 - b3 * b4) + a0 * (b3 * b5 - b1 * b7 - b2 * b6);
+    res.d[4] = b0 * (a2 * b5 + b1 - a1 * b6) + a0 * (2 * b0 * b7 - b1b4 - b2b5 - b3b6);
+    res.d[5] = b0 * (a0 * b6 + 2 * a1 * b7 + b2 - a2 * b4) - a1 * s0;
+    res.d[6] = b0 * (a1 * b4 + 2 * a2 * b7 + b3 - a0 * b5) - a2 * s0;
+    res.d[7] = -b0 * (a0b1 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between dpoint and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 40 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const dpoint_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b0b4 = b0 * b4, b1b5 = b1 * b5,
+        b2b6 = b2 * b6, b3b7 = b3 * b7,
+        s0 = a0b0 + a1b1 + a2b2,
+        t0 = b0b4 + b1b5, t1 = t0 + b2b6, t2 = t1 + b3b7;
+    res.d[0] = b7 * (a0 * b7 + a2 * b1 - a1 * b2) + b0 * s0;
+    res.d[1] = b7 * (a0 * b2 + a1 * b7 - a2 * b0) + b1 * s0;
+    res.d[2] = b7 * (a1 * b0 + a2 * b7 - a0 * b1) + b2 * s0;
+    res.d[3] = a2 * (b0 * b5 + b2 * b3 - b1 * b4 - b6 * b7) + a1 * (b1 * b3 + b2 * b4 - b0 * b6 - b5 * b7) + a0 * (b0 * b3 + b1 * b6 - b2 * b5 - b4 * b7);
+    res.d[4] = -a0 * t2;
+    res.d[5] = -a1 * t2;
+    res.d[6] = -a2 * t2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 8 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t prj(const rotation_t& a, const scalar_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 21 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1, a1b1 = a1 * b1,
+        a2b0 = a2 * b0, a1b2 = a1 * b2, a3b0 = a3 * b0,
+        t0 = a2b2 - a3b1, t1 = b1b1 + b2b2, t2 = a1b1 - a2b0, t3 = a1b2 - a3b0;
+    res.d[0] = a0 * (b0 * b0 + t1);
+    res.d[1] = a1 * t1 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * t0 - b0 * t2;
+    res.d[3] = -b1 * t0 - b0 * t3;
+    res.d[4] = b3 * t0;
+    res.d[5] = -b3 * t3;
+    res.d[6] = b3 * t2;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 18 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b0 = a1 * b0, a2b1 = a2 * b1, a3b2 = a3 * b2,
+        t0 = a1b0 + a2b1, t1 = t0 + a3b2;
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    res.d[1] = b0 * t1;
+    res.d[2] = b1 * t1;
+    res.d[3] = b2 * t1;
+    res.d[4] = b3 * t1;
+    res.d[5] = b4 * t1;
+    res.d[6] = b5 * t1;
+    res.d[7] = 2.0 * (a0 * (b0 * b3 + b1 * b4 + b2 * b5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 17 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3, a3b3 = a3 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = a3b3 * b3;
+    res.d[4] = b3 * (a3 * b1 - a2 * b2);
+    res.d[5] = b3 * (a1 * b2 - a3 * b0);
+    res.d[6] = b3 * (a2 * b0 - a1 * b1);
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const rotation_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const rotation_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t prj(const rotation_t& a, const origin_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a3 * b1 - a2 * b2;
+    res.d[5] = a1 * b2 - a3 * b0;
+    res.d[6] = a2 * b0 - a1 * b1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const rotation_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 10 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t prj(const rotation_t& a, const ebivector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b0 = a1 * b0, a2b1 = a2 * b1, a3b2 = a3 * b2,
+        t0 = a1b0 + a2b1, t1 = t0 + a3b2;
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2);
+    res.d[1] = b0 * t1;
+    res.d[2] = b1 * t1;
+    res.d[3] = b2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const rotation_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 18 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t prj(const rotation_t& a, const evector_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1,
+        t0 = b1b1 + b2b2, t1 = a2b2 - a3b1;
+    res.d[0] = a0 * (b0 * b0 + t0);
+    res.d[1] = a1 * t0 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * t1 + b0 * (a2 * b0 - a1 * b1);
+    res.d[3] = b0 * (a3 * b0 - a1 * b2) - b1 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1, a1b1 = a1 * b1,
+        a2b0 = a2 * b0, a1b2 = a1 * b2, a3b0 = a3 * b0,
+        s0 = a2b2 - a3b1, s1 = a3b0 - a1b2,
+        t0 = b1b1 + b2b2, t1 = a1b1 - a2b0;
+    res.d[0] = a0 * (b0 * b0 + t0);
+    res.d[1] = a1 * t0 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * s0 - b0 * t1;
+    res.d[3] = b0 * s1 - b1 * s0;
+    res.d[4] = a2b2 - a3b1;
+    res.d[5] = a3b0 - a1b2;
+    res.d[6] = t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 23 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t prj(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a3b3 = a3 * b3,
+        s0 = a1b1 + a2b2 + a3b3;
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    res.d[1] = b1 * s0 + b0 * (a1 * b0 + a2 * b3 - a3 * b2);
+    res.d[2] = b2 * s0 + b0 * (a2 * b0 + a3 * b1 - a1 * b3);
+    res.d[3] = b3 * s0 + b0 * (a1 * b2 + a3 * b0 - a2 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a2 * b2 - a3 * b1;
+    res.d[5] = a3 * b0 - a1 * b2;
+    res.d[6] = a1 * b1 - a2 * b0;
+    res.d[7] = -a1 * b0 - a2 * b1 - a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 57 muls / 38 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a3b3 = a3 * b3, b0b5 = b0 * b5, b2b7 = b2 * b7,
+        b0b6 = b0 * b6, b3b7 = b3 * b7, b0b7 = b0 * b7, b1b4 = b1 * b4, b0b4 = b0 * b4,
+        b1b7 = b1 * b7, b2b5 = b2 * b5, b3b6 = b3 * b6,
+        s0 = a1b1 + a2b2 + a3b3,
+        t0 = b0b5 - b2b7, t1 = b0b6 - b3b7, t2 = b0b4 - b1b7;
+    res.d[0] = a0 * (b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3);
+    res.d[1] = b1 * s0 + b0 * (a1 * b0 + a2 * b3 - a3 * b2);
+    res.d[2] = b2 * s0 + b0 * (a2 * b0 + a3 * b1 - a1 * b3);
+    res.d[3] = b3 * s0 + b0 * (a1 * b2 + a3 * b0 - a2 * b1);
+    res.d[4] = a3 * (b3 * b4 - t0) + a2 * (t1 + b2 * b4) + a1 * (b1b4 - 2 * b0b7);
+    res.d[5] = a3 * (t2 + b3 * b5) + a2 * (b2b5 - 2 * b0b7) + a1 * (b1 * b5 - t1);
+    res.d[6] = a3 * (b3b6 - 2 * b0b7) + a2 * (b2 * b6 - t2) + a1 * (t0 + b1 * b6);
+    res.d[7] = 2.0 * (a0 * (b0b7 - b1b4 - b2b5 - b3b6)) - b0 * (a1 * b4 + a2 * b5 + a3 * b6);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between rotation and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 45 muls / 32 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const rotation_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b0 = a1 * b0, a2b1 = a2 * b1, a3b2 = a3 * b2, b0b0 = b0 * b0, b1b1 = b1 * b1,
+        b2b2 = b2 * b2, b7b7 = b7 * b7, b1b3 = b1 * b3, b5b7 = b5 * b7, b2b3 = b2 * b3,
+        b6b7 = b6 * b7, b0b4 = b0 * b4, b1b5 = b1 * b5, b2b6 = b2 * b6, b3b7 = b3 * b7,
+        b0b3 = b0 * b3, b4b7 = b4 * b7,
+        s0 = b0b4 + b1b5 + b2b6 + b3b7,
+        t0 = b0b0 + b7b7, t1 = a1b0 + a2b1, t2 = t0 + b1b1, t3 = b1b3 - b5b7, t4 = b2b3 - b6b7, t5 = b0b3 - b4b7;
+    res.d[0] = a0 * (t2 + b2b2) - b7 * (t1 + a3b2);
+    res.d[1] = a1 * (b1b1 + b2b2 + b7b7) - b0 * (a2b1 + a3b2);
+    res.d[2] = a2 * (t0 + b2b2) - b1 * (a1b0 + a3b2);
+    res.d[3] = a3 * t2 - b2 * t1;
+    res.d[4] = a2 * t4 + a1 * s0 - a3 * t3;
+    res.d[5] = a3 * t5 + a2 * s0 - a1 * t4;
+    res.d[6] = a3 * s0 + a1 * t3 - a2 * t5;
+    res.d[7] = a3 * (b0 * b5 - b1 * b4) + a2 * (b2 * b4 - b0 * b6) + a1 * (b1 * b6 - b2 * b5) + 2.0 * (a0 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and scalar  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 7 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2],
+        bb = b * b, a0b = a0 * b, a1b = a1 * b, a2b = a2 * b;
+    res.d[0] = bb;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a0b * b;
+    res.d[5] = a1b * b;
+    res.d[6] = a2b * b;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and vector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and bivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 7 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const bivector_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (b0 * b3 + b1 * b4 + b2 * b5);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and trivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r
+// 1 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const trivector_t& b) {
+
+    const float b3 = b.d[3];
+    return b3 * b3;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and quadvector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and horizon  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and origin  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t prj(const translation_t& a, const origin_t& b) {
+    translation_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and point  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t prj(const translation_t& a, const point_t& b) {
+    translation_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and direction  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and ebivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r
+// 3 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const ebivector_t& b) {
+
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    return b0 * b0 + b1 * b1 + b2 * b2;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and ibivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const translation_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and evector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and dpoint  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and rotation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 20 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[5] = b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[6] = b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[7] = -b0 * (a0 * b1 + a1 * b2 + a2 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and translation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t prj(const translation_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and even  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 25 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2 + b3 * b3;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * (a0 * b0 + a1 * b3 - a2 * b2);
+    res.d[5] = b0 * (a1 * b0 + a2 * b1 - a0 * b3);
+    res.d[6] = b0 * (a0 * b2 + a2 * b0 - a1 * b1);
+    res.d[7] = 2.0 * (b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6) - b0 * (a0 * b1 + a1 * b2 + a2 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between translation and odd  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 16 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const translation_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = 2.0 * (b0 * b4 + b1 * b5 + b2 * b6 + b3 * b7) - b7 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 16 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b,
+        a4b = a4 * b, a5b = a5 * b, a6b = a6 * b, a7b = a7 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    res.d[4] = a4b * b;
+    res.d[5] = a5b * b;
+    res.d[6] = a6b * b;
+    res.d[7] = a7b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 28 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const vector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        b0b0 = b0 * b0, b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1,
+        a1b1 = a1 * b1, a2b0 = a2 * b0, a1b2 = a1 * b2, a3b0 = a3 * b0, a4b0 = a4 * b0,
+        a5b1 = a5 * b1, a6b2 = a6 * b2,
+        s0 = a2b2 - a3b1, s1 = a3b0 - a1b2, s2 = a4b0 + a5b1 + a6b2,
+        t0 = b1b1 + b2b2, t1 = b0b0 + t0, t2 = a1b1 - a2b0;
+    res.d[0] = a0 * t1;
+    res.d[1] = a1 * t0 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * s0 - b0 * t2;
+    res.d[3] = b0 * s1 - b1 * s0;
+    res.d[4] = b0 * s2 + b3 * s0;
+    res.d[5] = b1 * s2 + b3 * s1;
+    res.d[6] = b2 * s2 + b3 * t2;
+    res.d[7] = a7 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 19 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const bivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        b0b0 = b0 * b0, b1b1 = b1 * b1, b2b2 = b2 * b2, a1b0 = a1 * b0, a2b1 = a2 * b1,
+        a3b2 = a3 * b2,
+        t0 = a1b0 + a2b1, t1 = t0 + a3b2, t2 = b0b0 + b1b1, t3 = t2 + b2b2;
+    res.d[0] = a0 * t3;
+    res.d[1] = b0 * t1;
+    res.d[2] = b1 * t1;
+    res.d[3] = b2 * t1;
+    res.d[4] = b3 * t1;
+    res.d[5] = b4 * t1;
+    res.d[6] = b5 * t1;
+    res.d[7] = a7 * t3 + 2.0 * (a0 * (b0 * b3 + b1 * b4 + b2 * b5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 19 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const trivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3, a3b3 = a3 * b3,
+        a7b3 = a7 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = a3b3 * b3;
+    res.d[4] = b3 * (a3 * b1 - a2 * b2);
+    res.d[5] = b3 * (a1 * b2 - a3 * b0);
+    res.d[6] = b3 * (a2 * b0 - a1 * b1);
+    res.d[7] = a7b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const even_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and horizon  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const even_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const origin_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a7 = a.d[7];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const point_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a3 * b1 - a2 * b2;
+    res.d[5] = a1 * b2 - a3 * b0;
+    res.d[6] = a2 * b0 - a1 * b1;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const even_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 11 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const ebivector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b0b0 = b0 * b0, b1b1 = b1 * b1, b2b2 = b2 * b2, a1b0 = a1 * b0, a2b1 = a2 * b1,
+        a3b2 = a3 * b2,
+        t0 = a1b0 + a2b1, t1 = t0 + a3b2, t2 = b0b0 + b1b1, t3 = t2 + b2b2;
+    res.d[0] = a0 * t3;
+    res.d[1] = b0 * t1;
+    res.d[2] = b1 * t1;
+    res.d[3] = b2 * t1;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a7 * t3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const even_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 25 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const evector_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b0b0 = b0 * b0, b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1,
+        a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        t0 = b1b1 + b2b2, t1 = a4b0 + a5b1, t2 = t1 + a6b2, t3 = b0b0 + t0, t4 = a2b2 - a3b1;
+    res.d[0] = a0 * t3;
+    res.d[1] = a1 * t0 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * t4 + b0 * (a2 * b0 - a1 * b1);
+    res.d[3] = b0 * (a3 * b0 - a1 * b2) - b1 * t4;
+    res.d[4] = b0 * t2;
+    res.d[5] = b1 * t2;
+    res.d[6] = b2 * t2;
+    res.d[7] = a7 * t3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 25 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const dpoint_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b0b0 = b0 * b0, b1b1 = b1 * b1, b2b2 = b2 * b2, a2b2 = a2 * b2, a3b1 = a3 * b1,
+        a1b1 = a1 * b1, a2b0 = a2 * b0, a1b2 = a1 * b2, a3b0 = a3 * b0, a4b0 = a4 * b0,
+        a5b1 = a5 * b1, a6b2 = a6 * b2,
+        s0 = a4b0 + a5b1 + a6b2,
+        t0 = b1b1 + b2b2, t1 = a2b2 - a3b1, t2 = b0b0 + t0, t3 = a1b1 - a2b0, t4 = a1b2 - a3b0;
+    res.d[0] = a0 * t2;
+    res.d[1] = a1 * t0 - b0 * (a2 * b1 + a3 * b2);
+    res.d[2] = b2 * t1 - b0 * t3;
+    res.d[3] = -b1 * t1 - b0 * t4;
+    res.d[4] = t1 + b0 * s0;
+    res.d[5] = b1 * s0 - t4;
+    res.d[6] = t3 + b2 * s0;
+    res.d[7] = a7 * t2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 41 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, b3b3 = b3 * b3, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        a3b3 = a3 * b3,
+        s0 = a1b1 + a2b2 + a3b3,
+        t0 = b1b1 + b2b2, t1 = t0 + b3b3;
+    res.d[0] = a0 * (b0 * b0 + t1);
+    res.d[1] = b1 * s0 + b0 * (a1 * b0 + a2 * b3 - a3 * b2);
+    res.d[2] = b2 * s0 + b0 * (a2 * b0 + a3 * b1 - a1 * b3);
+    res.d[3] = b3 * s0 + b0 * (a1 * b2 + a3 * b0 - a2 * b1);
+    res.d[4] = b0 * (a4 * b0 + a5 * b3 - a6 * b2);
+    res.d[5] = b0 * (a5 * b0 + a6 * b1 - a4 * b3);
+    res.d[6] = b0 * (a4 * b2 + a6 * b0 - a5 * b1);
+    res.d[7] = a7 * t1 + b0 * (a7 * b0 - a4 * b1 - a5 * b2 - a6 * b3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a2 * b2 + a4 - a3 * b1;
+    res.d[5] = a3 * b0 + a5 - a1 * b2;
+    res.d[6] = a1 * b1 + a6 - a2 * b0;
+    res.d[7] = a7 - a1 * b0 - a2 * b1 - a3 * b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 68 muls / 46 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, b3b3 = b3 * b3, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        a3b3 = a3 * b3, a2b3 = a2 * b3, a3b2 = a3 * b2, a1b3 = a1 * b3, a3b1 = a3 * b1,
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        s0 = a1b1 + a2b2 + a3b3,
+        t0 = b1b1 + b2b2, t1 = t0 + b3b3, t2 = a2b3 - a3b2, t3 = a1b3 - a3b1, t4 = a1b2 - a2b1;
+    res.d[0] = a0 * (b0 * b0 + t1);
+    res.d[1] = b1 * s0 + b0 * (a1 * b0 + t2);
+    res.d[2] = b2 * s0 + b0 * (a2 * b0 - t3);
+    res.d[3] = b3 * s0 + b0 * (t4 + a3 * b0);
+    res.d[4] = b4 * s0 + b0 * (a2 * b6 + a4 * b0 + a5 * b3 - 2 * a1 * b7 - a3 * b5 - a6 * b2) - b7 * t2;
+    res.d[5] = b7 * t3 + b5 * s0 + b0 * (a3 * b4 + a5 * b0 + a6 * b1 - a1 * b6 - 2 * a2 * b7 - a4 * b3);
+    res.d[6] = b6 * s0 + b0 * (a1 * b5 + a4 * b2 + a6 * b0 - a2 * b4 - 2 * a3 * b7 - a5 * b1) - b7 * t4;
+    res.d[7] = a7 * t1 + b0 * (a7 * b0 - a1 * b4 - a2 * b5 - a3 * b6 - a4 * b1 - a5 * b2 - a6 * b3) + 2.0 * (a0 * (b0 * b7 - b1 * b4 - b2 * b5 - b3 * b6));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between even and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 59 muls / 44 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t prj(const even_t& a, const odd_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b0 = a1 * b0, a2b1 = a2 * b1, a3b2 = a3 * b2, b0b0 = b0 * b0, b1b1 = b1 * b1,
+        b2b2 = b2 * b2, b7b7 = b7 * b7, a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        b1b3 = b1 * b3, b5b7 = b5 * b7, b2b3 = b2 * b3, b6b7 = b6 * b7, b0b4 = b0 * b4,
+        b1b5 = b1 * b5, b2b6 = b2 * b6, b3b7 = b3 * b7, b0b3 = b0 * b3, b4b7 = b4 * b7,
+        a7b7 = a7 * b7,
+        s0 = a4b0 + a5b1 + a6b2, s1 = b0b4 + b1b5 + b2b6 + b3b7,
+        t0 = b0b0 + b7b7, t1 = a1b0 + a2b1, t2 = t0 + b1b1, t3 = b1b3 - b5b7, t4 = b2b3 - b6b7, t5 = b0b3 - b4b7;
+    res.d[0] = a0 * (t2 + b2b2) - b7 * (t1 + a3b2);
+    res.d[1] = a1 * (b1b1 + b2b2 + b7b7) - b0 * (a2b1 + a3b2);
+    res.d[2] = a2 * (t0 + b2b2) - b1 * (a1b0 + a3b2);
+    res.d[3] = a3 * t2 - b2 * t1;
+    res.d[4] = b0 * s0 + a2 * t4 + a1 * s1 - a3 * t3;
+    res.d[5] = b1 * s0 + a3 * t5 + a2 * s1 - a1 * t4;
+    res.d[6] = b2 * s0 + a3 * s1 + a1 * t3 - a2 * t5;
+    res.d[7] = a7b7 * b7 + b0 * (a3 * b5 + a7 * b0 - a2 * b6 - a4 * b7) + b2 * (a2 * b4 + a7 * b2 - a1 * b5 - a6 * b7) + b1 * (a1 * b6 + a7 * b1 - a3 * b4 - a5 * b7) + 2.0 * (a0 * s1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 16 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const scalar_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7],
+        a0b = a0 * b, a1b = a1 * b, a2b = a2 * b, a3b = a3 * b,
+        a4b = a4 * b, a5b = a5 * b, a6b = a6 * b, a7b = a7 * b;
+    res.d[0] = a0b * b;
+    res.d[1] = a1b * b;
+    res.d[2] = a2b * b;
+    res.d[3] = a3b * b;
+    res.d[4] = a4b * b;
+    res.d[5] = a5b * b;
+    res.d[6] = a6b * b;
+    res.d[7] = a7b * b;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 21 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const vector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        a7b3 = a7 * b3, b1b1 = b1 * b1, b2b2 = b2 * b2, b0b0 = b0 * b0, a4b0 = a4 * b0,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = a5b1 + a7b3, t3 = b1b1 + b2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = b3 * t1;
+    res.d[4] = a4 * t3 - b0 * (t2 + a6b2);
+    res.d[5] = a5 * (b0b0 + b2b2) - b1 * (a4b0 + a6b2 + a7b3);
+    res.d[6] = a6 * (b0b0 + b1b1) - b2 * (a4b0 + t2);
+    res.d[7] = a7 * (b0b0 + t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 51 muls / 30 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const bivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a1b2 = a1 * b2, a2b1 = a2 * b1, a4b0 = a4 * b0,
+        a5b1 = a5 * b1, a6b2 = a6 * b2, b0b3 = b0 * b3, b1b4 = b1 * b4, b2b5 = b2 * b5,
+        s0 = a4b0 + a5b1 + a6b2, s1 = b0b3 + b1b4 + b2b5,
+        t0 = b1b1 + b2b2, t1 = a1b2 - a2b1;
+    res.d[0] = a0 * t0 - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t1 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t1;
+    res.d[3] = b0 * (a1 * b5 - a2 * b4 - a7 * b3) + b2 * (a0 * b4 - a1 * b3 - a7 * b5) + b1 * (a2 * b3 - a0 * b5 - a7 * b4);
+    res.d[4] = a7 * (b1 * b5 - b2 * b4) + b0 * s0 - a0 * s1;
+    res.d[5] = a7 * (b2 * b3 - b0 * b5) + b1 * s0 - a1 * s1;
+    res.d[6] = a7 * (b0 * b4 - b1 * b3) + b2 * s0 - a2 * s1;
+    res.d[7] = a7 * (b0 * b0 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 15 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const trivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b3 = a0 * b3, a1b3 = a1 * b3, a2b3 = a2 * b3, a7b3 = a7 * b3;
+    res.d[0] = a0b3 * b3;
+    res.d[1] = a1b3 * b3;
+    res.d[2] = a2b3 * b3;
+    res.d[3] = -b3 * (a0 * b0 + a1 * b1 + a2 * b2);
+    res.d[4] = a7b3 * b0;
+    res.d[5] = a7b3 * b1;
+    res.d[6] = a7b3 * b2;
+    res.d[7] = a7b3 * b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁₂₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const odd_t& a, const quadvector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and horizon  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₀
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const odd_t& a, const horizon_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const origin_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const point_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = -a0 * b0 - a1 * b1 - a2 * b2;
+    res.d[4] = a7 * b0;
+    res.d[5] = a7 * b1;
+    res.d[6] = a7 * b2;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const odd_t& a, const direction_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const ebivector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        b1b1 = b1 * b1, b2b2 = b2 * b2, a1b2 = a1 * b2, a2b1 = a2 * b1, a4b0 = a4 * b0,
+        a5b1 = a5 * b1, a6b2 = a6 * b2,
+        t0 = a4b0 + a5b1, t1 = t0 + a6b2, t2 = b1b1 + b2b2, t3 = a1b2 - a2b1;
+    res.d[0] = a0 * t2 - b0 * (a1 * b1 + a2 * b2);
+    res.d[1] = b2 * t3 + b0 * (a1 * b0 - a0 * b1);
+    res.d[2] = b0 * (a2 * b0 - a0 * b2) - b1 * t3;
+    res.d[3] = 0.0;
+    res.d[4] = b0 * t1;
+    res.d[5] = b1 * t1;
+    res.d[6] = b2 * t1;
+    res.d[7] = a7 * (b0 * b0 + t2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t prj(const odd_t& a, const ibivector_t& b) {
+
+    return 0.0f;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 24 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const evector_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b1b1 = b1 * b1, b2b2 = b2 * b2,
+        a5b2 = a5 * b2, a6b1 = a6 * b1,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = b1b1 + b2b2, t3 = a5b2 - a6b1;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = 0.0;
+    res.d[4] = a4 * t2 - b0 * (a5 * b1 + a6 * b2);
+    res.d[5] = b2 * t3 + b0 * (a5 * b0 - a4 * b1);
+    res.d[6] = b0 * (a6 * b0 - a4 * b2) - b1 * t3;
+    res.d[7] = a7 * (b0 * b0 + t2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 19 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const dpoint_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        b1b1 = b1 * b1, b2b2 = b2 * b2, b0b0 = b0 * b0, a4b0 = a4 * b0,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = a5b1 + a7, t3 = b1b1 + b2b2;
+    res.d[0] = b0 * t1;
+    res.d[1] = b1 * t1;
+    res.d[2] = b2 * t1;
+    res.d[3] = t1;
+    res.d[4] = a4 * t3 - b0 * (t2 + a6b2);
+    res.d[5] = a5 * (b0b0 + b2b2) - b1 * (a4b0 + a6b2 + a7);
+    res.d[6] = a6 * (b0b0 + b1b1) - b2 * (a4b0 + t2);
+    res.d[7] = a7 * (b0b0 + t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 39 muls / 29 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const rotation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        a6b3 = a6 * b3,
+        s0 = a4b1 + a5b2 + a6b3,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2, t2 = b1b1 + b3b3;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + t2) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = a3b0 * b0;
+    res.d[4] = b1 * s0 + b0 * (a3 * b1 + a4 * b0 + a5 * b3 - a6 * b2);
+    res.d[5] = b2 * s0 + b0 * (a3 * b2 + a5 * b0 + a6 * b1 - a4 * b3);
+    res.d[6] = b3 * s0 + b0 * (a3 * b3 + a4 * b2 + a6 * b0 - a5 * b1);
+    res.d[7] = a7 * (t2 + b2b2) + b0 * (a7 * b0 - a0b1 - t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 9 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const translation_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = a0;
+    res.d[1] = a1;
+    res.d[2] = a2;
+    res.d[3] = a3;
+    res.d[4] = a2 * b1 + a4 - a1 * b2 - a7 * b0;
+    res.d[5] = a0 * b2 + a5 - a2 * b0 - a7 * b1;
+    res.d[6] = a1 * b0 + a6 - a0 * b1 - a7 * b2;
+    res.d[7] = a7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 75 muls / 64 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const even_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a2b3 = a2 * b3, b0b0 = b0 * b0, b2b2 = b2 * b2, b3b3 = b3 * b3,
+        b1b1 = b1 * b1, a0b1 = a0 * b1, a0b5 = a0 * b5, a1b4 = a1 * b4, a2b7 = a2 * b7,
+        a7b6 = a7 * b6, a0b6 = a0 * b6, a1b7 = a1 * b7, a2b4 = a2 * b4, a7b5 = a7 * b5,
+        a1b6 = a1 * b6, a2b5 = a2 * b5, a7b4 = a7 * b4, a4b1 = a4 * b1, a5b2 = a5 * b2,
+        a6b3 = a6 * b3, b1b4 = b1 * b4, b2b5 = b2 * b5, b3b6 = b3 * b6,
+        s0 = a4b1 + a5b2 + a6b3, s1 = b1b4 + b2b5 + b3b6,
+        t0 = a1b2 + a2b3, t1 = b0b0 + b2b2, t2 = b1b1 + b3b3, t3 = a0b5 - a1b4, t4 = a0b6 - a2b4, t5 = a1b6 - a2b5;
+    res.d[0] = a0 * (t1 + b3b3) - b1 * t0;
+    res.d[1] = a1 * (b0b0 + t2) - b2 * (a0b1 + a2b3);
+    res.d[2] = a2 * (t1 + b1b1) - b3 * (a0b1 + a1b2);
+    res.d[3] = b0 * (a3 * b0 + 2 * a7 * b7) + b3 * (t3 - a2b7 - a7b6) + b1 * (t5 - a0 * b7 - a7b4) - b2 * (t4 + a1b7 + a7b5);
+    res.d[4] = a7 * (b2 * b6 - b3 * b5) + b1 * s0 + b0 * (a3 * b1 + a4 * b0 + a5 * b3 - t5 - a6 * b2 - a7b4) + a0 * (2 * b0 * b7 - b1b4 - b2b5 - b3b6);
+    res.d[5] = a7 * (b3 * b4 - b1 * b6) + b2 * s0 + b0 * (t4 + 2 * a1b7 + a3 * b2 + a5 * b0 + a6 * b1 - a4 * b3 - a7b5) - a1 * s1;
+    res.d[6] = a7 * (b1 * b5 - b2 * b4) + b3 * s0 + b0 * (2 * a2b7 + a3 * b3 + a4 * b2 + a6 * b0 - t3 - a5 * b1 - a7b6) - a2 * s1;
+    res.d[7] = a7 * (t2 + b2b2) + b0 * (a7 * b0 - a0b1 - t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// prj between odd and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 67 muls / 53 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t prj(const odd_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, b0b4 = b0 * b4, b1b5 = b1 * b5,
+        b2b6 = b2 * b6, b3b7 = b3 * b7, b2b3 = b2 * b3, b6b7 = b6 * b7, b1b3 = b1 * b3,
+        b5b7 = b5 * b7, b0b3 = b0 * b3, b4b7 = b4 * b7, a4b2 = a4 * b2, a5b7 = a5 * b7,
+        a6b0 = a6 * b0, a7b5 = a7 * b5, a4b1 = a4 * b1, a5b0 = a5 * b0, a6b7 = a6 * b7,
+        a7b6 = a7 * b6, a4b7 = a4 * b7, a5b2 = a5 * b2, a6b1 = a6 * b1, a7b4 = a7 * b4,
+        s0 = a0b0 + a1b1 + a2b2, s1 = b0b4 + b1b5 + b2b6 + b3b7,
+        t0 = b2b3 - b6b7, t1 = b1b3 - b5b7, t2 = b0b3 - b4b7, t3 = a4b2 + a5b7, t4 = t3 - a6b0, t5 = t4 - a7b5;
+    res.d[0] = b7 * (a0 * b7 + a2 * b1 - a1 * b2) + b0 * s0;
+    res.d[1] = b7 * (a0 * b2 + a1 * b7 - a2 * b0) + b1 * s0;
+    res.d[2] = b7 * (a1 * b0 + a2 * b7 - a0 * b1) + b2 * s0;
+    res.d[3] = a2 * (b0 * b5 + t0 - b1 * b4) + a1 * (t1 + b2 * b4 - b0 * b6) + a0 * (t2 + b1 * b6 - b2 * b5) - a7 * s1;
+    res.d[4] = b2 * t5 + b1 * (a4b1 + a7b6 - a5b0 - a6b7) - a7 * t2 - a0 * s1;
+    res.d[5] = b2 * (a5b2 + a7b4 - a4b7 - a6b1) + b0 * (a5b0 + a6b7 - a4b1 - a7b6) - a7 * t1 - a1 * s1;
+    res.d[6] = b1 * (a4b7 + a6b1 - a5b2 - a7b4) - a7 * t0 - b0 * t5 - a2 * s1;
+    res.d[7] = a7 * (b0 * b0 + b1 * b1 + b2 * b2 + b7 * b7);
+    return res;
+}
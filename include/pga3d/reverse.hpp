@@ -0,0 +1,114 @@
+// Written by GAmphetamine.js
+// Reverse
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+#include "reverse_core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of trivector
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator~(const trivector_t& a) {
+    trivector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of quadvector
+// a0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator~(const quadvector_t& a) {
+    quadvector_t res;
+    res.d[0] = a.d[0];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of horizon
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator~(const horizon_t& a) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of origin
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator~(const origin_t& a) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of evector
+// a0 e₁ + a1 e₂ + a2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator~(const evector_t& a) {
+    evector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of dpoint
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator~(const dpoint_t& a) {
+    dpoint_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of odd
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator~(const odd_t& a) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = -a.d[4];
+    res.d[5] = -a.d[5];
+    res.d[6] = -a.d[6];
+    res.d[7] = -a.d[7];
+    return res;
+}
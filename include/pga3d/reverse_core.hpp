@@ -0,0 +1,153 @@
+// Written by GAmphetamine.js
+// Reverse, points, directions and motors only
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of vector
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator~(const vector_t& a) {
+    vector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of bivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator~(const bivector_t& a) {
+    bivector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -a.d[3];
+    res.d[4] = -a.d[4];
+    res.d[5] = -a.d[5];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of point
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator~(const point_t& a) {
+    trivector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of direction
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator~(const direction_t& a) {
+    direction_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of ebivector
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator~(const ebivector_t& a) {
+    ebivector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of ibivector
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator~(const ibivector_t& a) {
+    ibivector_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of rotation
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator~(const rotation_t& a) {
+    rotation_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of translation
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator~(const translation_t& a) {
+    translation_t res;
+    res.d[0] = -a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// reverse of even
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator~(const even_t& a) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = -a.d[1];
+    res.d[2] = -a.d[2];
+    res.d[3] = -a.d[3];
+    res.d[4] = -a.d[4];
+    res.d[5] = -a.d[5];
+    res.d[6] = -a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
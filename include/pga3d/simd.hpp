@@ -0,0 +1,228 @@
+// SSE/AVX kernels for the pga3d operators, included at the end of types.hpp when PGA3D_SIMD_KERNELS is set.
+// Each operator here replaces the generated scalar version that is compiled out with
+// #if !PGA3D_SIMD_KERNELS, the math is the same but laid out as lane-wise products of
+// shuffled operands so a 4 wide register does one blade group per instruction.
+// The guards aren't edited by hand, tools/pga3d_split.js puts them around every generated overload
+// named by a "// <op> between <a> and <b>" line below, keep that line above each kernel. The script
+// fails when a kernel names an overload the generator didn't emit.
+// Only products that measure faster than the generated code live here, results that are one
+// horizontal sum (plane ^ point), don't fill a register (vector ^ vector) or carry 3 lane
+// points (motor >> point, the compiler vectorizes the scalar version across a loop) stay scalar.
+
+#pragma once
+
+#include <emmintrin.h>
+#if PGA3D_SIMD_AVX
+#include <immintrin.h>
+#endif
+
+namespace pga3d_detail {
+
+// Lane permutation, lane k of the result is lane Ik of v
+template <int I0, int I1, int I2, int I3>
+inline __m128 swz(__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I3, I2, I1, I0)); }
+
+// Negate the lanes flagged with 1
+template <int S0, int S1, int S2, int S3>
+inline __m128 neg(__m128 v) {
+    const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(S0 ? (int)0x80000000 : 0, S1 ? (int)0x80000000 : 0, S2 ? (int)0x80000000 : 0, S3 ? (int)0x80000000 : 0));
+    return _mm_xor_ps(v, mask);
+}
+
+template <int I>
+inline __m128 splat(__m128 v) { return swz<I, I, I, I>(v); }
+
+inline __m128 madd(__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+// Cross product of the xyz lanes, w is 0 when both w lanes are 0
+inline __m128 cross3(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(swz<1, 2, 0, 3>(a), swz<2, 0, 1, 3>(b)), _mm_mul_ps(swz<2, 0, 1, 3>(a), swz<1, 2, 0, 3>(b)));
+}
+
+// Rotor part of a unit sandwich on a 3 lane direction, R = [s, B], v' = v + 2 * (s * t + t x B) with t = v x B
+inline __m128 rotate3(__m128 s, __m128 B, __m128 v) {
+    const __m128 t = cross3(v, B);
+    const __m128 u = _mm_add_ps(_mm_mul_ps(s, t), cross3(t, B));
+    return _mm_add_ps(v, _mm_add_ps(u, u));
+}
+
+// Sum of all 4 lanes in every lane
+inline __m128 hsum(__m128 v) {
+    v = _mm_add_ps(v, swz<1, 0, 3, 2>(v));
+    return _mm_add_ps(v, swz<2, 3, 0, 1>(v));
+}
+
+// rotation * rotation, also the [1,e23,e31,e12] half of even * even
+inline __m128 rotor_mul(__m128 a, __m128 b) {
+    __m128 r = _mm_mul_ps(splat<0>(a), b);
+    r = madd(splat<1>(a), neg<1, 0, 0, 1>(swz<1, 0, 3, 2>(b)), r);
+    r = madd(splat<2>(a), neg<1, 1, 0, 0>(swz<2, 3, 0, 1>(b)), r);
+    r = madd(splat<3>(a), neg<1, 0, 1, 0>(swz<3, 2, 1, 0>(b)), r);
+    return r;
+}
+
+} // namespace pga3d_detail
+
+////////////////////////////////////////////////////////////////////////////////
+// add between even and even
+inline even_t operator+(const even_t& a, const even_t& b) {
+    even_t res;
+#if PGA3D_SIMD_AVX
+    _mm256_storeu_ps(res.d, _mm256_add_ps(_mm256_loadu_ps(a.d), _mm256_loadu_ps(b.d)));
+#else
+    _mm_storeu_ps(res.d, _mm_add_ps(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)));
+    _mm_storeu_ps(res.d + 4, _mm_add_ps(_mm_loadu_ps(a.d + 4), _mm_loadu_ps(b.d + 4)));
+#endif
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// add between odd and odd
+inline odd_t operator+(const odd_t& a, const odd_t& b) {
+    odd_t res;
+#if PGA3D_SIMD_AVX
+    _mm256_storeu_ps(res.d, _mm256_add_ps(_mm256_loadu_ps(a.d), _mm256_loadu_ps(b.d)));
+#else
+    _mm_storeu_ps(res.d, _mm_add_ps(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)));
+    _mm_storeu_ps(res.d + 4, _mm_add_ps(_mm_loadu_ps(a.d + 4), _mm_loadu_ps(b.d + 4)));
+#endif
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sub between even and even
+inline even_t operator-(const even_t& a, const even_t& b) {
+    even_t res;
+#if PGA3D_SIMD_AVX
+    _mm256_storeu_ps(res.d, _mm256_sub_ps(_mm256_loadu_ps(a.d), _mm256_loadu_ps(b.d)));
+#else
+    _mm_storeu_ps(res.d, _mm_sub_ps(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)));
+    _mm_storeu_ps(res.d + 4, _mm_sub_ps(_mm_loadu_ps(a.d + 4), _mm_loadu_ps(b.d + 4)));
+#endif
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sub between odd and odd
+inline odd_t operator-(const odd_t& a, const odd_t& b) {
+    odd_t res;
+#if PGA3D_SIMD_AVX
+    _mm256_storeu_ps(res.d, _mm256_sub_ps(_mm256_loadu_ps(a.d), _mm256_loadu_ps(b.d)));
+#else
+    _mm_storeu_ps(res.d, _mm_sub_ps(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)));
+    _mm_storeu_ps(res.d + 4, _mm_sub_ps(_mm_loadu_ps(a.d + 4), _mm_loadu_ps(b.d + 4)));
+#endif
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// gp between rotation and rotation
+// 4 muls / 3 adds in 4 lanes
+inline rotation_t operator*(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    _mm_storeu_ps(res.d, pga3d_detail::rotor_mul(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// gp between even and even
+// 12 muls / 10 adds in 4 lanes
+inline even_t operator*(const even_t& a, const even_t& b) {
+    using namespace pga3d_detail;
+    const __m128 alo = _mm_loadu_ps(a.d), ahi = _mm_loadu_ps(a.d + 4);
+    const __m128 blo = _mm_loadu_ps(b.d), bhi = _mm_loadu_ps(b.d + 4);
+
+    __m128 hi = _mm_mul_ps(splat<0>(alo), bhi);
+    hi = madd(splat<1>(alo), neg<1, 0, 1, 0>(swz<3, 2, 1, 0>(bhi)), hi);
+    hi = madd(splat<2>(alo), neg<1, 1, 0, 0>(swz<2, 3, 0, 1>(bhi)), hi);
+    hi = madd(splat<3>(alo), neg<0, 1, 1, 0>(swz<1, 0, 3, 2>(bhi)), hi);
+    hi = madd(splat<0>(ahi), neg<0, 0, 1, 0>(swz<0, 3, 2, 1>(blo)), hi);
+    hi = madd(splat<1>(ahi), neg<1, 0, 0, 0>(swz<3, 0, 1, 2>(blo)), hi);
+    hi = madd(splat<2>(ahi), neg<0, 1, 0, 0>(swz<2, 1, 0, 3>(blo)), hi);
+    hi = madd(splat<3>(ahi), neg<1, 1, 1, 0>(swz<1, 2, 3, 0>(blo)), hi);
+
+    even_t res;
+    _mm_storeu_ps(res.d, rotor_mul(alo, blo));
+    _mm_storeu_ps(res.d + 4, hi);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// op between even and even
+// Lane-wise a0 * b + a * b0, the bivector products only reach e0123
+inline even_t operator^(const even_t& a, const even_t& b) {
+    using namespace pga3d_detail;
+    const __m128 alo = _mm_loadu_ps(a.d), ahi = _mm_loadu_ps(a.d + 4);
+    const __m128 blo = _mm_loadu_ps(b.d), bhi = _mm_loadu_ps(b.d + 4);
+    const __m128 mask3 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 a0 = splat<0>(alo), b0 = splat<0>(blo);
+
+    // a1 b4 + a2 b5 + a3 b6 + a4 b1 + a5 b2 + a6 b3
+    const __m128 bb = hsum(_mm_and_ps(madd(swz<1, 2, 3, 0>(alo), bhi, _mm_mul_ps(ahi, swz<1, 2, 3, 0>(blo))), mask3));
+
+    even_t res;
+    _mm_storeu_ps(res.d, madd(a0, blo, _mm_mul_ps(_mm_and_ps(alo, swz<3, 0, 1, 2>(mask3)), b0)));
+    _mm_storeu_ps(res.d + 4, _mm_add_ps(madd(a0, bhi, _mm_mul_ps(ahi, b0)), _mm_andnot_ps(mask3, bb)));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ip between vector and vector
+inline scalar_t operator|(const vector_t& a, const vector_t& b) {
+    using namespace pga3d_detail;
+    const __m128 mask3 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    return _mm_cvtss_f32(hsum(_mm_and_ps(_mm_mul_ps(_mm_loadu_ps(a.d), _mm_loadu_ps(b.d)), mask3)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ip between even and even
+// Lane-wise a0 * b + a * b0, then the bivector bivector terms on the scalar and e0i lanes
+inline even_t operator|(const even_t& a, const even_t& b) {
+    using namespace pga3d_detail;
+    const __m128 alo = _mm_loadu_ps(a.d), ahi = _mm_loadu_ps(a.d + 4);
+    const __m128 blo = _mm_loadu_ps(b.d), bhi = _mm_loadu_ps(b.d + 4);
+    const __m128 mask3 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 mask123 = swz<3, 0, 1, 2>(mask3);
+    const __m128 a0 = splat<0>(alo), b0 = splat<0>(blo);
+
+    // a1 b1 + a2 b2 + a3 b3 off the scalar lane
+    const __m128 bb = hsum(_mm_and_ps(_mm_mul_ps(alo, blo), mask123));
+    __m128 lo = madd(a0, blo, _mm_mul_ps(_mm_and_ps(alo, mask123), b0));
+    lo = _mm_sub_ps(lo, _mm_andnot_ps(mask123, bb));
+
+    // ai b7 + a7 bi off e0i
+    const __m128 t = madd(swz<1, 2, 3, 0>(alo), splat<3>(bhi), _mm_mul_ps(splat<3>(ahi), swz<1, 2, 3, 0>(blo)));
+    const __m128 hi = _mm_sub_ps(madd(a0, bhi, _mm_mul_ps(ahi, b0)), _mm_and_ps(t, mask3));
+
+    even_t res;
+    _mm_storeu_ps(res.d, lo);
+    _mm_storeu_ps(res.d + 4, hi);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sw between even and vector
+inline vector_t operator>>(const even_t& a, const vector_t& b) {
+    using namespace pga3d_detail;
+    const __m128 alo = _mm_loadu_ps(a.d), ahi = _mm_loadu_ps(a.d + 4);
+    const __m128 mask3 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    const __m128 s = splat<0>(alo);
+    const __m128 B = _mm_and_ps(swz<1, 2, 3, 0>(alo), mask3);
+    const __m128 T = _mm_and_ps(ahi, mask3);
+    const __m128 v = _mm_loadu_ps(b.d);
+    const __m128 n = _mm_and_ps(v, mask3);
+
+    // Plane normal only sees the rotor, the e0 lane picks up the translation
+    const __m128 r = rotate3(s, B, n);
+
+    // d' = d + 2 * (s * T + e0123 * B + B x T) . n
+    const __m128 k = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s, T), _mm_mul_ps(splat<3>(ahi), B)), cross3(B, T));
+    __m128 dp = _mm_mul_ps(k, n);
+    dp = _mm_add_ps(dp, swz<1, 0, 3, 2>(dp));
+    dp = _mm_add_ps(dp, swz<2, 3, 0, 1>(dp));
+    dp = _mm_add_ps(v, _mm_add_ps(dp, dp));
+
+    vector_t res;
+    _mm_storeu_ps(res.d, _mm_or_ps(r, _mm_andnot_ps(mask3, dp)));
+    return res;
+}
@@ -0,0 +1,275 @@
+// Structure of arrays batches for pga3d, each blade lives in its own array so the
+// kernels below run 8 elements per lane group (one AVX register or two SSE registers),
+// or a plain per element loop when the SIMD backend is off.
+
+#pragma once
+
+#include "core.hpp"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#if PGA3D_SIMD_KERNELS
+#include <emmintrin.h>
+#if PGA3D_SIMD_AVX
+#include <immintrin.h>
+#endif
+#endif
+
+namespace pga3d_detail {
+
+// Lane group of 8 floats, the scalar build steps one float at a time so the plain kernels
+// below stay in registers instead of going through an 8 wide array
+#if PGA3D_SIMD_KERNELS
+struct f8 {
+#if PGA3D_SIMD_AVX
+    __m256 v;
+    static f8 load(const float* p) { return { _mm256_loadu_ps(p) }; }
+    static f8 set1(float s) { return { _mm256_set1_ps(s) }; }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+    friend f8 operator+(f8 a, f8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+    friend f8 operator-(f8 a, f8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+    friend f8 operator*(f8 a, f8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+    friend f8 operator/(f8 a, f8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+    friend f8 operator-(f8 a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+    friend f8 lane_sqrt(f8 a) { return { _mm256_sqrt_ps(a.v) }; }
+    friend f8 lane_min(f8 a, f8 b) { return { _mm256_min_ps(a.v, b.v) }; }
+#else
+    __m128 lo, hi;
+    static f8 load(const float* p) { return { _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+    static f8 set1(float s) { return { _mm_set1_ps(s), _mm_set1_ps(s) }; }
+    void store(float* p) const { _mm_storeu_ps(p, lo); _mm_storeu_ps(p + 4, hi); }
+    friend f8 operator+(f8 a, f8 b) { return { _mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi) }; }
+    friend f8 operator-(f8 a, f8 b) { return { _mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi) }; }
+    friend f8 operator*(f8 a, f8 b) { return { _mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi) }; }
+    friend f8 operator/(f8 a, f8 b) { return { _mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi) }; }
+    friend f8 operator-(f8 a) { return { _mm_xor_ps(a.lo, _mm_set1_ps(-0.0f)), _mm_xor_ps(a.hi, _mm_set1_ps(-0.0f)) }; }
+    friend f8 lane_sqrt(f8 a) { return { _mm_sqrt_ps(a.lo), _mm_sqrt_ps(a.hi) }; }
+    friend f8 lane_min(f8 a, f8 b) { return { _mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi) }; }
+#endif
+};
+using lane_t = f8;
+constexpr size_t LaneStep = 8;
+inline f8 lane_load(const float* p) { return f8::load(p); }
+inline f8 lane_set1(float s) { return f8::set1(s); }
+inline void lane_store(float* p, f8 v) { v.store(p); }
+#else
+using lane_t = float;
+constexpr size_t LaneStep = 1;
+inline float lane_load(const float* p) { return *p; }
+inline float lane_set1(float s) { return s; }
+inline void lane_store(float* p, float v) { *p = v; }
+inline float lane_sqrt(float a) { return std::sqrt(a); }
+inline float lane_min(float a, float b) { return a < b ? a : b; }
+#endif
+
+// Kernels are written once against T = lane_t
+
+// gp between even and even
+template <typename T>
+inline void even_gp(const T a[8], const T b[8], T r[8]) {
+    r[0] = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+    r[1] = a[0] * b[1] + a[1] * b[0] + a[3] * b[2] - a[2] * b[3];
+    r[2] = a[0] * b[2] + a[1] * b[3] + a[2] * b[0] - a[3] * b[1];
+    r[3] = a[0] * b[3] + a[2] * b[1] + a[3] * b[0] - a[1] * b[2];
+    r[4] = a[0] * b[4] + a[3] * b[5] + a[4] * b[0] + a[6] * b[2] - a[1] * b[7] - a[2] * b[6] - a[5] * b[3] - a[7] * b[1];
+    r[5] = a[0] * b[5] + a[1] * b[6] + a[4] * b[3] + a[5] * b[0] - a[2] * b[7] - a[3] * b[4] - a[6] * b[1] - a[7] * b[2];
+    r[6] = a[0] * b[6] + a[2] * b[4] + a[5] * b[1] + a[6] * b[0] - a[1] * b[5] - a[3] * b[7] - a[4] * b[2] - a[7] * b[3];
+    r[7] = a[0] * b[7] + a[1] * b[4] + a[2] * b[5] + a[3] * b[6] + a[4] * b[1] + a[5] * b[2] + a[6] * b[3] + a[7] * b[0];
+}
+
+// sw between even and point, assumes a unit motor like operator>>
+template <typename T>
+inline void even_sw_point(const T a[8], const T b[3], T r[3]) {
+    const T s0 = a[1] * b[2] - a[3] * b[0] - a[5];
+    const T s1 = a[3] * b[1] - a[2] * b[2] - a[4];
+    const T s2 = a[2] * b[0] - a[1] * b[1] - a[6];
+    const T t0 = a[3] * s0 + a[0] * s1 - a[1] * a[7] - a[2] * s2;
+    const T t1 = a[1] * s2 + a[0] * s0 - a[2] * a[7] - a[3] * s1;
+    const T t2 = a[2] * s1 + a[0] * s2 - a[3] * a[7] - a[1] * s0;
+    r[0] = b[0] + t0 + t0;
+    r[1] = b[1] + t1 + t1;
+    r[2] = b[2] + t2 + t2;
+}
+
+// Motor times the dual number x + y e0123, which commutes with the even subalgebra
+template <typename T>
+inline void even_scale_dual(const T a[8], T x, T y, T r[8]) {
+    const T a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    r[0] = x * a0;
+    r[1] = x * a1;
+    r[2] = x * a2;
+    r[3] = x * a3;
+    r[4] = x * a[4] - y * a1;
+    r[5] = x * a[5] - y * a2;
+    r[6] = x * a[6] - y * a3;
+    r[7] = x * a[7] + y * a0;
+}
+
+// m * ~m = n + q e0123
+template <typename T>
+inline void even_norm_sq(const T a[8], T& n, T& q) {
+    n = a[0] * a[0] + a[1] * a[1] + a[2] * a[2] + a[3] * a[3];
+    const T d = a[0] * a[7] - a[1] * a[4] - a[2] * a[5] - a[3] * a[6];
+    q = d + d;
+}
+
+} // namespace pga3d_detail
+
+// POINTS SOA : {e032[], e013[], e021[]}, e123 is 1
+
+struct points_soa {
+    static constexpr size_t Lanes = 8;
+
+    // Blade storage, padded to a multiple of Lanes with zeros. Kernels write the padding too,
+    // resize resets it so none of it shows up as elements
+    std::vector<float> d[3];
+
+    size_t size() const { return count; }
+    size_t padded_size() const { return d[0].size(); }
+
+    void resize(size_t n) {
+        count = n;
+        const size_t padded = (n + Lanes - 1) / Lanes * Lanes;
+        for (size_t k = 0; k < 3; ++k) {
+            d[k].resize(padded);
+            std::fill(d[k].begin() + n, d[k].end(), 0.0f);
+        }
+    }
+    void clear() { resize(0); }
+    void push_back(const point_t& p) { resize(count + 1); set(count - 1, p); }
+
+    point_t get(size_t i) const { return point_t({ d[0][i], d[1][i], d[2][i] }); }
+    void set(size_t i, const point_t& p) { for (size_t k = 0; k < 3; ++k) d[k][i] = p.d[k]; }
+
+private:
+    size_t count = 0;
+};
+
+// EVEN SOA : {1[], e23[], e31[], e12[], e01[], e02[], e03[], e0123[]}
+
+struct even_soa {
+    static constexpr size_t Lanes = 8;
+
+    // Blade storage, padded to a multiple of Lanes with identity motors, reset on resize
+    std::vector<float> d[8];
+
+    size_t size() const { return count; }
+    size_t padded_size() const { return d[0].size(); }
+
+    void resize(size_t n) {
+        count = n;
+        const size_t padded = (n + Lanes - 1) / Lanes * Lanes;
+        for (size_t k = 0; k < 8; ++k) {
+            d[k].resize(padded);
+            std::fill(d[k].begin() + n, d[k].end(), k == 0 ? 1.0f : 0.0f);
+        }
+    }
+    void clear() { resize(0); }
+    void push_back(const even_t& m) { resize(count + 1); set(count - 1, m); }
+
+    even_t get(size_t i) const {
+        even_t m;
+        for (size_t k = 0; k < 8; ++k) m.d[k] = d[k][i];
+        return m;
+    }
+    void set(size_t i, const even_t& m) { for (size_t k = 0; k < 8; ++k) d[k][i] = m.d[k]; }
+
+private:
+    size_t count = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Batch kernels, out is resized to match and may alias the input. Two batch operands
+// must have the same size
+////////////////////////////////////////////////////////////////////////////////
+
+// sw of every point by one unit motor
+inline void sandwich(const even_t& m, const points_soa& in, points_soa& out) {
+    using namespace pga3d_detail;
+    out.resize(in.size());
+    const float* src[3] = { in.d[0].data(), in.d[1].data(), in.d[2].data() };
+    float* dst[3] = { out.d[0].data(), out.d[1].data(), out.d[2].data() };
+    lane_t a[8];
+    for (size_t k = 0; k < 8; ++k) a[k] = lane_set1(m.d[k]);
+    for (size_t i = 0, n = in.padded_size(); i < n; i += LaneStep) {
+        lane_t b[3], r[3];
+        for (size_t k = 0; k < 3; ++k) b[k] = lane_load(src[k] + i);
+        even_sw_point(a, b, r);
+        for (size_t k = 0; k < 3; ++k) lane_store(dst[k] + i, r[k]);
+    }
+}
+
+// sw of point i by unit motor i
+inline void sandwich(const even_soa& m, const points_soa& in, points_soa& out) {
+    using namespace pga3d_detail;
+    assert(m.size() == in.size());
+    out.resize(in.size());
+    const float* src[3] = { in.d[0].data(), in.d[1].data(), in.d[2].data() };
+    float* dst[3] = { out.d[0].data(), out.d[1].data(), out.d[2].data() };
+    for (size_t i = 0, n = in.padded_size(); i < n; i += LaneStep) {
+        lane_t a[8], b[3], r[3];
+        for (size_t k = 0; k < 8; ++k) a[k] = lane_load(m.d[k].data() + i);
+        for (size_t k = 0; k < 3; ++k) b[k] = lane_load(src[k] + i);
+        even_sw_point(a, b, r);
+        for (size_t k = 0; k < 3; ++k) lane_store(dst[k] + i, r[k]);
+    }
+}
+
+// out[i] = a * b[i], e.g. a parent transform applied to a batch of locals
+inline void compose(const even_t& a, const even_soa& b, even_soa& out) {
+    using namespace pga3d_detail;
+    out.resize(b.size());
+    lane_t x[8];
+    for (size_t k = 0; k < 8; ++k) x[k] = lane_set1(a.d[k]);
+    for (size_t i = 0, n = b.padded_size(); i < n; i += LaneStep) {
+        lane_t y[8], r[8];
+        for (size_t k = 0; k < 8; ++k) y[k] = lane_load(b.d[k].data() + i);
+        even_gp(x, y, r);
+        for (size_t k = 0; k < 8; ++k) lane_store(out.d[k].data() + i, r[k]);
+    }
+}
+
+// out[i] = a[i] * b[i]
+inline void compose(const even_soa& a, const even_soa& b, even_soa& out) {
+    using namespace pga3d_detail;
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    for (size_t i = 0, n = a.padded_size(); i < n; i += LaneStep) {
+        lane_t x[8], y[8], r[8];
+        for (size_t k = 0; k < 8; ++k) x[k] = lane_load(a.d[k].data() + i);
+        for (size_t k = 0; k < 8; ++k) y[k] = lane_load(b.d[k].data() + i);
+        even_gp(x, y, r);
+        for (size_t k = 0; k < 8; ++k) lane_store(out.d[k].data() + i, r[k]);
+    }
+}
+
+// Scale every motor so m * ~m = 1, m * (n + q e0123)^-1/2
+inline void normalize(even_soa& m) {
+    using namespace pga3d_detail;
+    const lane_t one = lane_set1(1.0f), half = lane_set1(0.5f);
+    for (size_t i = 0, count = m.padded_size(); i < count; i += LaneStep) {
+        lane_t a[8], n, q;
+        for (size_t k = 0; k < 8; ++k) a[k] = lane_load(m.d[k].data() + i);
+        even_norm_sq(a, n, q);
+        const lane_t x = one / lane_sqrt(n);
+        even_scale_dual(a, x, -(half * q * x / n), a);
+        for (size_t k = 0; k < 8; ++k) lane_store(m.d[k].data() + i, a[k]);
+    }
+}
+
+// General inverse, ~m * (n + q e0123)^-1
+inline void inverse(const even_soa& m, even_soa& out) {
+    using namespace pga3d_detail;
+    out.resize(m.size());
+    const lane_t one = lane_set1(1.0f);
+    for (size_t i = 0, count = m.padded_size(); i < count; i += LaneStep) {
+        lane_t a[8], n, q;
+        for (size_t k = 0; k < 8; ++k) a[k] = lane_load(m.d[k].data() + i);
+        even_norm_sq(a, n, q);
+        for (size_t k = 1; k < 7; ++k) a[k] = -a[k];
+        const lane_t x = one / n;
+        even_scale_dual(a, x, -(q * x * x), a);
+        for (size_t k = 0; k < 8; ++k) lane_store(out.d[k].data() + i, a[k]);
+    }
+}
@@ -0,0 +1,1121 @@
+// Written by GAmphetamine.js
+// Subtraction, points, directions and motors only
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and bivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const scalar_t& a, const bivector_t& b) {
+    even_t res;
+    res.d[0] = a;
+    res.d[1] = -b.d[0];
+    res.d[2] = -b.d[1];
+    res.d[3] = -b.d[2];
+    res.d[4] = -b.d[3];
+    res.d[5] = -b.d[4];
+    res.d[6] = -b.d[5];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and ebivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const scalar_t& a, const ebivector_t& b) {
+    rotation_t res;
+    res.d[0] = a;
+    res.d[1] = -b.d[0];
+    res.d[2] = -b.d[1];
+    res.d[3] = -b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and ibivector  
+// a
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const scalar_t& a, const ibivector_t& b) {
+    even_t res;
+    res.d[0] = a;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and rotation  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const scalar_t& a, const rotation_t& b) {
+    rotation_t res;
+    res.d[0] = a - b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and translation  
+// a
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const scalar_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1 + a;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between scalar and even  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const scalar_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = a - b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = -b.d[4];
+    res.d[5] = -b.d[5];
+    res.d[6] = -b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between vector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator-(const vector_t& a, const vector_t& b) {
+    vector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between vector and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator-(const vector_t& a, const point_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between vector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator-(const vector_t& a, const direction_t& b) {
+    odd_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const bivector_t& a, const scalar_t& b) {
+    even_t res;
+    res.d[0] = -b;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = a.d[3];
+    res.d[5] = a.d[4];
+    res.d[6] = a.d[5];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const bivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    res.d[4] = a.d[4] - b.d[4];
+    res.d[5] = a.d[5] - b.d[5];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const bivector_t& a, const ebivector_t& b) {
+    bivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const bivector_t& a, const ibivector_t& b) {
+    bivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3] - b.d[0];
+    res.d[4] = a.d[4] - b.d[1];
+    res.d[5] = a.d[5] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const bivector_t& a, const rotation_t& b) {
+    even_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = a.d[0] - b.d[1];
+    res.d[2] = a.d[1] - b.d[2];
+    res.d[3] = a.d[2] - b.d[3];
+    res.d[4] = a.d[3];
+    res.d[5] = a.d[4];
+    res.d[6] = a.d[5];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const bivector_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = a.d[3] - b.d[0];
+    res.d[5] = a.d[4] - b.d[1];
+    res.d[6] = a.d[5] - b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between bivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const bivector_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = a.d[0] - b.d[1];
+    res.d[2] = a.d[1] - b.d[2];
+    res.d[3] = a.d[2] - b.d[3];
+    res.d[4] = a.d[3] - b.d[4];
+    res.d[5] = a.d[4] - b.d[5];
+    res.d[6] = a.d[5] - b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between point and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator-(const point_t& a, const vector_t& b) {
+    odd_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 1.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between point and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator-(const point_t& a, const point_t& b) {
+    direction_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between point and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator-(const point_t& a, const direction_t& b) {
+    point_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between direction and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator-(const direction_t& a, const vector_t& b) {
+    odd_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between direction and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator-(const direction_t& a, const point_t& b) {
+    trivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between direction and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator-(const direction_t& a, const direction_t& b) {
+    direction_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const ebivector_t& a, const scalar_t& b) {
+    rotation_t res;
+    res.d[0] = -b;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const ebivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = -b.d[4];
+    res.d[5] = -b.d[5];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator-(const ebivector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const ebivector_t& a, const ibivector_t& b) {
+    bivector_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = -b.d[0];
+    res.d[4] = -b.d[1];
+    res.d[5] = -b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const ebivector_t& a, const rotation_t& b) {
+    rotation_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = a.d[0] - b.d[1];
+    res.d[2] = a.d[1] - b.d[2];
+    res.d[3] = a.d[2] - b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ebivector_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1;
+    res.d[1] = a.d[0];
+    res.d[2] = a.d[1];
+    res.d[3] = a.d[2];
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ebivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ebivector_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = a.d[0] - b.d[1];
+    res.d[2] = a.d[1] - b.d[2];
+    res.d[3] = a.d[2] - b.d[3];
+    res.d[4] = -b.d[4];
+    res.d[5] = -b.d[5];
+    res.d[6] = -b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and scalar  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ibivector_t& a, const scalar_t& b) {
+    even_t res;
+    res.d[0] = -b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and bivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const ibivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = a.d[0] - b.d[3];
+    res.d[4] = a.d[1] - b.d[4];
+    res.d[5] = a.d[2] - b.d[5];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and ebivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator-(const ibivector_t& a, const ebivector_t& b) {
+    bivector_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = a.d[0];
+    res.d[4] = a.d[1];
+    res.d[5] = a.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and ibivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator-(const ibivector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and rotation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ibivector_t& a, const rotation_t& b) {
+    even_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and translation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ibivector_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0] - b.d[0];
+    res.d[5] = a.d[1] - b.d[1];
+    res.d[6] = a.d[2] - b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between ibivector and even  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const ibivector_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = -b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0] - b.d[4];
+    res.d[5] = a.d[1] - b.d[5];
+    res.d[6] = a.d[2] - b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const rotation_t& a, const scalar_t& b) {
+    rotation_t res;
+    res.d[0] = a.d[0] - b;
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const rotation_t& a, const bivector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1] - b.d[0];
+    res.d[2] = a.d[2] - b.d[1];
+    res.d[3] = a.d[3] - b.d[2];
+    res.d[4] = -b.d[3];
+    res.d[5] = -b.d[4];
+    res.d[6] = -b.d[5];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const rotation_t& a, const ebivector_t& b) {
+    rotation_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1] - b.d[0];
+    res.d[2] = a.d[2] - b.d[1];
+    res.d[3] = a.d[3] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const rotation_t& a, const ibivector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator-(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const rotation_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1 + a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = -b.d[0];
+    res.d[5] = -b.d[1];
+    res.d[6] = -b.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between rotation and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const rotation_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    res.d[4] = -b.d[4];
+    res.d[5] = -b.d[5];
+    res.d[6] = -b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and scalar  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const translation_t& a, const scalar_t& b) {
+    even_t res;
+    res.d[0] = 1 - b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and bivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const translation_t& a, const bivector_t& b) {
+    even_t res;
+    res.d[0] = 1.0;
+    res.d[1] = -b.d[0];
+    res.d[2] = -b.d[1];
+    res.d[3] = -b.d[2];
+    res.d[4] = a.d[0] - b.d[3];
+    res.d[5] = a.d[1] - b.d[4];
+    res.d[6] = a.d[2] - b.d[5];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and ebivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const translation_t& a, const ebivector_t& b) {
+    even_t res;
+    res.d[0] = 1.0;
+    res.d[1] = -b.d[0];
+    res.d[2] = -b.d[1];
+    res.d[3] = -b.d[2];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and ibivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator-(const translation_t& a, const ibivector_t& b) {
+    translation_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and rotation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const translation_t& a, const rotation_t& b) {
+    even_t res;
+    res.d[0] = 1 - b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0];
+    res.d[5] = a.d[1];
+    res.d[6] = a.d[2];
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and translation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator-(const translation_t& a, const translation_t& b) {
+    ibivector_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between translation and even  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const translation_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = 1 - b.d[0];
+    res.d[1] = -b.d[1];
+    res.d[2] = -b.d[2];
+    res.d[3] = -b.d[3];
+    res.d[4] = a.d[0] - b.d[4];
+    res.d[5] = a.d[1] - b.d[5];
+    res.d[6] = a.d[2] - b.d[6];
+    res.d[7] = -b.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const scalar_t& b) {
+    even_t res;
+    res.d[0] = a.d[0] - b;
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const bivector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1] - b.d[0];
+    res.d[2] = a.d[2] - b.d[1];
+    res.d[3] = a.d[3] - b.d[2];
+    res.d[4] = a.d[4] - b.d[3];
+    res.d[5] = a.d[5] - b.d[4];
+    res.d[6] = a.d[6] - b.d[5];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const ebivector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1] - b.d[0];
+    res.d[2] = a.d[2] - b.d[1];
+    res.d[3] = a.d[3] - b.d[2];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const ibivector_t& b) {
+    even_t res;
+    res.d[0] = a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4] - b.d[0];
+    res.d[5] = a.d[5] - b.d[1];
+    res.d[6] = a.d[6] - b.d[2];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const rotation_t& b) {
+    even_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    res.d[4] = a.d[4];
+    res.d[5] = a.d[5];
+    res.d[6] = a.d[6];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator-(const even_t& a, const translation_t& b) {
+    even_t res;
+    res.d[0] = -1 + a.d[0];
+    res.d[1] = a.d[1];
+    res.d[2] = a.d[2];
+    res.d[3] = a.d[3];
+    res.d[4] = a.d[4] - b.d[0];
+    res.d[5] = a.d[5] - b.d[1];
+    res.d[6] = a.d[6] - b.d[2];
+    res.d[7] = a.d[7];
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sub between even and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 8 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+#if !PGA3D_SIMD_KERNELS
+CONSTEXPR inline even_t operator-(const even_t& a, const even_t& b) {
+    even_t res;
+    res.d[0] = a.d[0] - b.d[0];
+    res.d[1] = a.d[1] - b.d[1];
+    res.d[2] = a.d[2] - b.d[2];
+    res.d[3] = a.d[3] - b.d[3];
+    res.d[4] = a.d[4] - b.d[4];
+    res.d[5] = a.d[5] - b.d[5];
+    res.d[6] = a.d[6] - b.d[6];
+    res.d[7] = a.d[7] - b.d[7];
+    return res;
+}
+#endif
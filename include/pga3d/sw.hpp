@@ -0,0 +1,3442 @@
+// Written by GAmphetamine.js
+// Sandwich product
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+#include "sw_core.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and trivector  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const scalar_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and quadvector  
+// a
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const scalar_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const scalar_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const scalar_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and evector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const scalar_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and dpoint  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const scalar_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and odd  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const scalar_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 25 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const vector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a2b2 = a2 * b2, a3b3 = a3 * b3, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a2b2 + a3b3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + t1) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a1 * t1 + a0 * (a1 * b0 - a0 * b1) - a2a2 * b1);
+    res.d[2] = b2 + 2.0 * (a2 * a3b3 + a1 * (a2b1 - a1 * b2) + a0 * (a2 * b0 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (b3 * (a0 * a0 + t0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const vector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = b0 + 2.0 * (b0 * (a0 * a0 + a1 * a1 + a2 * a2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const vector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 10 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const vector_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = 2 * a0 * a3;
+    res.d[1] = 2 * a1 * a3;
+    res.d[2] = 2 * a2 * a3;
+    res.d[3] = 1 + 2.0 * (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 11 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const vector_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = 2.0 * (a3 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 11 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const vector_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = 1 + 2.0 * (a3 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 36 muls / 22 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const vector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, a1a1 = a1 * a1, a2a2 = a2 * a2,
+        a2b6 = a2 * b6, a3b7 = a3 * b7, a2b5 = a2 * b5,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = a1a1 + a2a2, t3 = a2b6 + a3b7;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3 + 2.0 * (a3 * t1);
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + t3) - b4 * t2);
+    res.d[5] = b5 + 2.0 * (a1 * t3 + a0 * (a1 * b4 - a0 * b5) - a2a2 * b5);
+    res.d[6] = b6 + 2.0 * (a2 * a3b7 + a1 * (a2b5 - a1 * b6) + a0 * (a2 * b4 - a0 * b6));
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 21 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const bivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a2b0 = a2 * b0, a4b3 = a4 * b3, a1b0 = a1 * b0, a5b3 = a5 * b3, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a3b3 = a3 * b3,
+        t0 = a2b0 + a4b3, t1 = a1b0 - a5b3, t2 = a1b2 - a2b1, t3 = t2 + a3b3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - a2 * t0 - a1 * t1);
+    res.d[1] = b1 + 2.0 * (a2 * t3 + a0 * (t1 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (t0 - a0 * b2) - a1 * t3);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const bivector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const bivector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and origin  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const bivector_t& a, const origin_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5];
+    res.d[0] = 2.0 * (a1 * a5 - a2 * a4);
+    res.d[1] = 2.0 * (a2 * a3 - a0 * a5);
+    res.d[2] = 2.0 * (a0 * a4 - a1 * a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 29 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const bivector_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = 2.0 * (a2 * (a3 * b1 - a4 * b0) + a1 * (a5 * b0 - a3 * b2) + a0 * (a4 * b2 - a5 * b1));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 29 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const bivector_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = 1 + 2.0 * (a2 * (a3 * b1 - a4 * b0) + a1 * (a5 * b0 - a3 * b2) + a0 * (a4 * b2 - a5 * b1));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 50 muls / 31 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const bivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a2b4 = a2 * b4, a4b7 = a4 * b7, a1b4 = a1 * b4,
+        a5b7 = a5 * b7, a1b6 = a1 * b6, a2b5 = a2 * b5, a3b7 = a3 * b7,
+        t0 = a1b2 - a2b1, t1 = a2b4 + a4b7, t2 = a1b4 - a5b7, t3 = a1b6 - a2b5, t4 = t3 + a3b7;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3 + 2.0 * (a2 * (a3 * b1 - a4 * b0) + a1 * (a5 * b0 - a3 * b2) + a0 * (a4 * b2 - a5 * b1));
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2 * b6) - a2 * t1 - a1 * t2);
+    res.d[5] = b5 + 2.0 * (a2 * t4 + a0 * (t2 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (a0 * (t1 - a0 * b6) - a1 * t4);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const trivector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const trivector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a3a3 = a3 * a3,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    res.d[3] = b3 + 2.0 * (a3 * (a0 * b0 + a1 * b1 + a2 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 15 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const trivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3 + 2.0 * (a3 * (a1 * b2 - a2 * b1 - a3 * b3));
+    res.d[4] = b4 + 2.0 * (a3 * (a2 * b0 - a0 * b2 - a3 * b4));
+    res.d[5] = b5 + 2.0 * (a3 * (a0 * b1 - a1 * b0 - a3 * b5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 10 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const trivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a3b3 = a3 * b3;
+    res.d[0] = b0 - 2 * a0 * a3b3;
+    res.d[1] = b1 - 2 * a1 * a3b3;
+    res.d[2] = b2 - 2 * a2 * a3b3;
+    res.d[3] = b3 * (1 - 2 * a3 * a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 3 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const trivector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float a3 = a.d[3], b0 = b.d[0];
+    res.d[0] = b0 * (1 - 2 * a3 * a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const trivector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 8 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const trivector_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3];
+    res.d[0] = -2 * a0 * a3;
+    res.d[1] = -2 * a1 * a3;
+    res.d[2] = -2 * a2 * a3;
+    res.d[3] = 1 - 2 * a3 * a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 8 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const trivector_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0 - 2 * a0 * a3;
+    res.d[1] = b1 - 2 * a1 * a3;
+    res.d[2] = b2 - 2 * a2 * a3;
+    res.d[3] = 1 - 2 * a3 * a3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const trivector_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 12 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const trivector_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 2.0 * (a3 * (a1 * b2 - a2 * b1));
+    res.d[4] = 2.0 * (a3 * (a2 * b0 - a0 * b2));
+    res.d[5] = 2.0 * (a3 * (a0 * b1 - a1 * b0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 5 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const trivector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a3a3 = a3 * a3,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const trivector_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a3a3 = a3 * a3,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    res.d[3] = 2.0 * (a3 * (a0 * b0 + a1 * b1 + a2 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const trivector_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a3a3 = a3 * a3,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    res.d[3] = 1 + 2.0 * (a3 * (a0 * b0 + a1 * b1 + a2 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 12 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const trivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = 2.0 * (a3 * (a1 * b3 - a2 * b2));
+    res.d[5] = 2.0 * (a3 * (a2 * b1 - a0 * b3));
+    res.d[6] = 2.0 * (a3 * (a0 * b2 - a1 * b1));
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 5 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const trivector_t& a, const translation_t& b) {
+    translation_t res;
+    const float a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a3a3 = a3 * a3,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 18 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const trivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4 + 2.0 * (a3 * (a1 * b3 - a2 * b2 - a3 * b4));
+    res.d[5] = b5 + 2.0 * (a3 * (a2 * b1 - a0 * b3 - a3 * b5));
+    res.d[6] = b6 + 2.0 * (a3 * (a0 * b2 - a1 * b1 - a3 * b6));
+    res.d[7] = b7 * (1 - 2 * a3 * a3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between trivector and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + a3 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 18 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const trivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a3a3 = a3 * a3, a3b7 = a3 * b7,
+        t0 = 2 * a3a3 - 1;
+    res.d[0] = -b0 * t0;
+    res.d[1] = -b1 * t0;
+    res.d[2] = -b2 * t0;
+    res.d[3] = b3 + 2.0 * (a3 * (a0 * b0 + a1 * b1 + a2 * b2));
+    res.d[4] = b4 - 2 * a0 * a3b7;
+    res.d[5] = b5 - 2 * a1 * a3b7;
+    res.d[6] = b6 - 2 * a2 * a3b7;
+    res.d[7] = -b7 * t0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and scalar  
+// a0 e₀₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const quadvector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and vector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const quadvector_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and bivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const quadvector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and trivector  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const quadvector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and quadvector  
+// a0 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const quadvector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const quadvector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const quadvector_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and point  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const quadvector_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and direction  
+// a0 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const quadvector_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and ebivector  
+// a0 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const quadvector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and ibivector  
+// a0 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const quadvector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and evector  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const quadvector_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and dpoint  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const quadvector_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and rotation  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const quadvector_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and translation  
+// a0 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const quadvector_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and even  
+// a0 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const quadvector_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between quadvector and odd  
+// a0 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const quadvector_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and scalar  
+// 1 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const horizon_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and vector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const horizon_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and bivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const horizon_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and trivector  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const horizon_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and quadvector  
+// 1 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const horizon_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const horizon_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const horizon_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and point  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const horizon_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and direction  
+// 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const horizon_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and ebivector  
+// 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const horizon_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and ibivector  
+// 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const horizon_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and evector  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const horizon_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and dpoint  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const horizon_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and rotation  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const horizon_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and translation  
+// 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const horizon_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and even  
+// 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const horizon_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between horizon and odd  
+// 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const horizon_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and scalar  
+// 1 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const origin_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and vector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const origin_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and bivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const origin_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = -b3;
+    res.d[4] = -b4;
+    res.d[5] = -b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and trivector  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const origin_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = -b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and quadvector  
+// 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const origin_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = -b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const origin_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and origin  
+// 1 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const origin_t& a, const origin_t& b) {
+    trivector_t res;
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and point  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const origin_t& a, const point_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and direction  
+// 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const origin_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and ebivector  
+// 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const origin_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and ibivector  
+// 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const origin_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and evector  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const origin_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and dpoint  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const origin_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and rotation  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const origin_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and translation  
+// 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const origin_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and even  
+// 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const origin_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = -b4;
+    res.d[5] = -b5;
+    res.d[6] = -b6;
+    res.d[7] = -b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between origin and odd  
+// 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const origin_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = -b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 6 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const point_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 - 2 * a0 * b3;
+    res.d[1] = b1 - 2 * a1 * b3;
+    res.d[2] = b2 - 2 * a2 * b3;
+    res.d[3] = -b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 1 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const point_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = -b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const point_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and origin  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const point_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -2 * a0;
+    res.d[1] = -2 * a1;
+    res.d[2] = -2 * a2;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const point_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const point_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = 1 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 10 muls / 10 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const point_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = b3 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    res.d[4] = b4 - 2 * a0 * b7;
+    res.d[5] = b5 - 2 * a1 * b7;
+    res.d[6] = b6 - 2 * a2 * b7;
+    res.d[7] = -b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and trivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const direction_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and quadvector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const direction_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const direction_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const direction_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and evector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const direction_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and dpoint  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const direction_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and odd  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const direction_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and trivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const ebivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and quadvector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const ebivector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const ebivector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const ebivector_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and evector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const ebivector_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and dpoint  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const ebivector_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and odd  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 36 muls / 21 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const ebivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1, a1b6 = a1 * b6,
+        a2b5 = a2 * b5,
+        s0 = a1a1 + a2a2,
+        t0 = a1b2 - a2b1, t1 = a1b6 - a2b5;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * s0);
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3;
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2 * b6) - b4 * s0);
+    res.d[5] = b5 + 2.0 * (a2 * t1 + a0 * (a1 * b4 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (a0 * (a2 * b4 - a0 * b6) - a1 * t1);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and trivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const ibivector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and quadvector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const ibivector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const ibivector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const ibivector_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and evector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const ibivector_t& a, const evector_t& b) {
+    evector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and dpoint  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const ibivector_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and odd  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const ibivector_t& a, const odd_t& b) {
+    odd_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const evector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const evector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 28 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const evector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b3 = a0 * b3, a1b4 = a1 * b4, a2b5 = a2 * b5,
+        t0 = a0b3 + a1b4, t1 = t0 + a2b5, t2 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t2 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t2);
+    res.d[3] = b3 + 2.0 * (a0 * t1);
+    res.d[4] = b4 + 2.0 * (a1 * t1);
+    res.d[5] = b5 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 22 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const evector_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a2 * t1 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t1);
+    res.d[3] = b3 + 2.0 * (b3 * (a0 * a0 + t0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const evector_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = b0 + 2.0 * (b0 * (a0 * a0 + a1 * a1 + a2 * a2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const evector_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and origin  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const evector_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = 0.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 1 + 2.0 * (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and point  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 21 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const evector_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a2 * t1 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t1);
+    res.d[3] = 1 + 2.0 * (a0 * a0 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const evector_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const evector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const evector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and evector  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const evector_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const evector_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const evector_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a2b2 = a2 * b2,
+        t0 = a1b3 - a2b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t0 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const evector_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and even  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 31 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const evector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b3 = a1 * b3, a2b2 = a2 * b2, a0b4 = a0 * b4,
+        a1b5 = a1 * b5, a2b6 = a2 * b6,
+        t0 = a0b4 + a1b5, t1 = t0 + a2b6, t2 = a1a1 + a2a2, t3 = a1b3 - a2b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * t2);
+    res.d[2] = b2 + 2.0 * (a2 * t3 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t3);
+    res.d[4] = b4 + 2.0 * (a0 * t1);
+    res.d[5] = b5 + 2.0 * (a1 * t1);
+    res.d[6] = b6 + 2.0 * (a2 * t1);
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between evector and odd  
+// a0 e₁ + a1 e₂ + a2 e₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 31 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const evector_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, a1a1 = a1 * a1, a2a2 = a2 * a2,
+        a1b6 = a1 * b6, a2b5 = a2 * b5,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = a1a1 + a2a2, t3 = a1b6 - a2b5;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3;
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2 * b6) - b4 * t2);
+    res.d[5] = b5 + 2.0 * (a2 * t3 + a0 * (a1 * b4 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (a0 * (a2 * b4 - a0 * b6) - a1 * t3);
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const dpoint_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const dpoint_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3 + 2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 34 muls / 25 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const dpoint_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b0 = a2 * b0, a1b4 = a1 * b4,
+        a2b5 = a2 * b5,
+        t0 = a1b2 - a2b1, t1 = a1b4 + a2b5;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3 + 2.0 * (a1b2 - a2b1 - a0 * (a0 * b3 + t1));
+    res.d[4] = b4 + 2.0 * (a2b0 - a1 * t1 - a0 * (a1 * b3 + b2));
+    res.d[5] = b5 + 2.0 * (a0 * (b1 - a2 * b3) - a2a2 * b5 - a1 * (a2 * b4 + b0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 24 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const dpoint_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a2b2 = a2 * b2, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a2b2 + b3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + t1) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a1 * t1 + a0 * (a1 * b0 - a0 * b1) - a2a2 * b1);
+    res.d[2] = b2 + 2.0 * (a2 * b3 + a1 * (a2b1 - a1 * b2) + a0 * (a2 * b0 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (b3 * (a0 * a0 + t0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 5 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const dpoint_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0];
+    res.d[0] = b0 + 2.0 * (b0 * (a0 * a0 + a1 * a1 + a2 * a2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const dpoint_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 7 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const dpoint_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = 2 * a0;
+    res.d[1] = 2 * a1;
+    res.d[2] = 2 * a2;
+    res.d[3] = 1 + 2.0 * (a0 * a0 + a1 * a1 + a2 * a2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 21 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const dpoint_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (1 + a1 * b1 + a2 * b2) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a1 + a2 * t1 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a2 + a0 * (a2 * b0 - a0 * b2) - a1 * t1);
+    res.d[3] = 1 + 2.0 * (a0 * a0 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const dpoint_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 22 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const dpoint_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0,
+        t0 = a1b2 - a2b1, t1 = a0b1 - a1b0, t2 = a0b2 - a2b0;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 - a0 * t1);
+    res.d[2] = b2 - 2 * (a1 * t0 + a0 * t2);
+    res.d[3] = 2 * t0;
+    res.d[4] = -2 * t2;
+    res.d[5] = 2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const dpoint_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const dpoint_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = 2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 10 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const dpoint_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = 1 + 2 * t1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 22 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const dpoint_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a2b2 = a2 * b2, a0b2 = a0 * b2, a1b1 = a1 * b1, a0b3 = a0 * b3,
+        a2b1 = a2 * b1,
+        t0 = a1b3 - a2b2, t1 = a0b2 - a1b1, t2 = a0b3 - a2b1;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t0 - a0 * t1);
+    res.d[3] = b3 - 2 * (a1 * t0 + a0 * t2);
+    res.d[4] = 2 * t0;
+    res.d[5] = -2 * t2;
+    res.d[6] = 2 * t1;
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const dpoint_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 37 muls / 27 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const dpoint_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b3 = a1 * b3, a2b2 = a2 * b2, a2b1 = a2 * b1,
+        a1b5 = a1 * b5, a2b6 = a2 * b6,
+        t0 = a1a1 + a2a2, t1 = a1b3 - a2b2, t2 = a1b5 + a2b6;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * t0);
+    res.d[2] = b2 + 2.0 * (a2 * t1 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2b1 - a0 * b3) - a1 * t1);
+    res.d[4] = b4 + 2.0 * (a1b3 - a2b2 - a0 * (a0 * b4 + t2));
+    res.d[5] = b5 + 2.0 * (a2b1 - a1 * t2 - a0 * (a1 * b4 + b3));
+    res.d[6] = b6 + 2.0 * (a0 * (b2 - a2 * b4) - a2a2 * b6 - a1 * (a2 * b5 + b1));
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between dpoint and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + 1 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 34 muls / 22 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const dpoint_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2, a1a1 = a1 * a1, a2a2 = a2 * a2,
+        a2b6 = a2 * b6, a2b5 = a2 * b5,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2, t2 = a1a1 + a2a2, t3 = a2b6 + b7;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3 + 2 * t1;
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + t3) - b4 * t2);
+    res.d[5] = b5 + 2.0 * (a1 * t3 + a0 * (a1 * b4 - a0 * b5) - a2a2 * b5);
+    res.d[6] = b6 + 2.0 * (a2 * b7 + a1 * (a2b5 - a1 * b6) + a0 * (a2 * b4 - a0 * b6));
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const rotation_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const rotation_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const rotation_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and origin  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline origin_t operator>>(const rotation_t& a, const origin_t& b) {
+
+    return origin_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline evector_t operator>>(const rotation_t& a, const evector_t& b) {
+    evector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + 1 e₀
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline dpoint_t operator>>(const rotation_t& a, const dpoint_t& b) {
+    dpoint_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 36 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const rotation_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1, a1b6 = a1 * b6, a3b4 = a3 * b4, a1b5 = a1 * b5, a2b4 = a2 * b4,
+        a2b6 = a2 * b6, a3b5 = a3 * b5,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1, s3 = a1b6 - a3b4, s4 = a3b5 - a2b6, s5 = a2b4 - a1b5;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3;
+    res.d[4] = b4 + 2.0 * (a3 * s3 + a0 * s4 - a2 * s5);
+    res.d[5] = b5 + 2.0 * (a1 * s5 + a0 * s3 - a3 * s4);
+    res.d[6] = b6 + 2.0 * (a2 * s4 + a0 * s5 - a1 * s3);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and trivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const translation_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0 - 2 * a0 * b3;
+    res.d[1] = b1 - 2 * a1 * b3;
+    res.d[2] = b2 - 2 * a2 * b3;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and quadvector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const translation_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const translation_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and origin  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const translation_t& a, const origin_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2];
+    res.d[0] = -2 * a0;
+    res.d[1] = -2 * a1;
+    res.d[2] = -2 * a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and evector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const translation_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and dpoint  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const translation_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 1 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and odd  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 10 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const translation_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    res.d[4] = b4 - 2 * a0 * b7;
+    res.d[5] = b5 - 2 * a1 * b7;
+    res.d[6] = b6 - 2 * a2 * b7;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and trivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 25 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const even_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a7b3 = a7 * b3, a1b2 = a1 * b2, a3b0 = a3 * b0, a5b3 = a5 * b3, a1b1 = a1 * b1,
+        a2b0 = a2 * b0, a6b3 = a6 * b3, a2b2 = a2 * b2, a3b1 = a3 * b1, a4b3 = a4 * b3,
+        s0 = a1b2 - a3b0 - a5b3, s1 = a3b1 - a2b2 - a4b3, s2 = a2b0 - a1b1 - a6b3;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a1 * a7b3 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a2 * a7b3 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a3 * a7b3 - a1 * s0);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and quadvector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const even_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float b0 = b.d[0];
+    res.d[0] = b0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const even_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and origin  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 15 muls / 9 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const even_t& a, const origin_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = 2.0 * (a2 * a6 - a0 * a4 - a1 * a7 - a3 * a5);
+    res.d[1] = 2.0 * (a3 * a4 - a0 * a5 - a1 * a6 - a2 * a7);
+    res.d[2] = 2.0 * (a1 * a5 - a0 * a6 - a2 * a4 - a3 * a7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and evector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 35 muls / 23 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const even_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = 2.0 * (a3 * (a4 * b1 + a7 * b2 - a5 * b0) + a2 * (a6 * b0 + a7 * b1 - a4 * b2) + a1 * (a5 * b2 + a7 * b0 - a6 * b1) + a0 * (a4 * b0 + a5 * b1 + a6 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and dpoint  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 35 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const even_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = 1 + 2.0 * (a3 * (a4 * b1 + a7 * b2 - a5 * b0) + a2 * (a6 * b0 + a7 * b1 - a4 * b2) + a1 * (a5 * b2 + a7 * b0 - a6 * b1) + a0 * (a4 * b0 + a5 * b1 + a6 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and odd  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 60 muls / 42 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const even_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1, a7b7 = a7 * b7, a1b6 = a1 * b6, a3b4 = a3 * b4, a5b7 = a5 * b7,
+        a1b5 = a1 * b5, a2b4 = a2 * b4, a6b7 = a6 * b7, a2b6 = a2 * b6, a3b5 = a3 * b5,
+        a4b7 = a4 * b7,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1, s3 = a1b6 - a3b4 - a5b7, s4 = a3b5 - a2b6 - a4b7, s5 = a2b4 - a1b5 - a6b7;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3 + 2.0 * (a3 * (a4 * b1 + a7 * b2 - a5 * b0) + a2 * (a6 * b0 + a7 * b1 - a4 * b2) + a1 * (a5 * b2 + a7 * b0 - a6 * b1) + a0 * (a4 * b0 + a5 * b1 + a6 * b2));
+    res.d[4] = b4 + 2.0 * (a3 * s3 + a0 * s4 - a1 * a7b7 - a2 * s5);
+    res.d[5] = b5 + 2.0 * (a1 * s5 + a0 * s3 - a2 * a7b7 - a3 * s4);
+    res.d[6] = b6 + 2.0 * (a2 * s4 + a0 * s5 - a3 * a7b7 - a1 * s3);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const odd_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (b * (a0 * a4 + a1 * a5 + a2 * a6 + a3 * a7));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 38 muls / 27 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const odd_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2;
+    res.d[0] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[1] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[2] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    res.d[3] = b3 + 2.0 * (a7 * (a4 * b0 + a5 * b1 + a6 * b2) + a2 * (a5 * b0 - a3 * b2 - a4 * b1) + a1 * (a4 * b2 - a3 * b1 - a6 * b0) + a0 * (a6 * b1 - a3 * b0 - a5 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 57 muls / 54 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const odd_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0, a7b2 = a7 * b2, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a7b0 = a7 * b0, a3b0 = a3 * b0, a5b2 = a5 * b2, a6b1 = a6 * b1,
+        a7b3 = a7 * b3, a3b1 = a3 * b1, a4b2 = a4 * b2, a6b0 = a6 * b0, a7b4 = a7 * b4,
+        a3b2 = a3 * b2, a4b1 = a4 * b1, a5b0 = a5 * b0, a7b5 = a7 * b5, a1b4 = a1 * b4,
+        a2b5 = a2 * b5, a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        s0 = a3b0 + a5b2 - a6b1 - a7b3, s1 = a3b2 + a4b1 - a5b0 - a7b5,
+        t0 = a3b1 - a4b2, t1 = t0 + a6b0, t2 = t1 - a7b4, t3 = a2b5 - a4b0, t4 = t3 - a5b1, t5 = t4 - a6b2;
+    res.d[0] = b0 + 2.0 * (a1 * (a7b2 - a1b0) + a0 * (a1 * b1 + a2 * b2) - a2 * (a2b0 + a7b1));
+    res.d[1] = b1 + 2.0 * (a2 * (a1b2 + a7b0 - a2b1) + a0 * (a1b0 - a0 * b1 - a7b2));
+    res.d[2] = b2 + 2.0 * (a1 * (a2b1 - a1b2 - a7b0) + a0 * (a2b0 + a7b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a7 * s0 + a1 * s1 - a2 * t2 - a0 * (a0 * b3 + a1b4 + t5));
+    res.d[4] = b4 + 2.0 * (a7 * t2 + a2 * s0 + a0 * (a5b0 + a7b5 - a1 * b3 - a3b2 - a4b1) - a1 * (a1b4 + t5));
+    res.d[5] = b5 + 2.0 * (a7 * s1 + a1 * (a6b1 + a7b3 - a2 * b4 - a3b0 - a5b2) + a0 * (t2 - a2 * b3) - a2 * t5);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and trivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + b3 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 38 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const odd_t& a, const trivector_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a4b3 = a4 * b3, a2b0 = a2 * b0, a5b3 = a5 * b3, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a6b3 = a6 * b3, a7b2 = a7 * b2, a1b2 = a1 * b2, a2b1 = a2 * b1, a7b0 = a7 * b0,
+        t0 = a2b0 - a5b3, t1 = t0 + a7b1, t2 = a1b0 + a6b3, t3 = t2 - a7b2, t4 = a1b2 - a2b1, t5 = t4 - a4b3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2 + a3 * b3) - a4b3 * a7 - a2 * t1 - a1 * t3);
+    res.d[1] = b1 + 2.0 * (b3 * (a1 * a3 - a5 * a7) + a2 * (t5 + a7b0) + a0 * (t3 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (b3 * (a2 * a3 - a6 * a7) + a0 * (t1 - a0 * b2) - a1 * (t5 + a7b0));
+    res.d[3] = b3 + 2.0 * (b3 * (a0 * a0 + a1 * a1 + a2 * a2 + a7 * a7));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and quadvector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁₂₃
+// -> r0 e₀₁₂₃
+// 6 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline quadvector_t operator>>(const odd_t& a, const quadvector_t& b) {
+    quadvector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0];
+    res.d[0] = b0 + 2.0 * (b0 * (a0 * a0 + a1 * a1 + a2 * a2 + a7 * a7));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and horizon  
+
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline horizon_t operator>>(const odd_t& a, const horizon_t& b) {
+
+    return horizon_t{};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and origin  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 20 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const odd_t& a, const origin_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = 2.0 * (a0 * a3 + a2 * a5 - a1 * a6 - a4 * a7);
+    res.d[1] = 2.0 * (a0 * a6 + a1 * a3 - a2 * a4 - a5 * a7);
+    res.d[2] = 2.0 * (a1 * a4 + a2 * a3 - a0 * a5 - a6 * a7);
+    res.d[3] = 1 + 2.0 * (a0 * a0 + a1 * a1 + a2 * a2 + a7 * a7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 31 muls / 28 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const odd_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0, a7b2 = a7 * b2, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a7b0 = a7 * b0,
+        t0 = a2b0 - a5, t1 = t0 + a7b1, t2 = a1b0 + a6, t3 = t2 - a7b2, t4 = a1b2 - a2b1, t5 = t4 - a4;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2 + a3) - a4 * a7 - a2 * t1 - a1 * t3);
+    res.d[1] = b1 + 2.0 * (a1 * a3 + a2 * (t5 + a7b0) + a0 * (t3 - a0 * b1) - a5 * a7);
+    res.d[2] = b2 + 2.0 * (a2 * a3 + a0 * (t1 - a0 * b2) - a6 * a7 - a1 * (t5 + a7b0));
+    res.d[3] = 1 + 2.0 * (a0 * a0 + a1 * a1 + a2 * a2 + a7 * a7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 21 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const odd_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0, a7b2 = a7 * b2, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a7b0 = a7 * b0,
+        t0 = a2b0 + a7b1, t1 = a1b0 - a7b2, t2 = a1b2 - a2b1, t3 = t2 + a7b0;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - a2 * t0 - a1 * t1);
+    res.d[1] = b1 + 2.0 * (a2 * t3 + a0 * (t1 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (t0 - a0 * b2) - a1 * t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 48 muls / 39 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const odd_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0, a7b2 = a7 * b2, a1b2 = a1 * b2,
+        a2b1 = a2 * b1, a7b0 = a7 * b0, a3b0 = a3 * b0, a5b2 = a5 * b2, a6b1 = a6 * b1,
+        a3b1 = a3 * b1, a4b2 = a4 * b2, a6b0 = a6 * b0, a3b2 = a3 * b2, a4b1 = a4 * b1,
+        a5b0 = a5 * b0, a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        t0 = a3b0 + a5b2, t1 = t0 - a6b1, t2 = a3b1 - a4b2, t3 = t2 + a6b0, t4 = a3b2 + a4b1, t5 = t4 - a5b0;
+    res.d[0] = b0 + 2.0 * (a1 * (a7b2 - a1b0) + a0 * (a1 * b1 + a2 * b2) - a2 * (a2b0 + a7b1));
+    res.d[1] = b1 + 2.0 * (a2 * (a1b2 + a7b0 - a2b1) + a0 * (a1b0 - a0 * b1 - a7b2));
+    res.d[2] = b2 + 2.0 * (a1 * (a2b1 - a1b2 - a7b0) + a0 * (a2b0 + a7b1 - a0 * b2));
+    res.d[3] = 2.0 * (a7 * t1 + a1 * t5 + a0 * (a4b0 + a5b1 + a6b2) - a2 * t3);
+    res.d[4] = 2.0 * (a7 * t3 + a2 * t1 + a1 * (a4b0 + a5b1 + a6b2) - a0 * t5);
+    res.d[5] = 2.0 * (a7 * t5 + a2 * (a4b0 + a5b1 + a6b2) + a0 * t3 - a1 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 21 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const odd_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2;
+    res.d[0] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[1] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[2] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and evector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 38 muls / 26 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const odd_t& a, const evector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2;
+    res.d[0] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[1] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[2] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    res.d[3] = 2.0 * (a7 * (a4 * b0 + a5 * b1 + a6 * b2) + a2 * (a5 * b0 - a3 * b2 - a4 * b1) + a1 * (a4 * b2 - a3 * b1 - a6 * b0) + a0 * (a6 * b1 - a3 * b0 - a5 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and dpoint  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + 1 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 38 muls / 27 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const odd_t& a, const dpoint_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2;
+    res.d[0] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[1] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[2] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    res.d[3] = 1 + 2.0 * (a7 * (a4 * b0 + a5 * b1 + a6 * b2) + a2 * (a5 * b0 - a3 * b2 - a4 * b1) + a1 * (a4 * b2 - a3 * b1 - a6 * b0) + a0 * (a6 * b1 - a3 * b0 - a5 * b2));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 54 muls / 42 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const odd_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a2b1 = a2 * b1, a7b2 = a7 * b2, a1b1 = a1 * b1, a7b3 = a7 * b3, a1b3 = a1 * b3,
+        a2b2 = a2 * b2, a7b1 = a7 * b1, a3b1 = a3 * b1, a5b3 = a5 * b3, a6b2 = a6 * b2,
+        a3b2 = a3 * b2, a4b3 = a4 * b3, a6b1 = a6 * b1, a3b3 = a3 * b3, a4b2 = a4 * b2,
+        a5b1 = a5 * b1, a4b1 = a4 * b1, a5b2 = a5 * b2, a6b3 = a6 * b3,
+        t0 = a3b1 + a5b3, t1 = t0 - a6b2, t2 = a3b2 - a4b3, t3 = t2 + a6b1, t4 = a3b3 + a4b2, t5 = t4 - a5b1;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a1 * (a7b3 - a1b1) + a0 * (a1 * b2 + a2 * b3) - a2 * (a2b1 + a7b2));
+    res.d[2] = b2 + 2.0 * (a2 * (a1b3 + a7b1 - a2b2) + a0 * (a1b1 - a0 * b2 - a7b3));
+    res.d[3] = b3 + 2.0 * (a1 * (a2b2 - a1b3 - a7b1) + a0 * (a2b1 + a7b2 - a0 * b3));
+    res.d[4] = 2.0 * (a7 * t1 + a1 * t5 + a0 * (a4b1 + a5b2 + a6b3) - a2 * t3);
+    res.d[5] = 2.0 * (a7 * t3 + a2 * t1 + a1 * (a4b1 + a5b2 + a6b3) - a0 * t5);
+    res.d[6] = 2.0 * (a7 * t5 + a2 * (a4b1 + a5b2 + a6b3) + a0 * t3 - a1 * t1);
+    res.d[7] = 2.0 * (b0 * (a0 * a4 + a1 * a5 + a2 * a6 + a3 * a7));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 26 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const odd_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2;
+    res.d[0] = 1.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[5] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[6] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    res.d[7] = 2.0 * (a0 * a4 + a1 * a5 + a2 * a6 + a3 * a7);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 70 muls / 62 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const odd_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a2b1 = a2 * b1, a7b2 = a7 * b2, a1b1 = a1 * b1, a7b3 = a7 * b3, a1b3 = a1 * b3,
+        a2b2 = a2 * b2, a7b1 = a7 * b1, a3b1 = a3 * b1, a5b3 = a5 * b3, a6b2 = a6 * b2,
+        a7b4 = a7 * b4, a3b2 = a3 * b2, a4b3 = a4 * b3, a6b1 = a6 * b1, a7b5 = a7 * b5,
+        a3b3 = a3 * b3, a4b2 = a4 * b2, a5b1 = a5 * b1, a7b6 = a7 * b6, a1b5 = a1 * b5,
+        a2b6 = a2 * b6, a4b1 = a4 * b1, a5b2 = a5 * b2, a6b3 = a6 * b3,
+        s0 = a3b1 + a5b3 - a6b2 - a7b4, s1 = a3b3 + a4b2 - a5b1 - a7b6,
+        t0 = a3b2 - a4b3, t1 = t0 + a6b1, t2 = t1 - a7b5, t3 = a2b6 - a4b1, t4 = t3 - a5b2, t5 = t4 - a6b3;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a1 * (a7b3 - a1b1) + a0 * (a1 * b2 + a2 * b3) - a2 * (a2b1 + a7b2));
+    res.d[2] = b2 + 2.0 * (a2 * (a1b3 + a7b1 - a2b2) + a0 * (a1b1 - a0 * b2 - a7b3));
+    res.d[3] = b3 + 2.0 * (a1 * (a2b2 - a1b3 - a7b1) + a0 * (a2b1 + a7b2 - a0 * b3));
+    res.d[4] = b4 + 2.0 * (a7 * s0 + a1 * s1 - a2 * t2 - a0 * (a0 * b4 + a1b5 + t5));
+    res.d[5] = b5 + 2.0 * (a7 * t2 + a2 * s0 + a0 * (a5b1 + a7b6 - a1 * b4 - a3b3 - a4b2) - a1 * (a1b5 + t5));
+    res.d[6] = b6 + 2.0 * (a7 * s1 + a1 * (a6b2 + a7b4 - a2 * b5 - a3b1 - a5b3) + a0 * (t2 - a2 * b4) - a2 * t5);
+    res.d[7] = b7 + 2.0 * (a7 * (a3 * b0 + a7 * b7) + a2 * (a2 * b7 + a6 * b0) + a1 * (a1 * b7 + a5 * b0) + a0 * (a0 * b7 + a4 * b0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between odd and odd  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀ + a4 e₀₃₂ + a5 e₀₁₃ + a6 e₀₂₁ + a7 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀ + b4 e₀₃₂ + b5 e₀₁₃ + b6 e₀₂₁ + b7 e₁₂₃
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀ + r4 e₀₃₂ + r5 e₀₁₃ + r6 e₀₂₁ + r7 e₁₂₃
+// 76 muls / 56 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline odd_t operator>>(const odd_t& a, const odd_t& b) {
+    odd_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b1 = a1 * b1, a2b2 = a2 * b2, a2b0 = a2 * b0, a7b1 = a7 * b1, a1b0 = a1 * b0,
+        a7b2 = a7 * b2, a4b7 = a4 * b7, a2b4 = a2 * b4, a5b7 = a5 * b7, a7b5 = a7 * b5,
+        a1b4 = a1 * b4, a6b7 = a6 * b7, a7b6 = a7 * b6, a1b6 = a1 * b6, a2b5 = a2 * b5,
+        a7b4 = a7 * b4,
+        s0 = a2b0 + a7b1, s1 = a1b1 + a2b2,
+        t0 = a1b0 - a7b2, t1 = a2b4 - a5b7, t2 = t1 + a7b5, t3 = a1b4 + a6b7, t4 = t3 - a7b6, t5 = a1b6 - a2b5;
+    res.d[0] = b0 + 2.0 * (a7 * (a2 * b1 - a1 * b2 - a7 * b0) - a0 * (a0 * b0 + a1b1 + a2b2));
+    res.d[1] = b1 - 2 * (a7 * s0 + a1 * s1 + a0 * t0);
+    res.d[2] = b2 + 2.0 * (a7 * t0 - a2 * s1 - a0 * s0);
+    res.d[3] = b3 + 2.0 * (a7 * (a4 * b0 + a5 * b1 + a6 * b2) + a2 * (a5 * b0 - a3 * b2 - a4 * b1) + a1 * (a4 * b2 - a3 * b1 - a6 * b0) + a0 * (a6 * b1 - a3 * b0 - a5 * b2));
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2 * b6 + a3 * b7) - a4b7 * a7 - a2 * t2 - a1 * t4);
+    res.d[5] = b5 + 2.0 * (b7 * (a1 * a3 - a5 * a7) + a2 * (t5 + a7b4 - a4b7) + a0 * (t4 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (b7 * (a2 * a3 - a6 * a7) + a1 * (a4b7 - t5 - a7b4) + a0 * (t2 - a0 * b6));
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + a1 * a1 + a2 * a2 + a7 * a7));
+    return res;
+}
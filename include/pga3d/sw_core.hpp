@@ -0,0 +1,1970 @@
+// Written by GAmphetamine.js
+// Sandwich product, points, directions and motors only
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+#include "types.hpp"
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and vector  
+// a
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const scalar_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and bivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const scalar_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and point  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const scalar_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and direction  
+// a
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const scalar_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and ebivector  
+// a
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const scalar_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and ibivector  
+// a
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const scalar_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and rotation  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const scalar_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and translation  
+// a
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const scalar_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between scalar and even  
+// a
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const scalar_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and scalar  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const vector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and vector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 11 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const vector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    res.d[3] = b3 + 2.0 * (a3 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and bivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 39 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const vector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b0 = a2 * b0, a1b4 = a1 * b4,
+        a2b5 = a2 * b5, a3b0 = a3 * b0,
+        s0 = a1b2 - a2b1,
+        t0 = a1b4 + a2b5;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2a2));
+    res.d[1] = b1 + 2.0 * (a2 * s0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2b0 - a0 * b2) - a1 * s0);
+    res.d[3] = b3 + 2.0 * (a3 * s0 - a0 * (a0 * b3 + t0));
+    res.d[4] = b4 + 2.0 * (a2b0 * a3 - a1 * t0 - a0 * (a1 * b3 + a3 * b2));
+    res.d[5] = b5 + 2.0 * (a0 * (a3 * b1 - a2 * b3) - a2a2 * b5 - a1 * (a2 * b4 + a3b0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and point  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 23 muls / 16 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const vector_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a2b2 = a2 * b2, a2b1 = a2 * b1,
+        t0 = a1a1 + a2a2, t1 = a2b2 + a3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + t1) - b0 * t0);
+    res.d[1] = b1 + 2.0 * (a1 * t1 + a0 * (a1 * b0 - a0 * b1) - a2a2 * b1);
+    res.d[2] = b2 + 2.0 * (a2 * a3 + a1 * (a2b1 - a1 * b2) + a0 * (a2 * b0 - a0 * b2));
+    res.d[3] = 1 + 2.0 * (a0 * a0 + t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and direction  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const vector_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and ebivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 25 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const vector_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a0b1 = a0 * b1, a1b0 = a1 * b0, a0b2 = a0 * b2,
+        a2b0 = a2 * b0,
+        t0 = a1b2 - a2b1, t1 = a0b1 - a1b0, t2 = a0b2 - a2b0;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 - a0 * t1);
+    res.d[2] = b2 - 2 * (a1 * t0 + a0 * t2);
+    res.d[3] = 2.0 * (a3 * t0);
+    res.d[4] = 2.0 * (-a3 * t2);
+    res.d[5] = 2.0 * (a3 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and ibivector  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const vector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and rotation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 25 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const vector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a2b2 = a2 * b2, a0b2 = a0 * b2, a1b1 = a1 * b1, a0b3 = a0 * b3,
+        a2b1 = a2 * b1,
+        t0 = a1b3 - a2b2, t1 = a0b2 - a1b1, t2 = a0b3 - a2b1;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t0 - a0 * t1);
+    res.d[3] = b3 - 2 * (a1 * t0 + a0 * t2);
+    res.d[4] = 2.0 * (a3 * t0);
+    res.d[5] = 2.0 * (-a3 * t2);
+    res.d[6] = 2.0 * (a3 * t1);
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and translation  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 9 muls / 5 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const vector_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a0b0 = a0 * b0, a1b1 = a1 * b1, a2b2 = a2 * b2,
+        t0 = a0b0 + a1b1, t1 = t0 + a2b2;
+    res.d[0] = b0 + 2.0 * (a0 * t1);
+    res.d[1] = b1 + 2.0 * (a1 * t1);
+    res.d[2] = b2 + 2.0 * (a2 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between vector and even  
+// a0 e₁ + a1 e₂ + a2 e₃ + a3 e₀
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 42 muls / 26 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const vector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b3 = a1 * b3, a2b2 = a2 * b2, a2b1 = a2 * b1,
+        a1b5 = a1 * b5, a2b6 = a2 * b6, a3b1 = a3 * b1,
+        s0 = a1b3 - a2b2,
+        t0 = a1a1 + a2a2, t1 = a1b5 + a2b6;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * t0);
+    res.d[2] = b2 + 2.0 * (a2 * s0 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2b1 - a0 * b3) - a1 * s0);
+    res.d[4] = b4 + 2.0 * (a3 * s0 - a0 * (a0 * b4 + t1));
+    res.d[5] = b5 + 2.0 * (a2b1 * a3 - a1 * t1 - a0 * (a1 * b4 + a3 * b3));
+    res.d[6] = b6 + 2.0 * (a0 * (a3 * b2 - a2 * b4) - a2a2 * b6 - a1 * (a2 * b5 + a3b1));
+    res.d[7] = b7 + 2.0 * (b7 * (a0 * a0 + t0));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 5 muls / 2 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const bivector_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5];
+    res.d[0] = b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (b * (a0 * a3 + a1 * a4 + a2 * a5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 29 muls / 17 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const bivector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3 + 2.0 * (a2 * (a3 * b1 - a4 * b0) + a1 * (a5 * b0 - a3 * b2) + a0 * (a4 * b2 - a5 * b1));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 48 muls / 37 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const bivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a2b3 = a2 * b3, a3b2 = a3 * b2, a5b0 = a5 * b0,
+        a1b3 = a1 * b3, a3b1 = a3 * b1, a4b0 = a4 * b0, a2b5 = a2 * b5, a3b0 = a3 * b0,
+        a4b1 = a4 * b1, a5b2 = a5 * b2, a2b4 = a2 * b4, a4b2 = a4 * b2, a5b1 = a5 * b1,
+        t0 = a3b0 + a4b1, t1 = t0 + a5b2, t2 = a1b2 - a2b1, t3 = a2b3 - a3b2, t4 = t3 + a5b0, t5 = a1b3 - a3b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t2 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t2);
+    res.d[3] = b3 + 2.0 * (a0 * (a1 * b4 + a2b5 + t1) - a2 * t4 - a1 * (t5 + a4b0));
+    res.d[4] = b4 + 2.0 * (a2 * (a4b2 - a2b4 - a5b1) + a1 * (a2b5 + t1) + a0 * (t5 + a4b0 - a0 * b4));
+    res.d[5] = b5 + 2.0 * (a2 * t1 + a1 * (a2b4 + a5b1 - a1 * b5 - a4b2) + a0 * (t4 - a0 * b5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 18 muls / 14 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const bivector_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a2b0 = a2 * b0, a1b0 = a1 * b0, a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a2b0 + a4, t1 = a1b0 - a5, t2 = a1b2 - a2b1, t3 = t2 + a3;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - a2 * t0 - a1 * t1);
+    res.d[1] = b1 + 2.0 * (a2 * t3 + a0 * (t1 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (t0 - a0 * b2) - a1 * t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const bivector_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 40 muls / 22 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const bivector_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1, a3b2 = a3 * b2, a5b0 = a5 * b0, a3b1 = a3 * b1,
+        a4b0 = a4 * b0, a3b0 = a3 * b0, a4b1 = a4 * b1, a5b2 = a5 * b2, a4b2 = a4 * b2,
+        a5b1 = a5 * b1,
+        t0 = a3b0 + a4b1, t1 = t0 + a5b2, t2 = a1b2 - a2b1, t3 = a3b2 - a5b0, t4 = a3b1 - a4b0, t5 = a4b2 - a5b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t2 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t2);
+    res.d[3] = 2.0 * (a2 * t3 + a1 * t4 + a0 * t1);
+    res.d[4] = 2.0 * (a2 * t5 + a1 * t1 - a0 * t4);
+    res.d[5] = 2.0 * (a2 * t1 - a1 * t5 - a0 * t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const bivector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 45 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const bivector_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a2b2 = a2 * b2, a3b3 = a3 * b3, a5b1 = a5 * b1, a3b2 = a3 * b2,
+        a4b1 = a4 * b1, a3b1 = a3 * b1, a4b2 = a4 * b2, a5b3 = a5 * b3, a4b3 = a4 * b3,
+        a5b2 = a5 * b2,
+        t0 = a3b1 + a4b2, t1 = t0 + a5b3, t2 = a1b3 - a2b2, t3 = a3b3 - a5b1, t4 = a3b2 - a4b1, t5 = a4b3 - a5b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t2 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t2);
+    res.d[4] = 2.0 * (a2 * t3 + a1 * t4 + a0 * t1);
+    res.d[5] = 2.0 * (a2 * t5 + a1 * t1 - a0 * t4);
+    res.d[6] = 2.0 * (a2 * t1 - a1 * t5 - a0 * t3);
+    res.d[7] = 2.0 * (b0 * (a0 * a3 + a1 * a4 + a2 * a5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 23 muls / 13 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const bivector_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = 1.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[5] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[6] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[7] = 2.0 * (a0 * a3 + a1 * a4 + a2 * a5);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between bivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂ + a3 e₀₁ + a4 e₀₂ + a5 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 53 muls / 40 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const bivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b3 = a1 * b3, a2b2 = a2 * b2, a2b4 = a2 * b4, a3b3 = a3 * b3, a5b1 = a5 * b1,
+        a1b4 = a1 * b4, a3b2 = a3 * b2, a4b1 = a4 * b1, a2b6 = a2 * b6, a3b1 = a3 * b1,
+        a4b2 = a4 * b2, a5b3 = a5 * b3, a2b5 = a2 * b5, a4b3 = a4 * b3, a5b2 = a5 * b2,
+        t0 = a3b1 + a4b2, t1 = t0 + a5b3, t2 = a1b3 - a2b2, t3 = a2b4 - a3b3, t4 = t3 + a5b1, t5 = a1b4 - a3b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t2 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t2);
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2b6 + t1) - a2 * t4 - a1 * (t5 + a4b1));
+    res.d[5] = b5 + 2.0 * (a2 * (a4b3 - a2b5 - a5b2) + a1 * (a2b6 + t1) + a0 * (t5 + a4b1 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (a2 * t1 + a1 * (a2b5 + a5b2 - a1 * b6 - a4b3) + a0 * (t4 - a0 * b6));
+    res.d[7] = b7 + 2.0 * (b0 * (a0 * a3 + a1 * a4 + a2 * a5));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const point_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const point_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    res.d[3] = b3 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const point_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 2.0 * (a1 * b2 - a2 * b1) - b3;
+    res.d[4] = 2.0 * (a2 * b0 - a0 * b2) - b4;
+    res.d[5] = 2.0 * (a0 * b1 - a1 * b0) - b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + r3 e₁₂₃
+// 3 muls / 4 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline trivector_t operator>>(const point_t& a, const point_t& b) {
+    trivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0 - 2 * a0;
+    res.d[1] = b1 - 2 * a1;
+    res.d[2] = b2 - 2 * a2;
+    res.d[3] = -1;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const point_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const point_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 2.0 * (a1 * b2 - a2 * b1);
+    res.d[4] = 2.0 * (a2 * b0 - a0 * b2);
+    res.d[5] = 2.0 * (a0 * b1 - a1 * b0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const point_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const point_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = 2.0 * (a1 * b3 - a2 * b2);
+    res.d[5] = 2.0 * (a2 * b1 - a0 * b3);
+    res.d[6] = 2.0 * (a0 * b2 - a1 * b1);
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const point_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = -b0;
+    res.d[1] = -b1;
+    res.d[2] = -b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between point and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁ + 1 e₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 7 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const point_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = 2.0 * (a1 * b3 - a2 * b2) - b4;
+    res.d[5] = 2.0 * (a2 * b1 - a0 * b3) - b5;
+    res.d[6] = 2.0 * (a0 * b2 - a1 * b1) - b6;
+    res.d[7] = -b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and scalar  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const direction_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and vector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const direction_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and bivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const direction_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and point  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const direction_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and direction  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const direction_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and ebivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const direction_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and ibivector  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const direction_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and rotation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const direction_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and translation  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const direction_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between direction and even  
+// a0 e₀₃₂ + a1 e₀₁₃ + a2 e₀₂₁
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const direction_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and scalar  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const ebivector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and vector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const ebivector_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and bivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 36 muls / 21 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const ebivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b2 = a1 * b2, a2b1 = a2 * b1, a1b5 = a1 * b5,
+        a2b4 = a2 * b4,
+        s0 = a1a1 + a2a2,
+        t0 = a1b2 - a2b1, t1 = a1b5 - a2b4;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * s0);
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    res.d[3] = b3 + 2.0 * (a0 * (a1 * b4 + a2 * b5) - b3 * s0);
+    res.d[4] = b4 + 2.0 * (a2 * t1 + a0 * (a1 * b3 - a0 * b4));
+    res.d[5] = b5 + 2.0 * (a0 * (a2 * b3 - a0 * b5) - a1 * t1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and point  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const ebivector_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and direction  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const ebivector_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and ebivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const ebivector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and ibivector  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const ebivector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and rotation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const ebivector_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a2b2 = a2 * b2,
+        t0 = a1b3 - a2b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * (a1 * a1 + a2 * a2));
+    res.d[2] = b2 + 2.0 * (a2 * t0 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and translation  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 19 muls / 11 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const ebivector_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a2b1 = a2 * b1,
+        t0 = a1b2 - a2b1;
+    res.d[0] = b0 + 2.0 * (a0 * (a1 * b1 + a2 * b2) - b0 * (a1 * a1 + a2 * a2));
+    res.d[1] = b1 + 2.0 * (a2 * t0 + a0 * (a1 * b0 - a0 * b1));
+    res.d[2] = b2 + 2.0 * (a0 * (a2 * b0 - a0 * b2) - a1 * t0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ebivector and even  
+// a0 e₂₃ + a1 e₃₁ + a2 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 36 muls / 21 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const ebivector_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1a1 = a1 * a1, a2a2 = a2 * a2, a1b3 = a1 * b3, a2b2 = a2 * b2, a1b6 = a1 * b6,
+        a2b5 = a2 * b5,
+        s0 = a1a1 + a2a2,
+        t0 = a1b3 - a2b2, t1 = a1b6 - a2b5;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a0 * (a1 * b2 + a2 * b3) - b1 * s0);
+    res.d[2] = b2 + 2.0 * (a2 * t0 + a0 * (a1 * b1 - a0 * b2));
+    res.d[3] = b3 + 2.0 * (a0 * (a2 * b1 - a0 * b3) - a1 * t0);
+    res.d[4] = b4 + 2.0 * (a0 * (a1 * b5 + a2 * b6) - b4 * s0);
+    res.d[5] = b5 + 2.0 * (a2 * t1 + a0 * (a1 * b4 - a0 * b5));
+    res.d[6] = b6 + 2.0 * (a0 * (a2 * b4 - a0 * b6) - a1 * t1);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and scalar  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const ibivector_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and vector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const ibivector_t& a, const vector_t& b) {
+    vector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and bivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const ibivector_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and point  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const ibivector_t& a, const point_t& b) {
+    point_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and direction  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const ibivector_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and ebivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const ibivector_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and ibivector  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const ibivector_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and rotation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const ibivector_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and translation  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const ibivector_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between ibivector and even  
+// a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const ibivector_t& a, const even_t& b) {
+    even_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4;
+    res.d[5] = b5;
+    res.d[6] = b6;
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const rotation_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const rotation_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 36 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const rotation_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1, a1b5 = a1 * b5, a3b3 = a3 * b3, a1b4 = a1 * b4, a2b3 = a2 * b3,
+        a2b5 = a2 * b5, a3b4 = a3 * b4,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1, s3 = a1b5 - a3b3, s4 = a3b4 - a2b5, s5 = a2b3 - a1b4;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3 + 2.0 * (a3 * s3 + a0 * s4 - a2 * s5);
+    res.d[4] = b4 + 2.0 * (a1 * s5 + a0 * s3 - a3 * s4);
+    res.d[5] = b5 + 2.0 * (a2 * s4 + a0 * s5 - a1 * s3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const rotation_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const rotation_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ebivector_t operator>>(const rotation_t& a, const ebivector_t& b) {
+    ebivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const rotation_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline rotation_t operator>>(const rotation_t& a, const rotation_t& b) {
+    rotation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a3b1 = a3 * b1, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b3 = a2 * b3,
+        a3b2 = a3 * b2,
+        s0 = a1b3 - a3b1, s1 = a3b2 - a2b3, s2 = a2b1 - a1b2;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[2] = b2 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[3] = b3 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const rotation_t& a, const translation_t& b) {
+    translation_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between rotation and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 36 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const rotation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b3 = a1 * b3, a3b1 = a3 * b1, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b3 = a2 * b3,
+        a3b2 = a3 * b2, a1b6 = a1 * b6, a3b4 = a3 * b4, a1b5 = a1 * b5, a2b4 = a2 * b4,
+        a2b6 = a2 * b6, a3b5 = a3 * b5,
+        s0 = a1b3 - a3b1, s1 = a3b2 - a2b3, s2 = a2b1 - a1b2, s3 = a1b6 - a3b4, s4 = a3b5 - a2b6, s5 = a2b4 - a1b5;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[2] = b2 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[3] = b3 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[4] = b4 + 2.0 * (a3 * s3 + a0 * s4 - a2 * s5);
+    res.d[5] = b5 + 2.0 * (a1 * s5 + a0 * s3 - a3 * s4);
+    res.d[6] = b6 + 2.0 * (a2 * s4 + a0 * s5 - a1 * s3);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and scalar  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b
+// -> r
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline scalar_t operator>>(const translation_t& a, const scalar_t& b) {
+
+    return b;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and vector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 4 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline vector_t operator>>(const translation_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3 + 2.0 * (a0 * b0 + a1 * b1 + a2 * b2);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and bivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const translation_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3 + 2.0 * (a2 * b1 - a1 * b2);
+    res.d[4] = b4 + 2.0 * (a0 * b2 - a2 * b0);
+    res.d[5] = b5 + 2.0 * (a1 * b0 - a0 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and point  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 3 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const translation_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0 - 2 * a0;
+    res.d[1] = b1 - 2 * a1;
+    res.d[2] = b2 - 2 * a2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and direction  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const translation_t& a, const direction_t& b) {
+    direction_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and ebivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const translation_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = 2.0 * (a2 * b1 - a1 * b2);
+    res.d[4] = 2.0 * (a0 * b2 - a2 * b0);
+    res.d[5] = 2.0 * (a1 * b0 - a0 * b1);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and ibivector  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const translation_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and rotation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const translation_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = 2.0 * (a2 * b2 - a1 * b3);
+    res.d[5] = 2.0 * (a0 * b3 - a2 * b1);
+    res.d[6] = 2.0 * (a1 * b1 - a0 * b2);
+    res.d[7] = 0.0;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and translation  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> 1 + r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 0 muls / 0 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline translation_t operator>>(const translation_t& a, const translation_t& b) {
+    translation_t res;
+    const float b0 = b.d[0], b1 = b.d[1], b2 = b.d[2];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between translation and even  
+// 1 + a0 e₀₁ + a1 e₀₂ + a2 e₀₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 9 muls / 6 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const translation_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7];
+    res.d[0] = b0;
+    res.d[1] = b1;
+    res.d[2] = b2;
+    res.d[3] = b3;
+    res.d[4] = b4 + 2.0 * (a2 * b2 - a1 * b3);
+    res.d[5] = b5 + 2.0 * (a0 * b3 - a2 * b1);
+    res.d[6] = b6 + 2.0 * (a1 * b1 - a0 * b2);
+    res.d[7] = b7;
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and scalar  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 6 muls / 3 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const even_t& a, const scalar_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7];
+    res.d[0] = b;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = 0.0;
+    res.d[5] = 0.0;
+    res.d[6] = 0.0;
+    res.d[7] = 2.0 * (b * (a0 * a7 - a1 * a4 - a2 * a5 - a3 * a6));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and vector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₁ + b1 e₂ + b2 e₃ + b3 e₀
+// -> r0 e₁ + r1 e₂ + r2 e₃ + r3 e₀
+// 35 muls / 24 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+#if !PGA3D_SIMD_KERNELS
+CONSTEXPR inline vector_t operator>>(const even_t& a, const vector_t& b) {
+    vector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3 + 2.0 * (a3 * (a4 * b1 + a7 * b2 - a5 * b0) + a2 * (a6 * b0 + a7 * b1 - a4 * b2) + a1 * (a5 * b2 + a7 * b0 - a6 * b1) + a0 * (a4 * b0 + a5 * b1 + a6 * b2));
+    return res;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and bivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂ + b3 e₀₁ + b4 e₀₂ + b5 e₀₃
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 53 muls / 47 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const even_t& a, const bivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1, a3b3 = a3 * b3, a4b2 = a4 * b2, a6b0 = a6 * b0, a7b1 = a7 * b1,
+        a2b3 = a2 * b3, a4b1 = a4 * b1, a5b0 = a5 * b0, a7b2 = a7 * b2, a3b5 = a3 * b5,
+        a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2, a2b5 = a2 * b5, a3b4 = a3 * b4,
+        a5b2 = a5 * b2, a6b1 = a6 * b1, a7b0 = a7 * b0, a1b4 = a1 * b4, a1b5 = a1 * b5,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1, s3 = a3b4 + a6b1 - a2b5 - a5b2 - a7b0, s4 = a2b3 + a5b0 - a1b4 - a4b1 - a7b2,
+        t0 = a3b3 - a4b2, t1 = t0 + a6b0, t2 = t1 + a7b1, t3 = a4b0 + a5b1, t4 = t3 + a6b2, t5 = a3b5 + t4;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = b3 + 2.0 * (a2 * (a4b1 + a7b2 - a2b3 - a5b0) + a1 * (a2 * b4 + t5) + a0 * s3 - a3 * t2);
+    res.d[4] = b4 + 2.0 * (a3 * (a5b2 + a7b0 - a3b4 - a6b1) + a2 * t5 + a1 * s4 + a0 * (a1b5 - t2));
+    res.d[5] = b5 + 2.0 * (a3 * t4 + a2 * s3 + a1 * (t2 - a1b5) + a0 * s4);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and point  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁ + 1 e₁₂₃
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁ + 1 e₁₂₃
+// 21 muls / 18 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline point_t operator>>(const even_t& a, const point_t& b) {
+    point_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0 - a5, s1 = a3b1 - a2b2 - a4, s2 = a2b0 - a1b1 - a6;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a1 * a7 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a2 * a7 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a3 * a7 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and direction  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₃₂ + b1 e₀₁₃ + b2 e₀₂₁
+// -> r0 e₀₃₂ + r1 e₀₁₃ + r2 e₀₂₁
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline direction_t operator>>(const even_t& a, const direction_t& b) {
+    direction_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and ebivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₂₃ + b1 e₃₁ + b2 e₁₂
+// -> r0 e₂₃ + r1 e₃₁ + r2 e₁₂ + r3 e₀₁ + r4 e₀₂ + r5 e₀₃
+// 45 muls / 33 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline bivector_t operator>>(const even_t& a, const ebivector_t& b) {
+    bivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1, a4b2 = a4 * b2, a6b0 = a6 * b0, a7b1 = a7 * b1, a4b1 = a4 * b1,
+        a5b0 = a5 * b0, a7b2 = a7 * b2, a4b0 = a4 * b0, a5b1 = a5 * b1, a6b2 = a6 * b2,
+        a5b2 = a5 * b2, a6b1 = a6 * b1, a7b0 = a7 * b0,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1,
+        t0 = a4b2 - a6b0, t1 = t0 - a7b1, t2 = a4b1 - a5b0, t3 = t2 + a7b2, t4 = a4b0 + a5b1, t5 = t4 + a6b2;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[3] = 2.0 * (a3 * t1 + a2 * t3 + a1 * t5 + a0 * (a6b1 - a5b2 - a7b0));
+    res.d[4] = 2.0 * (a3 * (a5b2 + a7b0 - a6b1) + a2 * t5 + a0 * t1 - a1 * t3);
+    res.d[5] = 2.0 * (a3 * t5 + a2 * (a6b1 - a5b2 - a7b0) - a1 * t1 - a0 * t3);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and ibivector  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 e₀₁ + r1 e₀₂ + r2 e₀₃
+// 18 muls / 12 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline ibivector_t operator>>(const even_t& a, const ibivector_t& b) {
+    ibivector_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[1] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[2] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and rotation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 51 muls / 36 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const even_t& a, const rotation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3],
+        a1b3 = a1 * b3, a3b1 = a3 * b1, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b3 = a2 * b3,
+        a3b2 = a3 * b2, a4b3 = a4 * b3, a6b1 = a6 * b1, a7b2 = a7 * b2, a4b2 = a4 * b2,
+        a5b1 = a5 * b1, a7b3 = a7 * b3, a4b1 = a4 * b1, a5b2 = a5 * b2, a6b3 = a6 * b3,
+        a5b3 = a5 * b3, a6b2 = a6 * b2, a7b1 = a7 * b1,
+        s0 = a1b3 - a3b1, s1 = a3b2 - a2b3, s2 = a2b1 - a1b2,
+        t0 = a4b3 - a6b1, t1 = t0 - a7b2, t2 = a4b2 - a5b1, t3 = t2 + a7b3, t4 = a4b1 + a5b2, t5 = t4 + a6b3;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[2] = b2 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[3] = b3 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[4] = 2.0 * (a3 * t1 + a2 * t3 + a1 * t5 + a0 * (a6b2 - a5b3 - a7b1));
+    res.d[5] = 2.0 * (a3 * (a5b3 + a7b1 - a6b2) + a2 * t5 + a0 * t1 - a1 * t3);
+    res.d[6] = 2.0 * (a3 * t5 + a2 * (a6b2 - a5b3 - a7b1) - a1 * t1 - a0 * t3);
+    res.d[7] = 2.0 * (b0 * (a0 * a7 - a1 * a4 - a2 * a5 - a3 * a6));
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and translation  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// 1 + b0 e₀₁ + b1 e₀₂ + b2 e₀₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 23 muls / 15 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const even_t& a, const translation_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2],
+        a1b2 = a1 * b2, a3b0 = a3 * b0, a1b1 = a1 * b1, a2b0 = a2 * b0, a2b2 = a2 * b2,
+        a3b1 = a3 * b1,
+        s0 = a1b2 - a3b0, s1 = a3b1 - a2b2, s2 = a2b0 - a1b1;
+    res.d[0] = 1.0;
+    res.d[1] = 0.0;
+    res.d[2] = 0.0;
+    res.d[3] = 0.0;
+    res.d[4] = b0 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[5] = b1 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[6] = b2 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[7] = 2.0 * (a0 * a7 - a1 * a4 - a2 * a5 - a3 * a6);
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////  
+// sw between even and even  
+// a0 + a1 e₂₃ + a2 e₃₁ + a3 e₁₂ + a4 e₀₁ + a5 e₀₂ + a6 e₀₃ + a7 e₀₁₂₃
+// b0 + b1 e₂₃ + b2 e₃₁ + b3 e₁₂ + b4 e₀₁ + b5 e₀₂ + b6 e₀₃ + b7 e₀₁₂₃
+// -> r0 + r1 e₂₃ + r2 e₃₁ + r3 e₁₂ + r4 e₀₁ + r5 e₀₂ + r6 e₀₃ + r7 e₀₁₂₃
+// 59 muls / 51 adds
+////////////////////////////////////////////////////////////////////////////////  
+
+CONSTEXPR inline even_t operator>>(const even_t& a, const even_t& b) {
+    even_t res;
+    const float a0 = a.d[0], a1 = a.d[1], a2 = a.d[2], a3 = a.d[3], a4 = a.d[4], a5 = a.d[5], a6 = a.d[6], a7 = a.d[7], b0 = b.d[0], b1 = b.d[1], b2 = b.d[2], b3 = b.d[3], b4 = b.d[4], b5 = b.d[5], b6 = b.d[6], b7 = b.d[7],
+        a1b3 = a1 * b3, a3b1 = a3 * b1, a1b2 = a1 * b2, a2b1 = a2 * b1, a2b3 = a2 * b3,
+        a3b2 = a3 * b2, a3b4 = a3 * b4, a4b3 = a4 * b3, a6b1 = a6 * b1, a7b2 = a7 * b2,
+        a2b4 = a2 * b4, a4b2 = a4 * b2, a5b1 = a5 * b1, a7b3 = a7 * b3, a3b6 = a3 * b6,
+        a4b1 = a4 * b1, a5b2 = a5 * b2, a6b3 = a6 * b3, a2b6 = a2 * b6, a3b5 = a3 * b5,
+        a5b3 = a5 * b3, a6b2 = a6 * b2, a7b1 = a7 * b1, a1b5 = a1 * b5, a1b6 = a1 * b6,
+        s0 = a1b3 - a3b1, s1 = a3b2 - a2b3, s2 = a2b1 - a1b2, s3 = a3b5 + a6b2 - a2b6 - a5b3 - a7b1, s4 = a2b4 + a5b1 - a1b5 - a4b2 - a7b3,
+        t0 = a3b4 - a4b3, t1 = t0 + a6b1, t2 = t1 + a7b2, t3 = a4b1 + a5b2, t4 = t3 + a6b3, t5 = a3b6 + t4;
+    res.d[0] = b0;
+    res.d[1] = b1 + 2.0 * (a3 * s0 + a0 * s1 - a2 * s2);
+    res.d[2] = b2 + 2.0 * (a1 * s2 + a0 * s0 - a3 * s1);
+    res.d[3] = b3 + 2.0 * (a2 * s1 + a0 * s2 - a1 * s0);
+    res.d[4] = b4 + 2.0 * (a2 * (a4b2 + a7b3 - a2b4 - a5b1) + a1 * (a2 * b5 + t5) + a0 * s3 - a3 * t2);
+    res.d[5] = b5 + 2.0 * (a3 * (a5b3 + a7b1 - a3b5 - a6b2) + a2 * t5 + a1 * s4 + a0 * (a1b6 - t2));
+    res.d[6] = b6 + 2.0 * (a3 * t4 + a2 * s3 + a1 * (t2 - a1b6) + a0 * s4);
+    res.d[7] = b7 + 2.0 * (b0 * (a0 * a7 - a1 * a4 - a2 * a5 - a3 * a6));
+    return res;
+}
@@ -0,0 +1,855 @@
+// Written by GAmphetamine.js
+// Types, basis blades and build configuration shared by every pga3d header
+// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)
+
+#pragma once
+
+/////
+// scalar          [1]
+// vector          [e1,e2,e3,e0]
+// bivector        [e23,e31,e12,e01,e02,e03]
+// trivector       [e032,e013,e021,e123]
+// quadvector      [e0123]
+// horizon         [1 e0]
+// origin          [1 e123]
+// point           [e032,e013,e021,1 e123]
+// direction       [e032,e013,e021]
+// ebivector       [e23,e31,e12]
+// ibivector       [e01,e02,e03]
+// evector         [e1,e2,e3]
+// dpoint          [e1,e2,e3,1 e0]
+// rotation        [1,e23,e31,e12]
+// translation     [e01,e02,e03,1 1]
+// even            [1,e23,e31,e12,e01,e02,e03,e0123]
+// odd             [e1,e2,e3,e0,e032,e013,e021,e123]
+/////
+
+#include <initializer_list> // For std::initializer_list
+#include <cstddef>          // For size_t
+#include <iostream>         // for printing
+#include <cmath>            // for fabs
+#include <string>           // used in printing
+
+// Constexpr if available
+#if __cplusplus >= 201703L
+    // C++17 or later
+#define CONSTEXPR constexpr
+#else
+    // older standard (e.g., C++11 or C++14)
+#define CONSTEXPR
+#endif
+
+// Optional SIMD backend, define PGA3D_SIMD before including to replace the hot 4 and 8 wide
+// products with the lane-wise kernels in simd.hpp. Falls back to scalar code when the
+// target has no SSE2. The replaced operators are not constexpr.
+#if defined(PGA3D_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PGA3D_SIMD_KERNELS 1
+#if defined(__AVX__)
+#define PGA3D_SIMD_AVX 1
+#define PGA3D_ALIGN8 alignas(32)
+#else
+#define PGA3D_SIMD_AVX 0
+#define PGA3D_ALIGN8 alignas(16)
+#endif
+#define PGA3D_ALIGN4 alignas(16)
+#else
+#define PGA3D_SIMD_KERNELS 0
+#define PGA3D_SIMD_AVX 0
+#define PGA3D_ALIGN4
+#define PGA3D_ALIGN8
+#endif
+
+// Type definition section
+
+using scalar_t = float;
+
+// VECTOR : {e1, e2, e3, e0}
+
+struct PGA3D_ALIGN4 vector_t {
+
+    // Coefficient storage
+    float d[4] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR vector_t() = default;
+    CONSTEXPR vector_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR vector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e1() const { return d[0]; }
+    CONSTEXPR const float e2() const { return d[1]; }
+    CONSTEXPR const float e3() const { return d[2]; }
+    CONSTEXPR const float e0() const { return d[3]; }
+    CONSTEXPR float& e1() { return d[0]; }
+    CONSTEXPR float& e2() { return d[1]; }
+    CONSTEXPR float& e3() { return d[2]; }
+    CONSTEXPR float& e0() { return d[3]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const vector_t& v) {
+        os << "vector_t {";
+
+        static const std::string blade_names[4] = { "e1","e2","e3","e0" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 4) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// BIVECTOR : {e23, e31, e12, e01, e02, e03}
+
+struct bivector_t {
+
+    // Coefficient storage
+    float d[6] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR bivector_t() = default;
+    CONSTEXPR bivector_t(const float(&arr)[6]) {
+        for (size_t i = 0; i < 6; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR bivector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 6; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e23() const { return d[0]; }
+    CONSTEXPR const float e31() const { return d[1]; }
+    CONSTEXPR const float e12() const { return d[2]; }
+    CONSTEXPR const float e01() const { return d[3]; }
+    CONSTEXPR const float e02() const { return d[4]; }
+    CONSTEXPR const float e03() const { return d[5]; }
+    CONSTEXPR float& e23() { return d[0]; }
+    CONSTEXPR float& e31() { return d[1]; }
+    CONSTEXPR float& e12() { return d[2]; }
+    CONSTEXPR float& e01() { return d[3]; }
+    CONSTEXPR float& e02() { return d[4]; }
+    CONSTEXPR float& e03() { return d[5]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const bivector_t& v) {
+        os << "bivector_t {";
+
+        static const std::string blade_names[6] = { "e23","e31","e12","e01","e02","e03" };
+        static const float fixed[6] = { 0.0f,0.0f,0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 6; ++i) {
+            float vv = fixed[i];
+            if (i < 6) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// TRIVECTOR : {e032, e013, e021, e123}
+
+struct trivector_t {
+
+    // Coefficient storage
+    float d[4] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR trivector_t() = default;
+    CONSTEXPR trivector_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR trivector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e032() const { return d[0]; }
+    CONSTEXPR const float e013() const { return d[1]; }
+    CONSTEXPR const float e021() const { return d[2]; }
+    CONSTEXPR const float e123() const { return d[3]; }
+    CONSTEXPR float& e032() { return d[0]; }
+    CONSTEXPR float& e013() { return d[1]; }
+    CONSTEXPR float& e021() { return d[2]; }
+    CONSTEXPR float& e123() { return d[3]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const trivector_t& v) {
+        os << "trivector_t {";
+
+        static const std::string blade_names[4] = { "e032","e013","e021","e123" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 4) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// QUADVECTOR : {e0123}
+
+struct quadvector_t {
+
+    // Coefficient storage
+    float d[1] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR quadvector_t() = default;
+    CONSTEXPR quadvector_t(const float(&arr)[1]) {
+        for (size_t i = 0; i < 1; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR quadvector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 1; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e0123() const { return d[0]; }
+    CONSTEXPR float& e0123() { return d[0]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const quadvector_t& v) {
+        os << "quadvector_t {";
+
+        static const std::string blade_names[1] = { "e0123" };
+        static const float fixed[1] = { 0.0f };
+        for (size_t i = 0; i < 1; ++i) {
+            float vv = fixed[i];
+            if (i < 1) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// HORIZON : {e0}
+
+struct horizon_t {
+
+    // Named coefficient access.
+    CONSTEXPR const float e0() const { return 1.0f; }
+
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const horizon_t& v) {
+        os << "horizon_t {";
+
+        os << "}";
+        return os;
+    }
+};
+
+// ORIGIN : {e123}
+
+struct origin_t {
+
+    // Named coefficient access.
+    CONSTEXPR const float e123() const { return 1.0f; }
+
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const origin_t& v) {
+        os << "origin_t {";
+
+        os << "}";
+        return os;
+    }
+};
+
+// POINT : {e032, e013, e021, e123}
+
+struct PGA3D_ALIGN4 point_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR point_t() = default;
+    CONSTEXPR point_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR point_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e032() const { return d[0]; }
+    CONSTEXPR const float e013() const { return d[1]; }
+    CONSTEXPR const float e021() const { return d[2]; }
+    CONSTEXPR const float e123() const { return 1.0f; }
+    CONSTEXPR float& e032() { return d[0]; }
+    CONSTEXPR float& e013() { return d[1]; }
+    CONSTEXPR float& e021() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const point_t& v) {
+        os << "point_t {";
+
+        static const std::string blade_names[4] = { "e032","e013","e021","e123" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,1.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// DIRECTION : {e032, e013, e021}
+
+struct direction_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR direction_t() = default;
+    CONSTEXPR direction_t(const float(&arr)[3]) {
+        for (size_t i = 0; i < 3; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR direction_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 3; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e032() const { return d[0]; }
+    CONSTEXPR const float e013() const { return d[1]; }
+    CONSTEXPR const float e021() const { return d[2]; }
+    CONSTEXPR float& e032() { return d[0]; }
+    CONSTEXPR float& e013() { return d[1]; }
+    CONSTEXPR float& e021() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const direction_t& v) {
+        os << "direction_t {";
+
+        static const std::string blade_names[3] = { "e032","e013","e021" };
+        static const float fixed[3] = { 0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 3; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// EBIVECTOR : {e23, e31, e12}
+
+struct ebivector_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR ebivector_t() = default;
+    CONSTEXPR ebivector_t(const float(&arr)[3]) {
+        for (size_t i = 0; i < 3; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR ebivector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 3; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e23() const { return d[0]; }
+    CONSTEXPR const float e31() const { return d[1]; }
+    CONSTEXPR const float e12() const { return d[2]; }
+    CONSTEXPR float& e23() { return d[0]; }
+    CONSTEXPR float& e31() { return d[1]; }
+    CONSTEXPR float& e12() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const ebivector_t& v) {
+        os << "ebivector_t {";
+
+        static const std::string blade_names[3] = { "e23","e31","e12" };
+        static const float fixed[3] = { 0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 3; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// IBIVECTOR : {e01, e02, e03}
+
+struct ibivector_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR ibivector_t() = default;
+    CONSTEXPR ibivector_t(const float(&arr)[3]) {
+        for (size_t i = 0; i < 3; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR ibivector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 3; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e01() const { return d[0]; }
+    CONSTEXPR const float e02() const { return d[1]; }
+    CONSTEXPR const float e03() const { return d[2]; }
+    CONSTEXPR float& e01() { return d[0]; }
+    CONSTEXPR float& e02() { return d[1]; }
+    CONSTEXPR float& e03() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const ibivector_t& v) {
+        os << "ibivector_t {";
+
+        static const std::string blade_names[3] = { "e01","e02","e03" };
+        static const float fixed[3] = { 0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 3; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// EVECTOR : {e1, e2, e3}
+
+struct evector_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR evector_t() = default;
+    CONSTEXPR evector_t(const float(&arr)[3]) {
+        for (size_t i = 0; i < 3; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR evector_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 3; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e1() const { return d[0]; }
+    CONSTEXPR const float e2() const { return d[1]; }
+    CONSTEXPR const float e3() const { return d[2]; }
+    CONSTEXPR float& e1() { return d[0]; }
+    CONSTEXPR float& e2() { return d[1]; }
+    CONSTEXPR float& e3() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const evector_t& v) {
+        os << "evector_t {";
+
+        static const std::string blade_names[3] = { "e1","e2","e3" };
+        static const float fixed[3] = { 0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 3; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// DPOINT : {e1, e2, e3, e0}
+
+struct dpoint_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR dpoint_t() = default;
+    CONSTEXPR dpoint_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR dpoint_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e1() const { return d[0]; }
+    CONSTEXPR const float e2() const { return d[1]; }
+    CONSTEXPR const float e3() const { return d[2]; }
+    CONSTEXPR const float e0() const { return 1.0f; }
+    CONSTEXPR float& e1() { return d[0]; }
+    CONSTEXPR float& e2() { return d[1]; }
+    CONSTEXPR float& e3() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const dpoint_t& v) {
+        os << "dpoint_t {";
+
+        static const std::string blade_names[4] = { "e1","e2","e3","e0" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,1.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// ROTATION : {1, e23, e31, e12}
+
+struct PGA3D_ALIGN4 rotation_t {
+
+    // Coefficient storage
+    float d[4] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR rotation_t() = default;
+    CONSTEXPR rotation_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR rotation_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float s() const { return d[0]; }
+    CONSTEXPR const float e23() const { return d[1]; }
+    CONSTEXPR const float e31() const { return d[2]; }
+    CONSTEXPR const float e12() const { return d[3]; }
+    CONSTEXPR float& s() { return d[0]; }
+    CONSTEXPR float& e23() { return d[1]; }
+    CONSTEXPR float& e31() { return d[2]; }
+    CONSTEXPR float& e12() { return d[3]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const rotation_t& v) {
+        os << "rotation_t {";
+
+        static const std::string blade_names[4] = { "1","e23","e31","e12" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 4) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// TRANSLATION : {e01, e02, e03, 1}
+
+struct translation_t {
+
+    // Coefficient storage
+    float d[3] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR translation_t() = default;
+    CONSTEXPR translation_t(const float(&arr)[4]) {
+        for (size_t i = 0; i < 4; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR translation_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 4; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e01() const { return d[0]; }
+    CONSTEXPR const float e02() const { return d[1]; }
+    CONSTEXPR const float e03() const { return d[2]; }
+    CONSTEXPR const float s() const { return 1.0f; }
+    CONSTEXPR float& e01() { return d[0]; }
+    CONSTEXPR float& e02() { return d[1]; }
+    CONSTEXPR float& e03() { return d[2]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const translation_t& v) {
+        os << "translation_t {";
+
+        static const std::string blade_names[4] = { "e01","e02","e03","1" };
+        static const float fixed[4] = { 0.0f,0.0f,0.0f,1.0f };
+        for (size_t i = 0; i < 4; ++i) {
+            float vv = fixed[i];
+            if (i < 3) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// EVEN : {1, e23, e31, e12, e01, e02, e03, e0123}
+
+struct PGA3D_ALIGN8 even_t {
+
+    // Coefficient storage
+    float d[8] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR even_t() = default;
+    CONSTEXPR even_t(const float(&arr)[8]) {
+        for (size_t i = 0; i < 8; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR even_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 8; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float s() const { return d[0]; }
+    CONSTEXPR const float e23() const { return d[1]; }
+    CONSTEXPR const float e31() const { return d[2]; }
+    CONSTEXPR const float e12() const { return d[3]; }
+    CONSTEXPR const float e01() const { return d[4]; }
+    CONSTEXPR const float e02() const { return d[5]; }
+    CONSTEXPR const float e03() const { return d[6]; }
+    CONSTEXPR const float e0123() const { return d[7]; }
+    CONSTEXPR float& s() { return d[0]; }
+    CONSTEXPR float& e23() { return d[1]; }
+    CONSTEXPR float& e31() { return d[2]; }
+    CONSTEXPR float& e12() { return d[3]; }
+    CONSTEXPR float& e01() { return d[4]; }
+    CONSTEXPR float& e02() { return d[5]; }
+    CONSTEXPR float& e03() { return d[6]; }
+    CONSTEXPR float& e0123() { return d[7]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const even_t& v) {
+        os << "even_t {";
+
+        static const std::string blade_names[8] = { "1","e23","e31","e12","e01","e02","e03","e0123" };
+        static const float fixed[8] = { 0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 8; ++i) {
+            float vv = fixed[i];
+            if (i < 8) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+// ODD : {e1, e2, e3, e0, e032, e013, e021, e123}
+
+struct PGA3D_ALIGN8 odd_t {
+
+    // Coefficient storage
+    float d[8] = { 0.0f };
+
+    // Constructors, default, from array, from initializer list.
+    CONSTEXPR odd_t() = default;
+    CONSTEXPR odd_t(const float(&arr)[8]) {
+        for (size_t i = 0; i < 8; ++i) d[i] = arr[i];
+    }
+    CONSTEXPR odd_t(std::initializer_list<float> init) {
+        size_t i = 0;
+        for (auto it = init.begin(); it != init.end() && i < 8; ++it, ++i) d[i] = *it;
+    }
+
+    // Indexed coefficient access.
+    CONSTEXPR float& operator[](size_t i) { return d[i]; }
+    CONSTEXPR const float operator[](size_t i) const { return d[i]; }
+
+    // Named coefficient access.
+    CONSTEXPR const float e1() const { return d[0]; }
+    CONSTEXPR const float e2() const { return d[1]; }
+    CONSTEXPR const float e3() const { return d[2]; }
+    CONSTEXPR const float e0() const { return d[3]; }
+    CONSTEXPR const float e032() const { return d[4]; }
+    CONSTEXPR const float e013() const { return d[5]; }
+    CONSTEXPR const float e021() const { return d[6]; }
+    CONSTEXPR const float e123() const { return d[7]; }
+    CONSTEXPR float& e1() { return d[0]; }
+    CONSTEXPR float& e2() { return d[1]; }
+    CONSTEXPR float& e3() { return d[2]; }
+    CONSTEXPR float& e0() { return d[3]; }
+    CONSTEXPR float& e032() { return d[4]; }
+    CONSTEXPR float& e013() { return d[5]; }
+    CONSTEXPR float& e021() { return d[6]; }
+    CONSTEXPR float& e123() { return d[7]; }
+
+    // Nice printing.
+    friend std::ostream& operator<<(std::ostream& os, const odd_t& v) {
+        os << "odd_t {";
+
+        static const std::string blade_names[8] = { "e1","e2","e3","e0","e032","e013","e021","e123" };
+        static const float fixed[8] = { 0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f,0.0f };
+        for (size_t i = 0; i < 8; ++i) {
+            float vv = fixed[i];
+            if (i < 8) vv += v.d[i];
+            if (vv != 0.0f) {
+                if (vv < 0.0f) os << " - "; else if (i > 0) os << " + ";
+                os << std::fabs(vv);
+                if (blade_names[i] != "1") os << blade_names[i];
+            }
+        }
+
+        os << "}";
+        return os;
+    }
+};
+
+CONSTEXPR static const evector_t e1 = { 1.0f, 0.0f, 0.0f };
+CONSTEXPR static const evector_t e2 = { 0.0f, 1.0f, 0.0f };
+CONSTEXPR static const evector_t e3 = { 0.0f, 0.0f, 1.0f };
+CONSTEXPR static const horizon_t e0;
+CONSTEXPR static const ebivector_t e23 = { 1.0f, 0.0f, 0.0f };
+CONSTEXPR static const ebivector_t e31 = { 0.0f, 1.0f, 0.0f };
+CONSTEXPR static const ebivector_t e12 = { 0.0f, 0.0f, 1.0f };
+CONSTEXPR static const ibivector_t e01 = { 1.0f, 0.0f, 0.0f };
+CONSTEXPR static const ibivector_t e02 = { 0.0f, 1.0f, 0.0f };
+CONSTEXPR static const ibivector_t e03 = { 0.0f, 0.0f, 1.0f };
+CONSTEXPR static const direction_t e032 = { 1.0f, 0.0f, 0.0f };
+CONSTEXPR static const direction_t e013 = { 0.0f, 1.0f, 0.0f };
+CONSTEXPR static const direction_t e021 = { 0.0f, 0.0f, 1.0f };
+CONSTEXPR static const origin_t e123;
+CONSTEXPR static const quadvector_t e0123 = { 1.0f };
+
+// Every type in generation order, X(type) per entry, for code that has to cover all of them
+#define PGA3D_TYPE_LIST(X) \
+    X(scalar_t) X(vector_t) X(bivector_t) X(trivector_t) X(quadvector_t) X(horizon_t) \
+    X(origin_t) X(point_t) X(direction_t) X(ebivector_t) X(ibivector_t) X(evector_t) \
+    X(dpoint_t) X(rotation_t) X(translation_t) X(even_t) X(odd_t)
+
+#if PGA3D_SIMD_KERNELS
+#include "simd.hpp"
+#endif
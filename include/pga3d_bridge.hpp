@@ -0,0 +1,61 @@
+#pragma once
+
+#include <engine/math.hpp>
+#include <framework/camera.hpp>
+
+#include <pga3d/core.hpp>
+#include <pga3d/soa.hpp>
+
+// Conversions between the engine math types and pga3d.
+// Points are x e032 + y e013 + z e021 + e123, planes ax + by + cz + d = 0 are a e1 + b e2 + c e3 + d e0,
+// motors are unit even_t applied with >> (m p ~m) and Mat4 is column major like the rest of the engine
+namespace Pga3d
+{
+    inline point_t ToPoint(const Vec3& v) { return point_t({ v.x, v.y, v.z }); }
+    inline Vec3 ToVec3(const point_t& p) { return Vec3{ p.d[0], p.d[1], p.d[2] }; }
+
+    inline direction_t ToDirection(const Vec3& v) { return direction_t({ v.x, v.y, v.z }); }
+    inline Vec3 ToVec3(const direction_t& d) { return Vec3{ d.d[0], d.d[1], d.d[2] }; }
+
+    inline vector_t ToPlane(const Vec4& plane) { return vector_t({ plane.x, plane.y, plane.z, plane.w }); }
+    inline Vec4 ToVec4(const vector_t& plane) { return Vec4{ plane.d[0], plane.d[1], plane.d[2], plane.d[3] }; }
+
+    // Rigid part of the matrix, scale and shear are not representable and must be removed first
+    even_t ToMotor(const Mat4& m);
+    Mat4 ToMat4(const even_t& motor);
+
+    void ToMat4(const even_t* motors, Mat4* out, u32 count);
+    void ToMat4(const even_soa& motors, Mat4* out);
+
+    // Camera to world motor, from the inverse view
+    inline even_t ToMotor(const Camera& camera) { return ToMotor(camera.GetInvView()); }
+
+    // Left, right, bottom, top, near, far planes of a view projection, normalized and facing inwards so
+    // ToPlane(p) ^ point is the signed distance. zeroToOne picks D3D style clip depth over GL's -1..1
+    void FrustumPlanes(const Mat4& viewProj, vector_t planes[6], bool zeroToOne = false);
+
+    // Strided view of Vec3s inside an array of structs, e.g. the positions in Terrain::Cell::vertices
+    struct PointView
+    {
+        u8* base{ nullptr };
+        u32 stride{ 0 };
+        u32 count{ 0 };
+
+        template <typename T>
+        static inline PointView Of(T* items, u32 count, Vec3 T::* member)
+        {
+            return PointView{ reinterpret_cast<u8*>(&(items->*member)), (u32)sizeof(T), count };
+        }
+
+        inline Vec3& operator[](u32 i) const { return *reinterpret_cast<Vec3*>(base + (size_t)i * stride); }
+
+        inline point_t Get(u32 i) const { return ToPoint((*this)[i]); }
+        inline void Set(u32 i, const point_t& p) const { (*this)[i] = ToVec3(p); }
+    };
+
+    void Gather(const PointView& view, points_soa& out);
+    void Scatter(const points_soa& in, const PointView& view);
+
+    // in and out may be the same view
+    void Transform(const even_t& motor, const PointView& in, const PointView& out);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+
+// Time spent in script, attributed to the "Class.method" that was called into.
+// Every call from the host into the VM is wrapped in a Scope: the call count and inclusive
+// time are counted on the main thread, and a sampling thread looks at which method is
+// currently running SampleRate times a second. The counters cost two clock reads per call,
+// the samples show where time goes inside calls that run long without a per call cost.
+// Names are registered once, next to the VM call handle, so nothing is looked up per call.
+class ScriptProfiler
+{
+public:
+    static constexpr u32 SampleRate = 1000;
+    static constexpr u32 Invalid = 0xFFFFFFFF;
+
+    struct Stat
+    {
+        String name{};
+        u32 calls{ 0 };
+        f32 ms{ 0 };
+        f32 avgMs{ 0 };
+        u32 samples{ 0 };
+    };
+
+    class Scope
+    {
+    public:
+        inline Scope(u32 id) { ScriptProfiler::Get().Enter(id); }
+        inline ~Scope() { ScriptProfiler::Get().Leave(); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    static ScriptProfiler& Get();
+
+    ScriptProfiler() = default;
+    ~ScriptProfiler();
+
+    ScriptProfiler(const ScriptProfiler&) = delete;
+    ScriptProfiler& operator=(const ScriptProfiler&) = delete;
+
+    // Starts or stops the sampling thread, Enter and Leave return straight away while disabled
+    void SetEnabled(bool enabled);
+    inline bool IsEnabled() const { return m_enabled; }
+
+    // Id for a method, the same name always returns the same id
+    u32 Register(StringView name);
+
+    void Enter(u32 id);
+    void Leave();
+
+    // Collects the counters of the frame that ended, call once per frame on the main thread
+    void EndFrame();
+
+    // Last frame, most expensive first
+    inline const List<Stat>& GetFrame() const { return m_frame; }
+    inline u32 GetFrameSamples() const { return m_frameSamples; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Counter
+    {
+        String name{};
+        u32 calls{ 0 };
+        Clock::duration time{};
+        f32 avgMs{ 0 };
+        std::atomic<u32> samples{ 0 };
+    };
+
+    struct Frame
+    {
+        u32 id{ Invalid };
+        Counter* counter{ nullptr };
+        Clock::time_point start{};
+    };
+
+    void SamplerMain();
+
+    bool m_enabled{ false };
+
+    // deque so counters keep their address as more are registered. The deque itself is only
+    // touched under m_mutex, Register can grow it from any thread. The main thread keeps the
+    // addresses in m_resolved, filled under the lock the first time an id is entered, and
+    // counts through those without locking
+    std::mutex m_mutex{};
+    std::deque<Counter> m_counters{};
+    std::unordered_map<String, u32> m_byName{};
+    List<Counter*> m_resolved{};
+
+    // Innermost method on the main thread, read by the sampler
+    std::atomic<u32> m_current{ Invalid };
+    List<Frame> m_stack{};
+
+    std::thread m_sampler{};
+    std::atomic<bool> m_sampling{ false };
+
+    List<Stat> m_frame{};
+    u32 m_frameSamples{ 0 };
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/list.hpp>
+#include <engine/graphics.hpp>
+
+#include <initializer_list>
+#include <unordered_map>
+
+// Compiled shader permutations shared by everything that renders. A permutation is a source
+// file, a stage and a set of defines ("SHADOW", "LOD_MORPH 1"), it is keyed by the define set
+// and the hash of the source text so asking for the same one again returns the same handle
+// without compiling. Source files are read once (from a mounted AssetPack when there is one)
+// until Invalidate, a file saved without changes hashes the same and isn't compiled again.
+//
+// The cache only lives in memory, every launch still compiles each permutation once.
+// Graphics::CreateShader only takes source text and the graphics layer has no way to read
+// back or load a compiled program or pipeline, so there is nothing to persist to disk yet.
+//
+// Handles are reference counted, pair every Acquire with a Release instead of destroying them.
+class ShaderCache
+{
+public:
+    static ShaderCache& Get();
+
+    ShaderCache() = default;
+
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+
+    // INVALID_GRAPHICS_HANDLE if the file can't be read or doesn't compile
+    GraphicsHandle Acquire(StringView path, ShaderType stage, std::initializer_list<StringView> defines = {});
+    void Release(GraphicsHandle shader);
+
+    // Forgets the source of path, the next Acquire reads and hashes it again
+    void Invalidate(StringView path);
+
+    // Destroys every shader, call once rendering has shut down
+    void Clear();
+
+    inline u32 GetNumShaders() const { return (u32)m_shaders.size(); }
+    inline u32 GetNumCompiles() const { return m_numCompiles; }
+
+private:
+    struct Source
+    {
+        String text{};
+        u64 hash{ 0 };
+    };
+
+    struct Shader
+    {
+        u64 key{ 0 };
+        GraphicsHandle handle{ INVALID_GRAPHICS_HANDLE };
+        u32 refs{ 0 };
+    };
+
+    const Source* GetSource(StringView path);
+
+    std::unordered_map<String, Source> m_sources{};
+
+    // Only a handful of permutations are alive at a time, searched linearly
+    List<Shader> m_shaders{};
+    u32 m_numCompiles{ 0 };
+};
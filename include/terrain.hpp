@@ -10,13 +10,39 @@
 #include <framework/image.hpp>
 #include <framework/camera.hpp>
 
-//#include <pga3d.hpp>
+#include <terrain_clipmap.hpp>
+
+#include <pga3d_bridge.hpp>
+#include <pga3d/cull.hpp>
 
 struct TerrainDrawData
 {
     Vec4 color{ 1, 1, 1, 1 };
     Vec3 lightDir{ 0, -1, 0 };
     f32 lightI{ 1 };
+    Vec4 ambient{ 0.15f, 0.15f, 0.2f, 1 };
+};
+
+// CPU time of the last frame per phase, filled by Update, RenderShadows and Render
+struct TerrainFrameStats
+{
+    f32 streamMs{ 0 };      // Clipmap baking and uploads
+    f32 lodMs{ 0 };
+    f32 cullMs{ 0 };        // Frustum planes and cell culling of the main pass
+    f32 submitMs{ 0 };      // Constant updates and draw calls, shadow cascades included
+    u32 visibleCells{ 0 };
+    u32 draws{ 0 };
+    u32 indices{ 0 };
+};
+
+struct TerrainShadowData
+{
+    static constexpr u32 NumCascades = 3;
+
+    Mat4 viewProj[NumCascades]{};
+    Vec4 splits{ 0, 0, 0, 0 };
+    Vec4 cameraPos{ 0, 0, 0, 0 };
+    Vec4 params{ 0, 0.002f, 0, 0 }; // x: enabled, y: depth bias
 };
 
 class Terrain
@@ -28,7 +54,10 @@ public:
     void Initialize();
     void Shutdown();
 
-	void Import(StringView srcPath, StringView dstPath);
+    // Recompiles terrain.shader and rebuilds both pipelines, keeps the current ones on failure
+    bool ReloadShaders();
+
+	void Import(StringView srcPath, StringView dstPath, bool bakeOcclusion = false);
 
     void OpenStream(StringView heightmapPath);
     void CloseStream();
@@ -36,20 +65,98 @@ public:
     void Update(const Camera& camera);
     void Render(const Camera& camera);
 
+    // Same as above from the camera's inverse view and projection, for tools that drive the
+    // terrain without a Camera. Only the pga3d culling path is available this way
+    void Update(const Mat4& invView);
+    void Render(const Mat4& proj, const Mat4& invView);
+
+    // Renders the shadow cascades from the camera of the last Update, must be called before the
+    // main pass binds its render targets
+    void RenderShadows();
+
+    // Without graphics no GPU resources are created and nothing is submitted, the CPU side of
+    // streaming, culling and submission still runs. Set before Initialize
+    inline void SetNullGraphics(bool nullGraphics) { m_nullGraphics = nullGraphics; }
+    inline bool IsNullGraphics() const { return m_nullGraphics; }
+
+    inline const TerrainFrameStats& GetFrameStats() const { return m_frameStats; }
+
+    // Size of the open terrain in cells
+    inline i32 GetCellsX() const { return m_cellsX; }
+    inline i32 GetCellsY() const { return m_cellsY; }
+
     inline void SetMaxCells(u32 maxCells) { m_maxCells = maxCells; }
     inline u32 GetMaxCells() const { return m_maxCells; }
 
     inline void SetViewDistance(f32 viewDistance) { m_viewDistance = viewDistance; }
     inline f32 GetViewDistance() const { return m_viewDistance; }
 
+    inline void SetShadowsEnabled(bool shadowsEnabled) { m_shadowsEnabled = shadowsEnabled; }
+    inline bool GetShadowsEnabled() const { return m_shadowsEnabled; }
+
+    inline void SetShadowDistance(f32 shadowDistance) { m_shadowDistance = shadowDistance; }
+    inline f32 GetShadowDistance() const { return m_shadowDistance; }
+
     inline GraphicsHandle GetResources() const { return m_resources; }
 
+    inline TerrainClipmap& GetClipmap() { return m_clipmap; }
+
+    struct CullBenchmark
+    {
+        u32 cells{ 0 };
+        u32 iterations{ 0 };
+        double overlapsMs{ 0 };
+        double pgaSerialMs{ 0 };
+        double pgaParallelMs{ 0 };
+        u32 overlapsVisible{ 0 };
+        u32 pgaSerialVisible{ 0 };
+        u32 pgaParallelVisible{ 0 };
+    };
+
+    // Times the current cells against the current frustum three ways: Shape::Overlaps and the
+    // pga3d box kernel cell by cell on the calling thread (the per kernel comparison), then the
+    // batched pga3d kernel spread over the job workers (what Render runs)
+    CullBenchmark BenchmarkCulling(u32 iterations);
+
+    struct RaycastHit
+    {
+        Vec3 position{};
+        Vec3 normal{};
+        f32 distance{ 0 };
+        u32 cell{ 0 };
+    };
+
+    // Nearest hit against the resident cells, walks the cell grid with a 2D DDA
+    // and each cell's min/max height pyramid
+    bool Raycast(const Vec3& origin, const Vec3& dir, f32 maxDist, RaycastHit& hit) const;
+    bool HasLineOfSight(const Vec3& from, const Vec3& to) const;
+
+    // Bilinear height and normal from the resident u16 heights, false if the cell isn't resident
+    bool SampleHeight(f32 x, f32 z, f32& height) const;
+    bool SampleNormal(f32 x, f32 z, Vec3& normal) const;
+
+    // Both of the above in one call
+    bool SampleSurface(f32 x, f32 z, f32& height, Vec3& normal) const;
+
+    // Batched versions, points are grouped by cell and interpolated with SIMD.
+    // outResident is optional and set to 0 for points over non-resident cells (their result is left zeroed),
+    // returns the number of resident points
+    u32 SampleHeights(const f32* xs, const f32* zs, u32 count, f32* outHeights, u8* outResident = nullptr) const;
+    u32 SampleNormals(const f32* xs, const f32* zs, u32 count, Vec3* outNormals, u8* outResident = nullptr) const;
+
 public:
     struct Vertex
     {
         Vec3 position;
         Vec3 normal;
         Vec3 tangent;
+        f32 occlusion;
+    };
+
+    enum FileFlags : u32
+    {
+        FILE_FLAGS_NONE = 0,
+        FILE_FLAGS_OCCLUSION = 1 << 0
     };
 
     struct MetaCell
@@ -63,13 +170,27 @@ public:
     struct Cell
     {
         static constexpr u32 Length = 128 + 1;
+        static constexpr f32 HeightScale = 1000.f / 0xFFFF;
         using HeightData = Array<u16, (Length + 2) * (Length + 2)>;
         using VertexArray = Array<Vertex, Length * Length>;
+        using OcclusionData = Array<u8, Length * Length>;
+
+        // Quadtree of per quad height bounds, level 0 is one node per quad
+        struct HeightBounds
+        {
+            f32 min;
+            f32 max;
+        };
+        static constexpr u32 NumQuads = Length - 1;
+        static constexpr u32 NumBoundsLevels = 8;
+        using HeightPyramid = Array<HeightBounds, (NumQuads * NumQuads * 4 - 1) / 3>;
 
         u32 idx{ 0 };
         Box3 aabb{};
         Vec3 center{};
         VertexArray vertices{};
+        HeightData heights{};
+        HeightPyramid heightBounds{};
         GraphicsHandle vertexBuffer{ INVALID_GRAPHICS_HANDLE };
 
         i32 lod{ 0 };
@@ -78,11 +199,51 @@ public:
     void ReadCell(u32 x, u32 y, Cell& cell);
 
 private:
+    static constexpr const char* ShaderPath = "/assets/terrain.shader";
+
+    // Cells handed to one job by the per frame passes, a multiple of box_soa::Lanes
+    static constexpr i32 CellsPerJob = 256;
+
+    // Permutations of terrain.shader, owned by the ShaderCache
+    struct ShaderSet
+    {
+        GraphicsHandle vertexShader{ INVALID_GRAPHICS_HANDLE };
+        GraphicsHandle pixelShader{ INVALID_GRAPHICS_HANDLE };
+        GraphicsHandle shadowShader{ INVALID_GRAPHICS_HANDLE };
+    };
+
+    static bool CreateShaders(ShaderSet& shaders);
+    static void ReleaseShaders(ShaderSet& shaders);
+    GraphicsHandle CreatePipeline(GraphicsHandle vertexShader, GraphicsHandle pixelShader);
+    GraphicsHandle CreateShadowPipeline(GraphicsHandle shadowShader);
+
+    template <typename CullFn>
+    void DrawCells(i32 lodBias, CullFn&& isVisible);
+
+    void UpdateCascades();
+
+    // Fills m_cellVisible from m_cullPlanes, one entry per cell, returns the number visible
+    u32 CullCells();
+
+    // Same result cell by cell on the calling thread, the reference for the batched version
+    u32 CullCellsSerial();
+
+    // Resident cell under a world position and the position in its local coordinates
+    bool FindCell(f32 x, f32 z, u32& idx, f32& lx, f32& lz) const;
+
+    template <bool Normals>
+    u32 SampleBatch(const f32* xs, const f32* zs, u32 count, f32* outHeights, Vec3* outNormals, u8* outResident) const;
+
+    bool RaycastCell(const Cell& cell, i32 cx, i32 cy, const Vec3& origin, const Vec3& dir, f32 tMin, f32 tMax, RaycastHit& hit) const;
+
     template <typename T>
 	friend class EditorInspector;
 
     InputFileStream m_fileStream{};
 
+    bool m_nullGraphics{ false };
+    TerrainFrameStats m_frameStats{};
+
     TerrainDrawData m_drawData{};
     GraphicsHandle m_drawBuffer{ INVALID_GRAPHICS_HANDLE };
 
@@ -103,10 +264,44 @@ private:
     };
     IndexBuffer m_indexBuffers[8]{};
 
+    struct ShadowCascade
+    {
+        GraphicsHandle depthTexture{ INVALID_GRAPHICS_HANDLE };
+        Vec3 center{};
+        f32 radius{ 0 };
+        i32 lodBias{ 0 };
+        bool dirty{ true };
+    };
+
+    static constexpr u32 ShadowMapSize = 2048;
+
+    TerrainShadowData m_shadowData{};
+    GraphicsHandle m_shadowBuffer{ INVALID_GRAPHICS_HANDLE };
+    GraphicsHandle m_cascadeBuffer{ INVALID_GRAPHICS_HANDLE };
+
+    GraphicsHandle m_shadowShader{ INVALID_GRAPHICS_HANDLE };
+    GraphicsHandle m_shadowPipeline{ INVALID_GRAPHICS_HANDLE };
+    GraphicsHandle m_shadowResources{ INVALID_GRAPHICS_HANDLE };
+
+    u32 m_shaderWatch{ 0 };
+
+    ShadowCascade m_cascades[TerrainShadowData::NumCascades]{};
+    Vec3 m_lightRight{};
+    Vec3 m_lightUp{};
+    Vec3 m_lightForward{};
+
+    TerrainClipmap m_clipmap{};
+    GraphicsHandle m_clipmapBuffer{ INVALID_GRAPHICS_HANDLE };
+
+    bool m_shadowsEnabled{ true };
+    f32 m_shadowDistance{ 800.f };
+    f32 m_shadowDepthRange{ 2000.f };
+
     i32 m_lod{ -1 };
     
     i32 m_cellsX{ 0 };
     i32 m_cellsY{ 0 };
+    u32 m_fileFlags{ FILE_FLAGS_NONE };
     u32 m_maxCells{ 33 };
     f32 m_viewDistance{ 1000.f };
 
@@ -116,6 +311,16 @@ private:
     bool m_debugDraw{ false };
     bool m_updateFrustum{ true };
     bool m_updateCamera{ true };
-    Frustrum m_frustum{};
+    Frustrum m_frustum{};   // From the camera, only BenchmarkCulling tests against it
     Vec3 m_cameraPos{};
+
+    // Frustum planes in camera space, moved to world space by the camera motor.
+    // Without pga culling the cells are tested one by one instead of in batches on the jobs
+    bool m_pgaCulling{ true };
+    Mat4 m_cullProj{};
+    vector_t m_viewPlanes[6]{};
+    vector_t m_cullPlanes[6]{};
+    even_t m_cameraMotor{};
+    box_soa m_cellBoxes{};
+    List<u8> m_cellVisible{};
 };
\ No newline at end of file
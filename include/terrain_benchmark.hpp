@@ -0,0 +1,31 @@
+#pragma once
+
+#include <engine/string.hpp>
+
+// Headless terrain benchmark, started from the command line instead of the game:
+//   SkyPi --benchmark <terrain.bin> [--frames N] [--warmup N] [--threads N] [--csv <path>]
+// Terrain runs without graphics and a camera flies a fixed figure eight over the whole file.
+// Every frame is timed per phase (streaming, LOD, culling, submission) and a summary is
+// printed at the end, --csv also writes one line per frame. The path and the frame step don't
+// depend on wall time, two runs over the same file do the same work.
+class TerrainBenchmark
+{
+public:
+    struct Options
+    {
+        String terrainPath{};
+        String csvPath{};
+        u32 frames{ 1800 };
+        u32 warmup{ 120 };      // Flown but not recorded
+        i32 threads{ -1 };      // Job workers, -1 for one per core, 0 runs every job on the main thread
+        f32 altitude{ 120.f };  // Above the ground under the camera
+        f32 fov{ 60.f };
+        f32 aspect{ 16.f / 9.f };
+    };
+
+    // false when --benchmark isn't on the command line
+    static bool ParseArgs(int argc, char** args, Options& options);
+
+    // Process exit code
+    static int Run(const Options& options);
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <engine/string.hpp>
+#include <engine/array.hpp>
+#include <engine/list.hpp>
+#include <engine/graphics.hpp>
+#include <engine/math.hpp>
+
+class Terrain;
+
+struct TerrainMaterialLayer
+{
+    String texturePath{};
+    f32 tiling{ 0.25f };        // Texture repeats per world unit
+    f32 minHeight{ 0.f };
+    f32 maxHeight{ 1000.f };
+    f32 minSlope{ 0.f };        // 0 is flat, 1 is vertical
+    f32 maxSlope{ 1.f };
+    f32 blend{ 0.1f };          // Soft falloff outside of the height/slope ranges
+};
+
+struct TerrainClipmapData
+{
+    static constexpr u32 NumLevels = 6;
+
+    // xy: texel coordinate of the resident window's first column and row, z: texels per world
+    // unit, w: 1 once the level is baked (the shader skips the others)
+    Vec4 levels[NumLevels]{};
+    Vec4 params{ 0, 0, 0, 0 };  // x: enabled, y: level size in texels, z: num levels
+};
+
+// Virtual texture clipmap around the camera, material layers are blended (triplanar on steep slopes)
+// into a toroidal cache atlas on the CPU as the camera moves so the pixel shader does a single fetch
+class TerrainClipmap
+{
+public:
+    static constexpr u32 MaxLayers = 8;
+    static constexpr u32 LevelSize = 1024;
+    static constexpr u32 UpdateStep = 16;
+
+    // Without the texture the levels are still baked on the CPU but nothing is uploaded, for
+    // running without graphics
+    void Initialize(bool createTexture = true);
+    void Shutdown();
+
+    void AddLayer(const TerrainMaterialLayer& layer);
+    inline u32 GetNumLayers() const { return (u32)m_layers.size(); }
+
+    void Invalidate();
+
+    // Only the texels over bounds (world space, xz) are baked again, for cells that were read
+    void Invalidate(const Box3& bounds);
+
+    void Update(const Terrain& terrain, const Vec3& cameraPos);
+
+    inline GraphicsHandle GetTexture() const { return m_texture; }
+    inline const TerrainClipmapData& GetData() const { return m_data; }
+
+    inline void SetEnabled(bool enabled) { m_enabled = enabled; }
+    inline bool GetEnabled() const { return m_enabled; }
+
+    inline void SetTexelBudget(u32 texelBudget) { m_texelBudget = texelBudget; }
+    inline u32 GetTexelBudget() const { return m_texelBudget; }
+
+    // Texels per world unit of the finest level, every further level has half. The coarsest level
+    // spans LevelSize / (baseDensity / 32) units, 512 at the default of 64, past that the shader
+    // falls back to the tiled Albedo texture. Lower it to cover a longer view distance
+    void SetBaseDensity(f32 baseDensity);
+    inline f32 GetBaseDensity() const { return m_baseDensity; }
+
+private:
+    template <typename T>
+    friend class EditorInspector;
+
+    struct MipImage
+    {
+        i32 width{ 0 };
+        i32 height{ 0 };
+        List<u32> texels{};
+    };
+
+    struct Layer
+    {
+        TerrainMaterialLayer desc{};
+        List<MipImage> mips{};
+    };
+
+    struct Level
+    {
+        f32 density{ 0 };           // Texels per world unit
+        i32 originX{ 0 };           // Texel coordinate of the resident window's first column
+        i32 originZ{ 0 };
+        bool valid{ false };
+        List<u32> texels{};         // Toroidal CPU copy, LevelSize * LevelSize
+
+        // Texels to bake again, [min, max) in texel coordinates, only while dirty
+        bool dirty{ false };
+        i32 dirtyMinX{ 0 };
+        i32 dirtyMinZ{ 0 };
+        i32 dirtyMaxX{ 0 };
+        i32 dirtyMaxZ{ 0 };
+    };
+
+    u32 BakeTexel(const Terrain& terrain, const Level& level, i32 tx, i32 tz) const;
+    void BakeColumns(const Terrain& terrain, u32 levelIdx, i32 fromX, i32 toX, bool parallel);
+    void BakeRows(const Terrain& terrain, u32 levelIdx, i32 fromZ, i32 toZ);
+    void BakeDirty(const Terrain& terrain, u32 levelIdx);
+    void Upload(u32 levelIdx, u32 x, u32 y, u32 width, u32 height);
+
+    List<Layer> m_layers{};
+    Level m_levels[TerrainClipmapData::NumLevels]{};
+
+    TerrainClipmapData m_data{};
+    GraphicsHandle m_texture{ INVALID_GRAPHICS_HANDLE };
+
+    bool m_enabled{ true };
+    u32 m_texelBudget{ LevelSize * UpdateStep * 4 };
+    f32 m_baseDensity{ 64.f };
+    List<u32> m_uploadScratch{};
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <entity_store.hpp>
+
+typedef struct WrenVM WrenVM;
+typedef void (*WrenForeignMethodFn)(WrenVM* vm);
+
+// Bulk queries over the units of an EntityStore for scripts, module "units" (units.wren):
+//   Units.count      number of units
+//   Units.positions  [x0, y0, z0, x1, y1, z1, ...] of every unit
+// One call returns the whole set so scripts never call back into the host per unit.
+// The script host's foreign method lookup has to forward to Bind. That host lives in the engine and
+// doesn't yet, until it does importing units.wren fails to bind the foreign methods.
+class UnitBindings
+{
+public:
+    // Store the methods read, without one they return 0 and an empty list
+    static void SetStore(EntityStore* store);
+
+    // Foreign method of the units module, nullptr for anything else
+    static WrenForeignMethodFn Bind(const char* module, const char* className, bool isStatic, const char* signature);
+};
@@ -0,0 +1,59 @@
+#include <asset_metadata.hpp>
+#include <asset_pack.hpp>
+
+#include <engine/file.hpp>
+
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// Metadata is written first so it is always near the top of the file,
+// only this much is read before deciding what to do with the asset
+static constexpr u32 MetadataPeekSize = 1024;
+
+static const char* FindValue(const char* buffer, const char* key)
+{
+    const char* it = std::strstr(buffer, key);
+    if (it == nullptr)
+        return nullptr;
+
+    it = std::strchr(it + std::strlen(key), ':');
+    return it != nullptr ? it + 1 : nullptr;
+}
+
+AssetMetadata AssetMetadata::Peek(StringView path)
+{
+    AssetMetadata metadata{};
+    char buffer[MetadataPeekSize + 1]{};
+
+    AssetPack::Blob blob{};
+    if (AssetPack::Resolve(path, blob))
+    {
+        const size_t size = (size_t)std::min<u64>(blob.size, MetadataPeekSize);
+        std::memcpy(buffer, blob.data, size);
+    }
+    else
+    {
+        const auto filepath = File::Get().GetPath(path);
+        std::ifstream file(filepath.c_str(), std::ios::in | std::ios::binary);
+        if (!file.is_open())
+            return metadata;
+
+        file.read(buffer, MetadataPeekSize);
+        buffer[file.gcount()] = 0;
+    }
+
+    if (const char* uuid = FindValue(buffer, "\"uuid\""))
+        metadata.uuid = std::strtoull(uuid, nullptr, 10);
+
+    if (const char* type = FindValue(buffer, "\"type\""))
+    {
+        const char* begin = std::strchr(type, '"');
+        const char* end = begin != nullptr ? std::strchr(begin + 1, '"') : nullptr;
+        if (end != nullptr)
+            metadata.type = String(begin + 1, end - begin - 1);
+    }
+
+    return metadata;
+}
@@ -0,0 +1,419 @@
+#include <asset_pack.hpp>
+
+#include <asset_metadata.hpp>
+#include <cooked_asset.hpp>
+
+#include <engine/file.hpp>
+#include <engine/debug.hpp>
+
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <memory>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static List<std::unique_ptr<AssetPack>>& GetMounted()
+{
+    static List<std::unique_ptr<AssetPack>> s_mounted;
+    return s_mounted;
+}
+
+static u64 AlignUp(u64 value, u64 alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+u64 AssetPack::HashPath(StringView path)
+{
+    // FNV-1a
+    u64 hash = 0xCBF29CE484222325ull;
+    for (char c : path)
+    {
+        hash ^= (u8)c;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+bool AssetPack::Open(StringView path)
+{
+    Close();
+
+    const auto filepath = File::Get().GetPath(path);
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* base = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (base == nullptr)
+    {
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_size = (u64)size.QuadPart;
+#else
+    const i32 file = open(filepath.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat info{};
+    fstat(file, &info);
+
+    void* base = info.st_size > 0 ? mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    if (base == MAP_FAILED)
+    {
+        close(file);
+        return false;
+    }
+
+    m_file = file;
+    m_size = (u64)info.st_size;
+#endif
+
+    m_base = (const u8*)base;
+    m_header = (const AssetPackHeader*)m_base;
+
+    // Reject anything whose index doesn't fit in the file
+    const auto isValid = [&]()
+    {
+        if (m_size < sizeof(AssetPackHeader) || m_header->magic != AssetPackHeader::Magic || m_header->version != AssetPackHeader::Version)
+            return false;
+
+        const u64 indexEnd = sizeof(AssetPackHeader) + (u64)m_header->numEntries * sizeof(AssetPackEntry) + (u64)m_header->numUuids * sizeof(AssetPackUuid);
+        if (indexEnd > m_header->namesOffset || m_header->namesOffset > m_size || m_header->namesSize > m_size - m_header->namesOffset)
+            return false;
+
+        // Every entry once here so lookups can trust the index, sizes are compared against
+        // what's left so a corrupt offset can't overflow the sum
+        const auto* entries = (const AssetPackEntry*)(m_base + sizeof(AssetPackHeader));
+        for (u32 i = 0; i < m_header->numEntries; ++i)
+        {
+            const auto& entry = entries[i];
+            if (entry.offset > m_size || entry.size > m_size - entry.offset)
+                return false;
+            if (entry.nameOffset > m_header->namesSize || entry.nameLength > m_header->namesSize - entry.nameOffset)
+                return false;
+        }
+
+        const auto* uuids = (const AssetPackUuid*)(entries + m_header->numEntries);
+        for (u32 i = 0; i < m_header->numUuids; ++i)
+        {
+            if (uuids[i].entry >= m_header->numEntries)
+                return false;
+        }
+        return true;
+    };
+
+    if (!isValid())
+    {
+        BX_LOGE(Log, "Invalid asset pack: {}", filepath.c_str());
+        Close();
+        return false;
+    }
+
+    m_entries = (const AssetPackEntry*)(m_base + sizeof(AssetPackHeader));
+    m_uuids = (const AssetPackUuid*)(m_entries + m_header->numEntries);
+    m_names = (const char*)(m_base + m_header->namesOffset);
+    return true;
+}
+
+void AssetPack::Close()
+{
+    if (m_base == nullptr)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_base);
+    CloseHandle((HANDLE)m_mapping);
+    CloseHandle((HANDLE)m_file);
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    munmap((void*)m_base, (size_t)m_size);
+    close(m_file);
+    m_file = -1;
+#endif
+
+    m_base = nullptr;
+    m_size = 0;
+    m_header = nullptr;
+    m_entries = nullptr;
+    m_uuids = nullptr;
+    m_names = nullptr;
+}
+
+StringView AssetPack::GetName(const AssetPackEntry& entry) const
+{
+    return StringView(m_names + entry.nameOffset, entry.nameLength);
+}
+
+bool AssetPack::Find(StringView path, Blob& blob) const
+{
+    if (m_base == nullptr)
+        return false;
+
+    const u64 hash = HashPath(path);
+    const AssetPackEntry* end = m_entries + m_header->numEntries;
+    const AssetPackEntry* it = std::lower_bound(m_entries, end, hash, [](const AssetPackEntry& entry, u64 value) { return entry.pathHash < value; });
+
+    // Equal hashes are adjacent, the name settles collisions
+    for (; it != end && it->pathHash == hash; ++it)
+    {
+        if (GetName(*it) == path)
+        {
+            blob.data = m_base + it->offset;
+            blob.size = it->size;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AssetPack::Find(u64 uuid, Blob& blob) const
+{
+    if (m_base == nullptr)
+        return false;
+
+    const AssetPackUuid* end = m_uuids + m_header->numUuids;
+    const AssetPackUuid* it = std::lower_bound(m_uuids, end, uuid, [](const AssetPackUuid& entry, u64 value) { return entry.uuid < value; });
+    if (it == end || it->uuid != uuid)
+        return false;
+
+    const auto& entry = m_entries[it->entry];
+    blob.data = m_base + entry.offset;
+    blob.size = entry.size;
+    return true;
+}
+
+bool AssetPack::Mount(StringView path)
+{
+    auto pack = std::make_unique<AssetPack>();
+    if (!pack->Open(path))
+        return false;
+
+    BX_LOGI(Log, "Mounted asset pack {} ({} files)", path, pack->GetNumEntries());
+    GetMounted().emplace_back(std::move(pack));
+    return true;
+}
+
+void AssetPack::UnmountAll()
+{
+    GetMounted().clear();
+}
+
+bool AssetPack::Resolve(StringView path, Blob& blob)
+{
+    for (const auto& pack : GetMounted())
+    {
+        if (pack->Find(path, blob))
+            return true;
+    }
+    return false;
+}
+
+bool AssetPack::Resolve(u64 uuid, Blob& blob)
+{
+    for (const auto& pack : GetMounted())
+    {
+        if (pack->Find(uuid, blob))
+            return true;
+    }
+    return false;
+}
+
+bool AssetPackBuilder::Add(StringView path)
+{
+    PackedFile file{};
+    file.path = String(path);
+    file.filepath = String(File::Get().GetPath(path).c_str());
+
+    std::error_code ec{};
+    file.size = (u64)std::filesystem::file_size(file.filepath.c_str(), ec);
+    if (ec)
+    {
+        BX_LOGE(Log, "Failed to pack {}: {}", path, ec.message());
+        return false;
+    }
+
+    const std::filesystem::path ext = std::filesystem::path(file.filepath.c_str()).extension();
+    if (ext == ".json")
+    {
+        file.uuid = AssetMetadata::Peek(path).uuid;
+    }
+    else if (ext == ".cooked")
+    {
+        CookedAssetHeader header{};
+        std::ifstream stream(file.filepath.c_str(), std::ios::in | std::ios::binary);
+        if (stream.read((char*)&header, sizeof(header)) && header.magic == CookedAssetHeader::Magic)
+            file.uuid = header.uuid;
+    }
+
+    m_files.emplace_back(std::move(file));
+    return true;
+}
+
+u32 AssetPackBuilder::AddDirectory(StringView dir)
+{
+    namespace fs = std::filesystem;
+
+    const auto root = File::Get().GetPath(dir);
+    std::error_code ec{};
+
+    u32 count = 0;
+    for (const auto& entry : fs::recursive_directory_iterator(root.c_str(), ec))
+    {
+        // Terrain is streamed with file reads, it stays loose
+        const auto ext = entry.path().extension();
+        if (!entry.is_regular_file() || ext == ".pak" || ext == ".bin")
+            continue;
+
+        const String path = String(dir) + "/" + fs::relative(entry.path(), root.c_str()).generic_string();
+
+        // JSON is only parsed from files, the pack carries it for the cooked image's metadata
+        if (ext == ".json" && !CookedAsset::IsFresh(path))
+        {
+            BX_LOGI(Log, "Not packing {}, it has no cooked image and loads from the loose file", path);
+            continue;
+        }
+
+        if (Add(path))
+            ++count;
+    }
+    return count;
+}
+
+bool AssetPackBuilder::Build(StringView dstPath, u32 alignment) const
+{
+    alignment = std::max(alignment, 16u);
+
+    // Index sorted by path hash, the uuid table by uuid. A cooked image wins over its JSON
+    // source so uuid lookups land on the fast path
+    List<u32> order(m_files.size());
+    for (u32 i = 0; i < (u32)order.size(); ++i)
+        order[i] = i;
+
+    List<u64> hashes(m_files.size());
+    for (u32 i = 0; i < (u32)m_files.size(); ++i)
+        hashes[i] = AssetPack::HashPath(m_files[i].path);
+
+    std::sort(order.begin(), order.end(), [&](u32 a, u32 b)
+    {
+        return hashes[a] != hashes[b] ? hashes[a] < hashes[b] : m_files[a].path < m_files[b].path;
+    });
+
+    List<AssetPackEntry> entries(order.size());
+    List<AssetPackUuid> uuids{};
+    String names{};
+    for (u32 i = 0; i < (u32)order.size(); ++i)
+    {
+        const auto& file = m_files[order[i]];
+        auto& entry = entries[i];
+        entry.pathHash = hashes[order[i]];
+        entry.size = file.size;
+        entry.nameOffset = (u32)names.size();
+        entry.nameLength = (u32)file.path.size();
+        names += file.path;
+
+        if (file.uuid != 0)
+            uuids.emplace_back(AssetPackUuid{ file.uuid, i, 0 });
+    }
+
+    const auto isCooked = [&](u32 entry)
+    {
+        const String& path = m_files[order[entry]].path;
+        return path.size() > 7 && path.compare(path.size() - 7, 7, ".cooked") == 0;
+    };
+
+    std::sort(uuids.begin(), uuids.end(), [&](const AssetPackUuid& a, const AssetPackUuid& b)
+    {
+        if (a.uuid != b.uuid)
+            return a.uuid < b.uuid;
+        return isCooked(a.entry) && !isCooked(b.entry);
+    });
+    uuids.erase(std::unique(uuids.begin(), uuids.end(), [](const AssetPackUuid& a, const AssetPackUuid& b) { return a.uuid == b.uuid; }), uuids.end());
+
+    AssetPackHeader header{};
+    header.numEntries = (u32)entries.size();
+    header.numUuids = (u32)uuids.size();
+    header.alignment = alignment;
+    header.namesOffset = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry) + uuids.size() * sizeof(AssetPackUuid);
+    header.namesSize = names.size();
+
+    u64 offset = AlignUp(header.namesOffset + header.namesSize, alignment);
+    for (auto& entry : entries)
+    {
+        entry.offset = offset;
+        offset = AlignUp(offset + entry.size, alignment);
+    }
+
+    const auto filepath = File::Get().GetPath(dstPath);
+    std::ofstream out(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        BX_LOGE(Log, "Failed to write asset pack: {}", filepath.c_str());
+        return false;
+    }
+
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)entries.data(), entries.size() * sizeof(AssetPackEntry));
+    out.write((const char*)uuids.data(), uuids.size() * sizeof(AssetPackUuid));
+    out.write(names.data(), names.size());
+
+    List<char> buffer(1 << 20);
+    for (u32 i = 0; i < (u32)entries.size(); ++i)
+    {
+        // Zero padding up to the aligned offset
+        const u64 pos = (u64)out.tellp();
+        if (entries[i].offset > pos)
+        {
+            const List<char> padding(entries[i].offset - pos, 0);
+            out.write(padding.data(), padding.size());
+        }
+
+        std::ifstream in(m_files[order[i]].filepath.c_str(), std::ios::in | std::ios::binary);
+        u64 remaining = entries[i].size;
+        while (remaining > 0 && in)
+        {
+            const u64 chunk = std::min<u64>(remaining, buffer.size());
+            in.read(buffer.data(), chunk);
+            out.write(buffer.data(), in.gcount());
+            remaining -= (u64)in.gcount();
+        }
+
+        if (remaining != 0)
+        {
+            BX_LOGE(Log, "Failed to read {} while packing", m_files[order[i]].path);
+            return false;
+        }
+    }
+
+    BX_LOGI(Log, "Built asset pack {}: {} files, {} uuids, {} bytes", dstPath, header.numEntries, header.numUuids, (u64)out.tellp());
+    return out.good();
+}
@@ -0,0 +1,465 @@
+#include <asset_service.hpp>
+
+#include <asset_metadata.hpp>
+#include <asset_pack.hpp>
+
+#include <engine/file.hpp>
+#include <engine/guard.hpp>
+#include <engine/debug.hpp>
+
+#include <filesystem>
+
+static u64 GetSourceSize(StringView path)
+{
+    AssetPack::Blob blob{};
+    if (AssetPack::Resolve(path, blob))
+        return blob.size;
+
+    std::error_code ec{};
+    const auto size = std::filesystem::file_size(File::Get().GetPath(path).c_str(), ec);
+    return ec ? 0 : (u64)size;
+}
+
+AssetService& AssetService::Get()
+{
+    static AssetService s_instance;
+    return s_instance;
+}
+
+AssetService::~AssetService()
+{
+    Shutdown();
+}
+
+AssetHandle AssetService::Request(StringView path, LoadFn load)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    String key(path);
+    auto it = m_byPath.find(key);
+    if (it != m_byPath.end())
+    {
+        const u32 id = Resolve(it->second);
+        if (m_entries[id].state == State::Evicted)
+            Reload(id);
+
+        // Repeat requests of a loaded asset only take a reference
+        Acquire(id);
+        return AssetHandle{ it->second };
+    }
+
+    const u32 id = (u32)m_entries.size();
+    auto& entry = m_entries.emplace_back();
+    entry.path = key;
+    entry.refs = 1;
+    entry.load = std::move(load);
+
+    m_byPath.emplace(std::move(key), id);
+    m_pending.emplace_back(id);
+    entry.queued = true;
+    ++m_inFlight;
+
+    return AssetHandle{ id };
+}
+
+void AssetService::Release(AssetHandle handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (handle.id >= m_entries.size())
+        return;
+
+    const u32 id = Resolve(handle.id);
+    auto& entry = m_entries[id];
+    BX_ENSURE(entry.refs > 0);
+
+    if (--entry.refs == 0 && entry.state == State::Ready)
+        Cache(id);
+}
+
+void AssetService::Refresh(StringView path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_byPath.find(String(path));
+    if (it == m_byPath.end())
+        return;
+
+    const u32 id = Resolve(it->second);
+    auto& entry = m_entries[id];
+    if (entry.state != State::Ready || entry.refreshing || entry.queued)
+        return;
+
+    entry.refreshing = true;
+    entry.queued = true;
+    m_pending.emplace_back(id);
+    ++m_inFlight;
+}
+
+void AssetService::Dispatch()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    DispatchLocked();
+}
+
+void AssetService::DispatchLocked()
+{
+    if (m_pending.empty())
+        return;
+
+    if (m_workers.empty() && !m_stop)
+    {
+        const u32 numThreads = std::thread::hardware_concurrency();
+        const u32 numWorkers = numThreads > 1 ? numThreads - 1 : 1;
+        for (u32 i = 0; i < numWorkers; ++i)
+            m_workers.emplace_back([this]() { WorkerMain(); });
+    }
+
+    for (u32 id : m_pending)
+    {
+        // Refreshed entries are Ready and keep serving the old data while they load
+        if (m_entries[id].state == State::Pending)
+            m_entries[id].state = State::Queued;
+        m_queue.push_back(id);
+    }
+    m_pending.clear();
+
+    // One wake up for the whole batch
+    m_workCv.notify_all();
+}
+
+void AssetService::Update()
+{
+    Dispatch();
+
+    List<std::pair<Entry*, List<ReadyFn>>> ready{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Swapped in place between frames, nobody sees a half loaded asset
+        for (u32 id : m_refreshed)
+        {
+            auto& entry = m_entries[id];
+            if (entry.staged && entry.state == State::Ready)
+            {
+                const u64 bytes = GetSourceSize(entry.path);
+                *entry.asset = std::move(*entry.staged);
+                m_residentBytes = m_residentBytes - entry.bytes + bytes;
+                entry.bytes = bytes;
+            }
+            entry.staged.reset();
+            entry.refreshing = false;
+        }
+        m_refreshed.clear();
+
+        for (u32 id : m_completed)
+        {
+            auto& entry = m_entries[Resolve(id)];
+            if (entry.callbacks.empty() || entry.state != State::Ready)
+                continue;
+
+            ready.emplace_back(&entry, std::move(entry.callbacks));
+            entry.callbacks.clear();
+        }
+        m_completed.clear();
+    }
+
+    // Outside the lock so callbacks can request more assets
+    for (auto& [entry, callbacks] : ready)
+    {
+        for (auto& callback : callbacks)
+            callback(*entry->asset);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Trim();
+}
+
+bool AssetService::IsReady(AssetHandle handle) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (handle.id >= m_entries.size())
+        return false;
+
+    return m_entries[Resolve(handle.id)].state == State::Ready;
+}
+
+bool AssetService::IsFailed(AssetHandle handle) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (handle.id >= m_entries.size())
+        return true;
+
+    return m_entries[Resolve(handle.id)].state == State::Failed;
+}
+
+u64 AssetService::GetResidentBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_residentBytes;
+}
+
+Asset* AssetService::Get(AssetHandle handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (handle.id >= m_entries.size())
+        return nullptr;
+
+    auto& entry = m_entries[Resolve(handle.id)];
+    return entry.state == State::Ready ? &*entry.asset : nullptr;
+}
+
+bool AssetService::Wait(AssetHandle handle)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (handle.id >= m_entries.size())
+        return false;
+
+    if (m_entries[Resolve(handle.id)].state == State::Evicted)
+        Reload(Resolve(handle.id));
+    DispatchLocked();
+
+    m_doneCv.wait(lock, [&]()
+    {
+        const State state = m_entries[Resolve(handle.id)].state;
+        return state == State::Ready || state == State::Failed;
+    });
+
+    return m_entries[Resolve(handle.id)].state == State::Ready;
+}
+
+void AssetService::WaitAll()
+{
+    Dispatch();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCv.wait(lock, [&]() { return m_inFlight == 0; });
+}
+
+void AssetService::Then(AssetHandle handle, ReadyFn callback)
+{
+    Asset* asset = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle.id >= m_entries.size())
+            return;
+
+        const u32 id = Resolve(handle.id);
+        auto& entry = m_entries[id];
+        if (entry.state == State::Failed)
+            return;
+
+        if (entry.state == State::Evicted)
+            Reload(id);
+
+        if (entry.state != State::Ready)
+        {
+            entry.callbacks.emplace_back(std::move(callback));
+            return;
+        }
+        asset = &*entry.asset;
+    }
+
+    callback(*asset);
+}
+
+void AssetService::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_workCv.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+void AssetService::WorkerMain()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_workCv.wait(lock, [&]() { return m_stop || !m_queue.empty(); });
+
+        // Queued work is finished before stopping so nobody waits forever
+        if (m_queue.empty())
+            return;
+
+        const u32 id = m_queue.front();
+        m_queue.pop_front();
+        Entry& entry = m_entries[id];
+        entry.queued = false;
+
+        // Routed by state, the refreshing flag outlives evictions. A refresh of an entry evicted
+        // since has nothing to update, one that was reloaded since does the full load below
+        if (entry.state == State::Evicted)
+        {
+            entry.refreshing = false;
+            --m_inFlight;
+            m_doneCv.notify_all();
+            continue;
+        }
+
+        if (entry.state == State::Ready)
+        {
+            lock.unlock();
+            ProcessRefresh(entry);
+            lock.lock();
+
+            m_refreshed.emplace_back(id);
+            --m_inFlight;
+            m_doneCv.notify_all();
+            continue;
+        }
+
+        entry.refreshing = false;
+
+        lock.unlock();
+        Process(id, entry);
+        lock.lock();
+
+        // Everyone may have released it while it was loading
+        if (entry.state == State::Ready && entry.alias == AssetHandle::Invalid)
+        {
+            m_residentBytes += entry.bytes;
+            if (entry.refs == 0)
+                Cache(id);
+        }
+
+        m_completed.emplace_back(id);
+        --m_inFlight;
+        m_doneCv.notify_all();
+    }
+}
+
+void AssetService::Process(u32 id, Entry& entry)
+{
+    // Another path already holds this uuid, resolve to it instead of parsing again
+    const u64 uuid = AssetMetadata::Peek(entry.path).uuid;
+    if (uuid != 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry.uuid = uuid;
+
+        auto it = m_byUuid.find(uuid);
+        if (it != m_byUuid.end() && it->second != id)
+        {
+            // Callbacks follow the alias and fire when the other load completes
+            auto& target = m_entries[it->second];
+            for (auto& callback : entry.callbacks)
+                target.callbacks.emplace_back(std::move(callback));
+            entry.callbacks.clear();
+
+            // References held on this path now count towards the other one
+            target.refs += entry.refs;
+            if (target.refs > 0)
+                Uncache(it->second);
+            entry.refs = 0;
+
+            if (target.state == State::Evicted)
+            {
+                Reload(it->second);
+                DispatchLocked();
+            }
+
+            entry.alias = it->second;
+            entry.state = State::Ready;
+            return;
+        }
+        m_byUuid.emplace(uuid, id);
+    }
+
+    try
+    {
+        Asset asset = entry.load(entry.path);
+        const u64 bytes = GetSourceSize(entry.path);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry.asset.emplace(std::move(asset));
+        entry.bytes = bytes;
+        entry.state = State::Ready;
+    }
+    catch (const std::exception& e)
+    {
+        BX_LOGE(Log, "Failed to load asset {}: {}", entry.path, e.what());
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry.state = State::Failed;
+    }
+}
+
+void AssetService::ProcessRefresh(Entry& entry)
+{
+    // A broken edit keeps the previous data
+    try
+    {
+        Asset asset = entry.load(entry.path);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry.staged.emplace(std::move(asset));
+    }
+    catch (const std::exception& e)
+    {
+        BX_LOGE(Log, "Failed to reload asset {}: {}", entry.path, e.what());
+    }
+}
+
+u32 AssetService::Resolve(u32 id) const
+{
+    while (m_entries[id].alias != AssetHandle::Invalid)
+        id = m_entries[id].alias;
+    return id;
+}
+
+void AssetService::Acquire(u32 id)
+{
+    ++m_entries[id].refs;
+    Uncache(id);
+}
+
+void AssetService::Cache(u32 id)
+{
+    auto& entry = m_entries[id];
+    if (entry.cached)
+        return;
+
+    entry.lru = m_lru.insert(m_lru.end(), id);
+    entry.cached = true;
+}
+
+void AssetService::Uncache(u32 id)
+{
+    auto& entry = m_entries[id];
+    if (!entry.cached)
+        return;
+
+    m_lru.erase(entry.lru);
+    entry.cached = false;
+}
+
+void AssetService::Reload(u32 id)
+{
+    auto& entry = m_entries[id];
+    entry.state = State::Pending;
+    if (entry.queued)
+        return;
+
+    entry.queued = true;
+    m_pending.emplace_back(id);
+    ++m_inFlight;
+}
+
+void AssetService::Trim()
+{
+    while (m_residentBytes > m_budget && !m_lru.empty())
+    {
+        const u32 id = m_lru.front();
+        m_lru.pop_front();
+
+        auto& entry = m_entries[id];
+        entry.cached = false;
+        entry.asset.reset();
+        entry.state = State::Evicted;
+        m_residentBytes -= entry.bytes;
+    }
+}
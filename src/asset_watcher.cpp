@@ -0,0 +1,290 @@
+#include <asset_watcher.hpp>
+
+#include <engine/file.hpp>
+#include <engine/debug.hpp>
+
+#include <filesystem>
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+// Editors write in several steps, wait for the file to settle before reporting it
+static constexpr auto SettleTime = std::chrono::milliseconds(100);
+
+#ifndef __linux__
+static constexpr auto ScanInterval = std::chrono::milliseconds(500);
+#endif
+
+AssetWatcher& AssetWatcher::Get()
+{
+    static AssetWatcher s_instance;
+    return s_instance;
+}
+
+AssetWatcher::~AssetWatcher()
+{
+    Shutdown();
+}
+
+String AssetWatcher::Canonical(StringView filepath)
+{
+    std::error_code ec{};
+    const auto path = std::filesystem::weakly_canonical(std::filesystem::path(String(filepath)), ec);
+    return ec ? String(filepath) : String(path.generic_string());
+}
+
+bool AssetWatcher::Watch(StringView dir)
+{
+    Root root{};
+    root.path = String(dir);
+    root.filepath = Canonical(File::Get().GetPath(dir).c_str());
+
+    std::error_code ec{};
+    if (!std::filesystem::is_directory(root.filepath.c_str(), ec))
+    {
+        BX_LOGE(Log, "Can't watch {}, not a directory", dir);
+        return false;
+    }
+
+#ifdef __linux__
+    if (m_inotify < 0)
+    {
+        m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_inotify < 0)
+        {
+            BX_LOGE(Log, "Failed to initialize inotify");
+            return false;
+        }
+    }
+    AddWatches(root.filepath);
+#endif
+
+    m_roots.emplace_back(std::move(root));
+
+#ifndef __linux__
+    // Baseline so files that existed before aren't reported
+    Scan(false);
+#endif
+
+    BX_LOGI(Log, "Watching {} for changes", dir);
+    return true;
+}
+
+u32 AssetWatcher::Subscribe(StringView path, ChangeFn callback)
+{
+    Subscription subscription{};
+    subscription.id = m_nextId++;
+    subscription.filepath = Canonical(File::Get().GetPath(path).c_str());
+    subscription.callback = std::move(callback);
+
+    m_subscriptions.emplace_back(std::move(subscription));
+    return m_subscriptions.back().id;
+}
+
+u32 AssetWatcher::SubscribeAll(ChangeFn callback)
+{
+    Subscription subscription{};
+    subscription.id = m_nextId++;
+    subscription.callback = std::move(callback);
+
+    m_subscriptions.emplace_back(std::move(subscription));
+    return m_subscriptions.back().id;
+}
+
+void AssetWatcher::Unsubscribe(u32 id)
+{
+    m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(),
+        [id](const Subscription& subscription) { return subscription.id == id; }), m_subscriptions.end());
+}
+
+void AssetWatcher::Update()
+{
+    if (m_roots.empty())
+        return;
+
+    Poll();
+
+    // Settled files, in path order so dependent reloads run the same way every time
+    const auto now = Clock::now();
+    List<String> settled{};
+    for (auto it = m_changed.begin(); it != m_changed.end();)
+    {
+        if (now - it->second < SettleTime)
+        {
+            ++it;
+            continue;
+        }
+
+        settled.emplace_back(it->first);
+        it = m_changed.erase(it);
+    }
+    std::sort(settled.begin(), settled.end());
+
+    for (const auto& filepath : settled)
+    {
+        // Back to the form the root was watched with
+        String path{};
+        for (const auto& root : m_roots)
+        {
+            if (filepath.size() > root.filepath.size() && filepath[root.filepath.size()] == '/' &&
+                filepath.compare(0, root.filepath.size(), root.filepath) == 0)
+            {
+                path = root.path + filepath.substr(root.filepath.size());
+                break;
+            }
+        }
+
+        BX_LOGI(Log, "Asset changed: {}", path);
+
+        // Copied so callbacks can subscribe or unsubscribe
+        const auto subscriptions = m_subscriptions;
+        for (const auto& subscription : subscriptions)
+        {
+            if (subscription.filepath.empty() || subscription.filepath == filepath)
+                subscription.callback(path);
+        }
+    }
+}
+
+void AssetWatcher::Shutdown()
+{
+#ifdef __linux__
+    if (m_inotify >= 0)
+        close(m_inotify);
+    m_inotify = -1;
+    m_watches.clear();
+#else
+    m_modified.clear();
+#endif
+
+    m_roots.clear();
+    m_changed.clear();
+}
+
+void AssetWatcher::Changed(const String& filepath)
+{
+    m_changed[filepath] = Clock::now();
+}
+
+#ifdef __linux__
+
+void AssetWatcher::AddWatches(const String& dir)
+{
+    // inotify isn't recursive, every directory gets its own watch
+    constexpr u32 Mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE_SELF;
+
+    const i32 wd = inotify_add_watch(m_inotify, dir.c_str(), Mask);
+    if (wd < 0)
+    {
+        BX_LOGE(Log, "Failed to watch {}", dir);
+        return;
+    }
+    m_watches[wd] = dir;
+
+    std::error_code ec{};
+    for (const auto& entry : std::filesystem::directory_iterator(dir.c_str(), ec))
+    {
+        if (entry.is_directory(ec))
+            AddWatches(String(entry.path().generic_string()));
+    }
+}
+
+void AssetWatcher::Poll()
+{
+    alignas(inotify_event) char buffer[4096];
+    while (true)
+    {
+        const ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+        if (length <= 0)
+            return;
+
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const auto* event = (const inotify_event*)(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_IGNORED)
+            {
+                m_watches.erase(event->wd);
+                continue;
+            }
+
+            auto it = m_watches.find(event->wd);
+            if (it == m_watches.end() || event->len == 0)
+                continue;
+
+            const String filepath = it->second + "/" + event->name;
+            if (event->mask & IN_ISDIR)
+            {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    AddWatches(filepath);
+
+                    // Anything written before the watch existed would be missed otherwise
+                    std::error_code ec{};
+                    for (const auto& entry : std::filesystem::recursive_directory_iterator(filepath.c_str(), ec))
+                    {
+                        if (entry.is_regular_file(ec))
+                            Changed(String(entry.path().generic_string()));
+                    }
+                }
+                continue;
+            }
+
+            // Creation alone is followed by a close once the contents are written
+            if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                Changed(filepath);
+        }
+    }
+}
+
+#else
+
+void AssetWatcher::Poll()
+{
+    const auto now = Clock::now();
+    if (now - m_lastScan < ScanInterval)
+        return;
+
+    m_lastScan = now;
+    Scan(true);
+}
+
+void AssetWatcher::Scan(bool report)
+{
+    namespace fs = std::filesystem;
+
+    for (const auto& root : m_roots)
+    {
+        std::error_code ec{};
+        for (const auto& entry : fs::recursive_directory_iterator(root.filepath.c_str(), ec))
+        {
+            if (!entry.is_regular_file(ec))
+                continue;
+
+            const auto modified = entry.last_write_time(ec);
+            if (ec)
+                continue;
+
+            const String filepath(entry.path().generic_string());
+            auto it = m_modified.find(filepath);
+            if (it == m_modified.end())
+            {
+                m_modified.emplace(filepath, modified);
+                if (report)
+                    Changed(filepath);
+            }
+            else if (it->second != modified)
+            {
+                it->second = modified;
+                Changed(filepath);
+            }
+        }
+    }
+}
+
+#endif
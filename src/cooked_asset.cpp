@@ -0,0 +1,317 @@
+#include <cooked_asset.hpp>
+#include <asset_pack.hpp>
+
+#include <engine/file.hpp>
+#include <engine/debug.hpp>
+
+#include <fstream>
+#include <filesystem>
+#include <cstdint>
+
+// Property types the reflected layout stores inline, anything else makes the type uncookable
+#define COOKED_ASSET_ARITHMETIC_TYPES(X) \
+    X(bool) X(char) X(int8_t) X(uint8_t) X(int16_t) X(uint16_t) \
+    X(int32_t) X(uint32_t) X(int64_t) X(uint64_t) X(float) X(double)
+
+static u64 HashBytes(u64 hash, const void* data, size_t size)
+{
+    // FNV-1a
+    const u8* bytes = (const u8*)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static u64 HashString(u64 hash, const std::string& str)
+{
+    return HashBytes(hash, str.data(), str.size() + 1);
+}
+
+static bool IsString(const rttr::type& type)
+{
+    return type == rttr::type::get<std::string>();
+}
+
+static bool IsNested(const rttr::type& type)
+{
+    return type.is_class() && !IsString(type) && !type.get_properties().empty();
+}
+
+template <typename V>
+static void Append(List<u8>& out, const V& value)
+{
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(V));
+    std::memcpy(out.data() + offset, &value, sizeof(V));
+}
+
+struct CookedReader
+{
+    const List<u8>& data;
+    const List<u8>& strings;
+    size_t offset{ 0 };
+
+    template <typename V>
+    bool Read(V& value)
+    {
+        if (offset + sizeof(V) > data.size())
+            return false;
+
+        std::memcpy(&value, data.data() + offset, sizeof(V));
+        offset += sizeof(V);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        u32 begin = 0, length = 0;
+        if (!Read(begin) || !Read(length) || (size_t)begin + length > strings.size())
+            return false;
+
+        value.assign((const char*)strings.data() + begin, length);
+        return true;
+    }
+};
+
+static bool PackObject(const rttr::instance& object, const rttr::type& type, List<u8>& data, List<u8>& strings)
+{
+    for (const auto& prop : type.get_properties())
+    {
+        const auto propType = prop.get_type();
+        const auto value = prop.get_value(object);
+
+#define COOKED_ASSET_PACK(V)                       \
+        if (propType == rttr::type::get<V>())      \
+        {                                          \
+            Append(data, value.get_value<V>());    \
+            continue;                              \
+        }
+        COOKED_ASSET_ARITHMETIC_TYPES(COOKED_ASSET_PACK)
+#undef COOKED_ASSET_PACK
+
+        if (IsString(propType))
+        {
+            // Offset and length into the string pool, patched back into a string on load
+            const auto& str = value.get_value<std::string>();
+            Append(data, (u32)strings.size());
+            Append(data, (u32)str.size());
+            strings.insert(strings.end(), str.begin(), str.end());
+            continue;
+        }
+
+        if (IsNested(propType))
+        {
+            if (!PackObject(rttr::instance(value), propType, data, strings))
+                return false;
+            continue;
+        }
+
+        BX_LOGE(Log, "Can't cook property {}::{} of type {}", type.get_name().to_string(), prop.get_name().to_string(), propType.get_name().to_string());
+        return false;
+    }
+    return true;
+}
+
+static bool UnpackObject(const rttr::instance& object, const rttr::type& type, CookedReader& reader)
+{
+    for (const auto& prop : type.get_properties())
+    {
+        const auto propType = prop.get_type();
+
+#define COOKED_ASSET_UNPACK(V)                                      \
+        if (propType == rttr::type::get<V>())                       \
+        {                                                           \
+            V value{};                                              \
+            if (!reader.Read(value) || !prop.set_value(object, value)) \
+                return false;                                       \
+            continue;                                               \
+        }
+        COOKED_ASSET_ARITHMETIC_TYPES(COOKED_ASSET_UNPACK)
+#undef COOKED_ASSET_UNPACK
+
+        if (IsString(propType))
+        {
+            std::string value{};
+            if (!reader.ReadString(value) || !prop.set_value(object, value))
+                return false;
+            continue;
+        }
+
+        if (IsNested(propType))
+        {
+            // Nested values are copies, fill one in and write it back
+            auto value = prop.get_value(object);
+            if (!UnpackObject(rttr::instance(value), propType, reader) || !prop.set_value(object, value))
+                return false;
+            continue;
+        }
+
+        return false;
+    }
+    return true;
+}
+
+static u64 HashLayout(u64 hash, const rttr::type& type)
+{
+    for (const auto& prop : type.get_properties())
+    {
+        const auto propType = prop.get_type();
+        hash = HashString(hash, prop.get_name().to_string());
+        hash = HashString(hash, propType.get_name().to_string());
+        if (IsNested(propType))
+            hash = HashLayout(hash, propType);
+    }
+    return hash;
+}
+
+std::unordered_map<String, CookedAsset::CookFn>& CookedAsset::GetRegistry()
+{
+    static std::unordered_map<String, CookFn> s_registry;
+    return s_registry;
+}
+
+u64 CookedAsset::TypeHash(const rttr::type& type, u32 size, bool raw)
+{
+    u64 hash = 0xCBF29CE484222325ull;
+    hash = HashString(hash, type.get_name().to_string());
+    hash = HashBytes(hash, &size, sizeof(size));
+    hash = HashBytes(hash, &raw, sizeof(raw));
+    if (!raw)
+        hash = HashLayout(hash, type);
+    return hash;
+}
+
+String CookedAsset::GetCookedPath(StringView srcPath)
+{
+    return String(srcPath) + ".cooked";
+}
+
+bool CookedAsset::IsFresh(StringView srcPath)
+{
+    namespace fs = std::filesystem;
+
+    const auto src = File::Get().GetPath(srcPath);
+    const auto dst = File::Get().GetPath(GetCookedPath(srcPath));
+
+    std::error_code ec{};
+    const auto dstTime = fs::last_write_time(dst.c_str(), ec);
+    if (ec)
+        return false;
+
+    const auto srcTime = fs::last_write_time(src.c_str(), ec);
+    return ec || dstTime >= srcTime;
+}
+
+bool CookedAsset::Write(StringView srcPath, const CookedAssetHeader& header, const List<u8>& data, const List<u8>& strings)
+{
+    const auto filepath = File::Get().GetPath(GetCookedPath(srcPath));
+    std::ofstream file(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        BX_LOGE(Log, "Failed to write cooked asset: {}", filepath.c_str());
+        return false;
+    }
+
+    CookedAssetHeader out = header;
+    out.dataSize = (u32)data.size();
+    out.stringsSize = (u32)strings.size();
+
+    file.write((const char*)&out, sizeof(out));
+    file.write((const char*)data.data(), data.size());
+    file.write((const char*)strings.data(), strings.size());
+    return file.good();
+}
+
+static bool IsValid(const CookedAssetHeader& header, u64 typeHash)
+{
+    return header.magic == CookedAssetHeader::Magic && header.version == CookedAssetHeader::Version && header.typeHash == typeHash;
+}
+
+bool CookedAsset::Read(StringView srcPath, u64 typeHash, CookedAssetHeader& header, List<u8>& data, List<u8>& strings)
+{
+    // Mounted packs are shipped builds, their images are taken as is without touching the disk
+    AssetPack::Blob blob{};
+    if (AssetPack::Resolve(GetCookedPath(srcPath), blob))
+    {
+        if (blob.size < sizeof(header))
+            return false;
+
+        std::memcpy(&header, blob.data, sizeof(header));
+        if (!IsValid(header, typeHash) || sizeof(header) + (u64)header.dataSize + header.stringsSize > blob.size)
+            return false;
+
+        const u8* data0 = blob.data + sizeof(header);
+        data.assign(data0, data0 + header.dataSize);
+        strings.assign(data0 + header.dataSize, data0 + header.dataSize + header.stringsSize);
+        return true;
+    }
+
+    if (!IsFresh(srcPath))
+        return false;
+
+    const auto filepath = File::Get().GetPath(GetCookedPath(srcPath));
+    std::ifstream file(filepath.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    if (!file.read((char*)&header, sizeof(header)) || !IsValid(header, typeHash))
+        return false;
+
+    data.resize(header.dataSize);
+    strings.resize(header.stringsSize);
+    file.read((char*)data.data(), data.size());
+    file.read((char*)strings.data(), strings.size());
+    return file.good();
+}
+
+bool CookedAsset::Pack(const rttr::instance& object, const rttr::type& type, List<u8>& data, List<u8>& strings)
+{
+    return PackObject(object, type, data, strings);
+}
+
+bool CookedAsset::Unpack(const rttr::instance& object, const rttr::type& type, const List<u8>& data, const List<u8>& strings)
+{
+    CookedReader reader{ data, strings };
+    return UnpackObject(object, type, reader) && reader.offset == data.size();
+}
+
+bool CookedAsset::Cook(StringView srcPath)
+{
+    const auto metadata = AssetMetadata::Peek(srcPath);
+
+    const auto& registry = GetRegistry();
+    auto it = registry.find(metadata.type);
+    if (it == registry.end())
+        return false;
+
+    return it->second(srcPath);
+}
+
+u32 CookedAsset::CookAll(StringView dir)
+{
+    namespace fs = std::filesystem;
+
+    const auto root = File::Get().GetPath(dir);
+    std::error_code ec{};
+
+    u32 count = 0;
+    for (const auto& entry : fs::recursive_directory_iterator(root.c_str(), ec))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".json")
+            continue;
+
+        // Back to an engine path so the asset resolves the same way at runtime
+        const String path = String(dir) + "/" + fs::relative(entry.path(), root.c_str()).generic_string();
+        if (IsFresh(path))
+            continue;
+
+        if (Cook(path))
+            ++count;
+    }
+
+    BX_LOGI(Log, "Cooked {} assets in {}", count, dir);
+    return count;
+}
@@ -2,8 +2,12 @@
 
 #include <engine/engine.hpp>
 
+#include <cooked_asset.hpp>
+#include <asset_pack.hpp>
+
 void SkyPiEditor::Configure()
 {
+    m_game.m_mountPacks = false;
     m_game.Configure();
 }
 
@@ -29,4 +33,47 @@ void SkyPiEditor::Shutdown()
 
 void SkyPiEditor::OnMainMenuBarGui()
 {
+    if (ImGui::BeginMenu("Assets"))
+    {
+        // JSON stays the source, stale or missing .cooked files are rewritten
+        if (ImGui::MenuItem("Cook All"))
+            CookedAsset::CookAll("[assets]");
+
+        // Cooks first so the pack carries up to date images next to their sources
+        if (ImGui::MenuItem("Build Pack"))
+        {
+            CookedAsset::CookAll("[assets]");
+
+            AssetPackBuilder builder{};
+            builder.AddDirectory("[assets]");
+            builder.Build("[assets]/assets.pak");
+        }
+
+        ImGui::EndMenu();
+    }
+
+    // Test population for the unit systems, the game itself starts empty
+    if (ImGui::BeginMenu("Units"))
+    {
+        if (ImGui::MenuItem("Spawn Grid"))
+            m_game.SpawnUnits();
+
+        if (ImGui::MenuItem("Clear"))
+            m_game.m_entities.Clear();
+
+        ImGui::EndMenu();
+    }
+
+    if (ImGui::BeginMenu("Views"))
+    {
+        ImGui::MenuItem("Script Profiler", nullptr, &m_showScriptProfiler);
+        ImGui::EndMenu();
+    }
+
+    if (m_showScriptProfiler)
+    {
+        if (ImGui::Begin("Script Profiler", &m_showScriptProfiler))
+            m_scriptProfilerView.OnGui(*this);
+        ImGui::End();
+    }
 }
\ No newline at end of file
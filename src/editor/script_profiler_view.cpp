@@ -0,0 +1,67 @@
+#include <editor/script_profiler_view.hpp>
+
+#include <algorithm>
+
+EditorInspector<ScriptProfiler>::EditorInspector(ScriptProfiler& profiler)
+    : m_profiler(profiler)
+{
+    SetTitle("Script Profiler");
+}
+
+void EditorInspector<ScriptProfiler>::OnGui(EditorApplication& app)
+{
+    bool enabled = m_profiler.IsEnabled();
+    ImGui::Text("Enabled: ");
+    ImGui::SameLine();
+    if (ImGui::Checkbox("##ProfilerEnabled", &enabled))
+        m_profiler.SetEnabled(enabled);
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Pause", &m_paused);
+
+    ImGui::Text("Rows: ");
+    ImGui::SameLine();
+    ImGui::SliderInt("##ProfilerRows", &m_maxRows, 5, 100);
+
+    // Paused keeps the last frame on screen to read it
+    if (!m_paused)
+    {
+        m_stats = m_profiler.GetFrame();
+        m_samples = m_profiler.GetFrameSamples();
+    }
+
+    f32 totalMs = 0;
+    for (const auto& stat : m_stats)
+        totalMs += stat.ms;
+    ImGui::Text("Frame: %.3f ms in script, %u samples", totalMs, m_samples);
+
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    if (ImGui::BeginTable("##ScriptProfile", 5, flags))
+    {
+        ImGui::TableSetupColumn("Method");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("ms");
+        ImGui::TableSetupColumn("Avg ms");
+        ImGui::TableSetupColumn("Samples %");
+        ImGui::TableHeadersRow();
+
+        const u32 rows = std::min((u32)m_stats.size(), (u32)m_maxRows);
+        for (u32 i = 0; i < rows; ++i)
+        {
+            const auto& stat = m_stats[i];
+            ImGui::TableNextRow();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(stat.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", stat.calls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stat.ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stat.avgMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", m_samples > 0 ? 100.f * stat.samples / m_samples : 0.f);
+        }
+        ImGui::EndTable();
+    }
+}
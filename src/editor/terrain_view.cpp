@@ -1,4 +1,5 @@
 #include <editor/terrain_view.hpp>
+#include <job_system.hpp>
 #include <engine/time.hpp>
 
 //EDITOR_MENUITEM("Views/Terrain", []() { LOGI(Terrain, "HelloWorld!"); })
@@ -31,9 +32,13 @@ void EditorInspector<Terrain>::OnGui(EditorApplication& app)
         ImGui::SameLine();
         ImGui::InputText("##HeightmapDstPath", m_heightmapDstPath.data(), m_heightmapDstPath.size());
 
+        ImGui::Text("Bake Occlusion: ");
+        ImGui::SameLine();
+        ImGui::Checkbox("##BakeOcclusion", &m_bakeOcclusion);
+
         if (ImGui::Button("Import"))
         {
-            m_terrain.Import(m_heightmapSrcPath, m_heightmapDstPath);
+            m_terrain.Import(m_heightmapSrcPath, m_heightmapDstPath, m_bakeOcclusion);
         }
         
         ImGui::SameLine();
@@ -83,6 +88,38 @@ void EditorInspector<Terrain>::OnInspectGui(Terrain& terrain)
     ImGui::SameLine();
     ImGui::InputFloat("##LightI", &terrain.m_drawData.lightI);
 
+    ImGui::Text("Ambient: ");
+    ImGui::SameLine();
+    ImGui::ColorEdit3("##Ambient", &terrain.m_drawData.ambient[0]);
+
+    ImGui::SeparatorText("Texturing");
+
+    ImGui::Text("Clipmap: ");
+    ImGui::SameLine();
+    ImGui::Checkbox("##ClipmapEnabled", &terrain.m_clipmap.m_enabled);
+
+    ImGui::Text("Clipmap Density: ");
+    ImGui::SameLine();
+    f32 baseDensity = terrain.m_clipmap.GetBaseDensity();
+    if (ImGui::InputFloat("##ClipmapDensity", &baseDensity, 0.0f, 0.0f, "%.1f", ImGuiInputTextFlags_EnterReturnsTrue) && baseDensity > 0.f)
+        terrain.m_clipmap.SetBaseDensity(baseDensity);
+
+    ImGui::Text("Clipmap Layers: %u", terrain.m_clipmap.GetNumLayers());
+
+    ImGui::SeparatorText("Shadows");
+
+    ImGui::Text("Enabled: ");
+    ImGui::SameLine();
+    ImGui::Checkbox("##ShadowsEnabled", &terrain.m_shadowsEnabled);
+
+    ImGui::Text("Distance: ");
+    ImGui::SameLine();
+    ImGui::InputFloat("##ShadowDistance", &terrain.m_shadowDistance);
+
+    ImGui::Text("Depth Bias: ");
+    ImGui::SameLine();
+    ImGui::InputFloat("##ShadowBias", &terrain.m_shadowData.params.y, 0.0f, 0.0f, "%.5f");
+
     ImGui::SeparatorText("Debug");
     
     ImGui::Text("Debug Draw: ");
@@ -100,4 +137,23 @@ void EditorInspector<Terrain>::OnInspectGui(Terrain& terrain)
     ImGui::Text("LOD: ");
     ImGui::SameLine();
     ImGui::SliderInt("##LOD", &terrain.m_lod, -1, 7);
+
+    ImGui::SeparatorText("Culling");
+
+    ImGui::Text("PGA Culling: ");
+    ImGui::SameLine();
+    ImGui::Checkbox("##PgaCulling", &terrain.m_pgaCulling);
+
+    static Terrain::CullBenchmark s_cullBenchmark{};
+    if (ImGui::Button("Benchmark Culling"))
+        s_cullBenchmark = terrain.BenchmarkCulling(1000);
+
+    if (s_cullBenchmark.iterations > 0)
+    {
+        ImGui::Text("Cells: %u, Iterations: %u", s_cullBenchmark.cells, s_cullBenchmark.iterations);
+        ImGui::Text("Shape::Overlaps: %.4f ms (%u visible)", s_cullBenchmark.overlapsMs, s_cullBenchmark.overlapsVisible);
+        ImGui::Text("PGA: %.4f ms (%u visible)", s_cullBenchmark.pgaSerialMs, s_cullBenchmark.pgaSerialVisible);
+        ImGui::Text("PGA batched, %u threads: %.4f ms (%u visible)", JobSystem::Get().GetNumThreads(),
+            s_cullBenchmark.pgaParallelMs, s_cullBenchmark.pgaParallelVisible);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <entity_store.hpp>
+
+EntityStore::EntityStore()
+{
+    // Archetype 0 holds entities without components
+    GetArchetype(0);
+}
+
+List<EntityStore::ComponentType>& EntityStore::GetComponentTypes()
+{
+    static List<ComponentType> s_types;
+    return s_types;
+}
+
+u32 EntityStore::RegisterComponent(u32 size, const char* name)
+{
+    auto& types = GetComponentTypes();
+    BX_ENSURE(types.size() < MaxComponents);
+
+    types.emplace_back(ComponentType{ size, name });
+    return (u32)types.size() - 1;
+}
+
+u32 EntityStore::GetArchetype(Mask mask)
+{
+    auto it = m_byMask.find(mask);
+    if (it != m_byMask.end())
+        return it->second;
+
+    const u32 index = (u32)m_archetypes.size();
+    auto& archetype = m_archetypes.emplace_back();
+    archetype.mask = mask;
+
+    for (u32 id = 0; id < MaxComponents; ++id)
+    {
+        if ((mask & (Mask{ 1 } << id)) == 0)
+            continue;
+
+        archetype.column[id] = (u32)archetype.components.size();
+        archetype.components.emplace_back(id);
+    }
+    archetype.columns.resize(archetype.components.size());
+
+    m_byMask.emplace(mask, index);
+    return index;
+}
+
+Entity EntityStore::Create()
+{
+    return Allocate(0);
+}
+
+Entity EntityStore::Allocate(u32 archetype)
+{
+    Entity entity{};
+    if (!m_free.empty())
+    {
+        entity.index = m_free.back();
+        m_free.pop_back();
+    }
+    else
+    {
+        entity.index = (u32)m_locations.size();
+        m_locations.emplace_back();
+    }
+
+    auto& location = m_locations[entity.index];
+    entity.generation = location.generation;
+
+    location.archetype = archetype;
+    location.row = AddRow(m_archetypes[archetype], entity);
+    location.alive = true;
+
+    ++m_numAlive;
+    return entity;
+}
+
+void EntityStore::Destroy(Entity entity)
+{
+    if (!IsAlive(entity))
+        return;
+
+    auto& location = m_locations[entity.index];
+    RemoveRow(location.archetype, location.row);
+
+    // Old handles to this slot stop resolving
+    location.alive = false;
+    ++location.generation;
+    m_free.emplace_back(entity.index);
+    --m_numAlive;
+}
+
+bool EntityStore::IsAlive(Entity entity) const
+{
+    return entity.index < m_locations.size() && m_locations[entity.index].alive && m_locations[entity.index].generation == entity.generation;
+}
+
+u32 EntityStore::AddRow(Archetype& archetype, Entity entity)
+{
+    const u32 row = archetype.GetCount();
+    archetype.entities.emplace_back(entity);
+
+    const auto& types = GetComponentTypes();
+    for (u32 i = 0; i < (u32)archetype.columns.size(); ++i)
+        archetype.columns[i].resize(archetype.columns[i].size() + types[archetype.components[i]].size);
+
+    return row;
+}
+
+void EntityStore::RemoveRow(u32 index, u32 row)
+{
+    auto& archetype = m_archetypes[index];
+    const u32 last = archetype.GetCount() - 1;
+
+    // The last row fills the gap so every column stays dense
+    const auto& types = GetComponentTypes();
+    for (u32 i = 0; i < (u32)archetype.columns.size(); ++i)
+    {
+        const u32 size = types[archetype.components[i]].size;
+        auto& column = archetype.columns[i];
+        if (row != last)
+            std::memcpy(column.data() + (size_t)row * size, column.data() + (size_t)last * size, size);
+        column.resize(column.size() - size);
+    }
+
+    if (row != last)
+    {
+        const Entity moved = archetype.entities[last];
+        archetype.entities[row] = moved;
+        m_locations[moved.index].row = row;
+    }
+    archetype.entities.pop_back();
+}
+
+void EntityStore::Move(Entity entity, Mask mask)
+{
+    const u32 dstIndex = GetArchetype(mask);
+
+    // GetArchetype may have grown m_archetypes, take references after it
+    auto& location = m_locations[entity.index];
+    auto& src = m_archetypes[location.archetype];
+    auto& dst = m_archetypes[dstIndex];
+
+    const u32 row = AddRow(dst, entity);
+    for (u32 id : dst.components)
+    {
+        if (src.mask & (Mask{ 1 } << id))
+            std::memcpy(GetComponent(dst, id, row), GetComponent(src, id, location.row), GetComponentTypes()[id].size);
+    }
+
+    RemoveRow(location.archetype, location.row);
+    location.archetype = dstIndex;
+    location.row = row;
+}
+
+void EntityStore::Clear()
+{
+    for (auto& archetype : m_archetypes)
+    {
+        for (auto& column : archetype.columns)
+            column.clear();
+        archetype.entities.clear();
+    }
+
+    for (u32 i = 0; i < (u32)m_locations.size(); ++i)
+    {
+        auto& location = m_locations[i];
+        if (!location.alive)
+            continue;
+
+        location.alive = false;
+        ++location.generation;
+        m_free.emplace_back(i);
+    }
+    m_numAlive = 0;
+}
@@ -8,6 +8,25 @@
 
 #include <engine/asset.hpp>
 
+#include <asset_service.hpp>
+#include <asset_pack.hpp>
+#include <asset_watcher.hpp>
+#include <shader_cache.hpp>
+#include <script_profiler.hpp>
+#include <components.hpp>
+#include <unit_bindings.hpp>
+#include <cooked_asset.hpp>
+
+#include <cmath>
+
+// Units handed to one job when an archetype is split up
+static constexpr i32 UnitsPerJob = 4096;
+
+// Debug formation spawned from the editor, a square grid of units walking outwards from its center
+static constexpr u32 UnitGridSize = 128;
+static constexpr f32 UnitSpacing = 4.f;
+static constexpr f32 UnitSpeed = 2.f;
+
 SkyPiGame::SkyPiGame()
 {
 }
@@ -34,12 +53,36 @@ void SkyPiGame::Configure()
     //auto asset = Asset::FromMemory(Object<TestAsset>::New(64));
     //asset.Save<TestAsset>("[assets]/save_asset.json");
 
-    auto save_asset = Asset::FromFile("[assets]/save_asset.json");
-    save_asset.Load<TestAsset>();
+    CookedAsset::Register<TestAsset>();
+
+    JobSystem::Get().Initialize();
+
+    // Loose files are still used for anything the pack doesn't contain. Without a pack they
+    // are watched and changed assets are loaded again
+    if (!m_mountPacks || !AssetPack::Mount("[assets]/assets.pak"))
+    {
+        AssetWatcher::Get().Watch("[assets]");
+        AssetWatcher::Get().SubscribeAll([](StringView path) { AssetService::Get().Refresh(path); });
+    }
 
-    auto load_asset = Asset::FromFile("[assets]/save_asset.json");
-    load_asset.GetObject().As<TestAsset>()->value = 8;
-    load_asset.Save<TestAsset>("[assets]/load_asset.json");
+    // Both requests go out in one batch and resolve to the same parsed asset
+    auto& assets = AssetService::Get();
+    const auto save_asset = assets.Load<TestAsset>("[assets]/save_asset.json");
+    const auto load_asset = assets.Load<TestAsset>("[assets]/save_asset.json");
+
+    assets.Then(load_asset, [save_asset, load_asset](Asset& asset)
+    {
+        // save_asset shares the object, edit a copy of it
+        auto copy = Asset::FromMemory(Object<TestAsset>::New(*asset.GetObject().As<TestAsset>()));
+        copy.GetObject().As<TestAsset>()->value = 8;
+        copy.Save<TestAsset>("[assets]/load_asset.json");
+
+        // Stays cached until the budget needs the memory
+        AssetService::Get().Release(save_asset);
+        AssetService::Get().Release(load_asset);
+    });
+
+    assets.Dispatch();
 }
 
 bool SkyPiGame::Initialize()
@@ -47,11 +90,57 @@ bool SkyPiGame::Initialize()
     //m_gameScene = CreateScene<World>();
     //SetActiveScene(m_gameScene);
 
+    UnitBindings::SetStore(&m_entities);
+    m_frameGraph.Add("Units", [this]() { UpdateUnits(m_dt); });
+
     return true;
 }
 
 void SkyPiGame::Update()
 {
+    ScriptProfiler::Get().EndFrame();
+
+    AssetWatcher::Get().Update();
+    AssetService::Get().Update();
+
+    const auto now = std::chrono::steady_clock::now();
+    m_dt = m_lastUpdate.time_since_epoch().count() != 0 ? std::chrono::duration<f32>(now - m_lastUpdate).count() : 0.f;
+    m_lastUpdate = now;
+
+    // Asset callbacks above stay on the main thread, the rest of the frame runs as jobs
+    m_frameGraph.Run();
+}
+
+void SkyPiGame::SpawnUnits()
+{
+    // No terrain in the game yet, units stand on y = 0
+    const f32 center = (UnitGridSize - 1) * UnitSpacing * 0.5f;
+    for (u32 z = 0; z < UnitGridSize; ++z)
+    {
+        for (u32 x = 0; x < UnitGridSize; ++x)
+        {
+            UnitTransform transform{};
+            transform.position = Vec3{ x * UnitSpacing - center, 0, z * UnitSpacing - center };
+            transform.yaw = std::atan2(transform.position.x, transform.position.z);
+
+            UnitVelocity velocity{};
+            velocity.value = Vec3{ std::sin(transform.yaw) * UnitSpeed, 0, std::cos(transform.yaw) * UnitSpeed };
+
+            m_entities.Create(transform, velocity);
+        }
+    }
+}
+
+void SkyPiGame::UpdateUnits(f32 dt)
+{
+    // One pass over contiguous arrays, no per unit dispatch, large archetypes are split across jobs
+    m_entities.EachChunk<UnitTransform, UnitVelocity>([dt](u32 count, const Entity*, UnitTransform* transforms, UnitVelocity* velocities)
+    {
+        JobSystem::Get().ParallelFor(0, (i32)count, UnitsPerJob, [&](i32 i)
+        {
+            transforms[i].position += velocities[i].value * dt;
+        });
+    });
 }
 
 void SkyPiGame::Render()
@@ -62,4 +151,14 @@ void SkyPiGame::Shutdown()
 {
     //Graphics::Get().DestroyBuffer(m_constantBuffer);
     //m_terrain.Shutdown();
+
+    UnitBindings::SetStore(nullptr);
+    m_entities.Clear();
+
+    ScriptProfiler::Get().SetEnabled(false);
+    ShaderCache::Get().Clear();
+    AssetWatcher::Get().Shutdown();
+    AssetService::Get().Shutdown();
+    JobSystem::Get().Shutdown();
+    AssetPack::UnmountAll();
 }
\ No newline at end of file
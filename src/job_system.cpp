@@ -0,0 +1,212 @@
+#include <job_system.hpp>
+
+#include <engine/guard.hpp>
+
+#include <chrono>
+
+// Queue of the current thread, External for every thread that isn't a worker
+static thread_local u32 s_queue = 0;
+
+JobSystem& JobSystem::Get()
+{
+    static JobSystem s_instance;
+    return s_instance;
+}
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void JobSystem::Initialize(i32 numWorkers)
+{
+    if (!m_workers.empty())
+        return;
+
+    if (numWorkers < 0)
+    {
+        const i32 numThreads = (i32)std::thread::hardware_concurrency();
+        numWorkers = numThreads > 1 ? numThreads - 1 : 0;
+    }
+
+    m_stop = false;
+    while (m_queues.size() < (size_t)numWorkers + 1)
+        m_queues.emplace_back();
+
+    for (u32 i = 0; i < (u32)numWorkers; ++i)
+        m_workers.emplace_back([this, i]() { WorkerMain(i + 1); });
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+    m_sleepCv.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+
+    // Anything queued from outside after the workers stopped
+    while (RunOne(External))
+        ;
+}
+
+void JobSystem::Run(Job job, JobCounter& counter)
+{
+    counter.m_count.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        auto& q = m_queues[s_queue];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.emplace_back(Task{ std::move(job), &counter });
+    }
+
+    // Pairs with the sleeping count in WorkerMain, one of the two sees the other's increment
+    m_numQueued.fetch_add(1);
+    if (m_numSleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCv.notify_one();
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        // The remaining jobs are running on other threads
+        if (!RunOne(s_queue))
+            std::this_thread::yield();
+    }
+}
+
+bool JobSystem::RunOne(u32 queue)
+{
+    Task task;
+    if (!Pop(queue, task) && !Steal(queue, task))
+        return false;
+
+    Execute(task);
+    return true;
+}
+
+bool JobSystem::Pop(u32 queue, Task& task)
+{
+    auto& q = m_queues[queue];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty())
+        return false;
+
+    task = std::move(q.tasks.back());
+    q.tasks.pop_back();
+    m_numQueued.fetch_sub(1);
+    return true;
+}
+
+bool JobSystem::Steal(u32 thief, Task& task)
+{
+    const u32 numQueues = (u32)m_queues.size();
+    for (u32 i = 1; i < numQueues; ++i)
+    {
+        auto& q = m_queues[(thief + i) % numQueues];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty())
+            continue;
+
+        // Oldest first, it's the one the owner is least likely to need soon
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        m_numQueued.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::Execute(Task& task)
+{
+    task.job();
+    task.counter->m_count.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::WorkerMain(u32 queue)
+{
+    s_queue = queue;
+
+    while (true)
+    {
+        if (RunOne(queue))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_numSleeping.fetch_add(1);
+        m_sleepCv.wait(lock, [&]() { return m_stop || m_numQueued.load() > 0; });
+        m_numSleeping.fetch_sub(1);
+
+        // Queued work is finished before stopping so nobody waits forever
+        if (m_stop && m_numQueued.load() == 0)
+            break;
+    }
+
+    s_queue = External;
+}
+
+JobGraph::Node JobGraph::Add(StringView name, JobSystem::Job job, std::initializer_list<Node> dependencies)
+{
+    const Node node = (Node)m_nodes.size();
+
+    auto& data = m_nodes.emplace_back();
+    data.name = String(name);
+    data.job = std::move(job);
+
+    for (Node dependency : dependencies)
+    {
+        BX_ENSURE(dependency < node);
+        m_nodes[dependency].dependents.emplace_back(node);
+        ++data.numDependencies;
+    }
+
+    return node;
+}
+
+void JobGraph::Clear()
+{
+    m_nodes.clear();
+}
+
+void JobGraph::Run()
+{
+    for (auto& data : m_nodes)
+        data.remaining.store(data.numDependencies, std::memory_order_relaxed);
+
+    // A node starts its dependents before its own job counts as done, so the counter only
+    // reaches zero once every node has run
+    JobCounter counter;
+    for (Node node = 0; node < (Node)m_nodes.size(); ++node)
+    {
+        if (m_nodes[node].numDependencies == 0)
+            Start(node, counter);
+    }
+
+    JobSystem::Get().Wait(counter);
+}
+
+void JobGraph::Start(Node node, JobCounter& counter)
+{
+    JobSystem::Get().Run([this, node, &counter]()
+    {
+        auto& data = m_nodes[node];
+
+        const auto start = std::chrono::steady_clock::now();
+        data.job();
+        data.ms = std::chrono::duration<f32, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        for (Node dependent : data.dependents)
+        {
+            if (m_nodes[dependent].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                Start(dependent, counter);
+        }
+    }, counter);
+}
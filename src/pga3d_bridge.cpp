@@ -0,0 +1,161 @@
+#include <pga3d_bridge.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Pga3d
+{
+    even_t ToMotor(const Mat4& m)
+    {
+        // Rotation to quaternion (Shepperd), the rotor is [w, -x, -y, -z] with >> as m p ~m
+        const f32 m00 = m[0].x, m11 = m[1].y, m22 = m[2].z;
+        const f32 trace = m00 + m11 + m22;
+        f32 w, x, y, z;
+        if (trace > 0.f)
+        {
+            const f32 s = 0.5f / std::sqrt(trace + 1.f);
+            w = 0.25f / s;
+            x = (m[1].z - m[2].y) * s;
+            y = (m[2].x - m[0].z) * s;
+            z = (m[0].y - m[1].x) * s;
+        }
+        else if (m00 > m11 && m00 > m22)
+        {
+            const f32 s = 2.f * std::sqrt(1.f + m00 - m11 - m22);
+            w = (m[1].z - m[2].y) / s;
+            x = 0.25f * s;
+            y = (m[1].x + m[0].y) / s;
+            z = (m[2].x + m[0].z) / s;
+        }
+        else if (m11 > m22)
+        {
+            const f32 s = 2.f * std::sqrt(1.f + m11 - m00 - m22);
+            w = (m[2].x - m[0].z) / s;
+            x = (m[1].x + m[0].y) / s;
+            y = 0.25f * s;
+            z = (m[2].y + m[1].z) / s;
+        }
+        else
+        {
+            const f32 s = 2.f * std::sqrt(1.f + m22 - m00 - m11);
+            w = (m[0].y - m[1].x) / s;
+            x = (m[2].x + m[0].z) / s;
+            y = (m[2].y + m[1].z) / s;
+            z = 0.25f * s;
+        }
+
+        // Translation by t is 1 - t/2 e0i, applied after the rotation
+        const rotation_t rotor({ w, -x, -y, -z });
+        const translation_t translator({ -0.5f * m[3].x, -0.5f * m[3].y, -0.5f * m[3].z });
+        return translator * rotor;
+    }
+
+    static inline void MotorToMat4(const f32 a0, const f32 a1, const f32 a2, const f32 a3,
+        const f32 a4, const f32 a5, const f32 a6, const f32 a7, Mat4& out)
+    {
+        // Rotation from the rotor (quaternion w = a0, v = -a1..a3), translation is the image of the origin
+        const f32 xx = a1 * a1, yy = a2 * a2, zz = a3 * a3;
+        const f32 xy = a1 * a2, xz = a1 * a3, yz = a2 * a3;
+        const f32 wx = a0 * a1, wy = a0 * a2, wz = a0 * a3;
+
+        out[0] = Vec4{ 1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy), 0.f };
+        out[1] = Vec4{ 2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx), 0.f };
+        out[2] = Vec4{ 2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy), 0.f };
+        out[3] = Vec4
+        {
+            2.f * (a2 * a6 - a0 * a4 - a3 * a5 - a1 * a7),
+            2.f * (a3 * a4 - a0 * a5 - a1 * a6 - a2 * a7),
+            2.f * (a1 * a5 - a0 * a6 - a2 * a4 - a3 * a7),
+            1.f
+        };
+    }
+
+    Mat4 ToMat4(const even_t& motor)
+    {
+        Mat4 out{};
+        const f32* a = motor.d;
+        MotorToMat4(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], out);
+        return out;
+    }
+
+    void ToMat4(const even_t* motors, Mat4* out, u32 count)
+    {
+        for (u32 i = 0; i < count; ++i)
+        {
+            const f32* a = motors[i].d;
+            MotorToMat4(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], out[i]);
+        }
+    }
+
+    void ToMat4(const even_soa& motors, Mat4* out)
+    {
+        const f32* a[8];
+        for (u32 k = 0; k < 8; ++k)
+            a[k] = motors.d[k].data();
+
+        const u32 count = (u32)motors.size();
+        for (u32 i = 0; i < count; ++i)
+            MotorToMat4(a[0][i], a[1][i], a[2][i], a[3][i], a[4][i], a[5][i], a[6][i], a[7][i], out[i]);
+    }
+
+    void FrustumPlanes(const Mat4& viewProj, vector_t planes[6], bool zeroToOne)
+    {
+        // Gribb/Hartmann, rows of the column major matrix
+        const Vec4 r0{ viewProj[0].x, viewProj[1].x, viewProj[2].x, viewProj[3].x };
+        const Vec4 r1{ viewProj[0].y, viewProj[1].y, viewProj[2].y, viewProj[3].y };
+        const Vec4 r2{ viewProj[0].z, viewProj[1].z, viewProj[2].z, viewProj[3].z };
+        const Vec4 r3{ viewProj[0].w, viewProj[1].w, viewProj[2].w, viewProj[3].w };
+
+        const Vec4 rows[6] =
+        {
+            Vec4{ r3.x + r0.x, r3.y + r0.y, r3.z + r0.z, r3.w + r0.w },
+            Vec4{ r3.x - r0.x, r3.y - r0.y, r3.z - r0.z, r3.w - r0.w },
+            Vec4{ r3.x + r1.x, r3.y + r1.y, r3.z + r1.z, r3.w + r1.w },
+            Vec4{ r3.x - r1.x, r3.y - r1.y, r3.z - r1.z, r3.w - r1.w },
+            zeroToOne ? r2 : Vec4{ r3.x + r2.x, r3.y + r2.y, r3.z + r2.z, r3.w + r2.w },
+            Vec4{ r3.x - r2.x, r3.y - r2.y, r3.z - r2.z, r3.w - r2.w },
+        };
+
+        for (u32 i = 0; i < 6; ++i)
+        {
+            const Vec4& p = rows[i];
+            const f32 len = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+            const f32 inv = len > 0.f ? 1.f / len : 0.f;
+            planes[i] = vector_t({ p.x * inv, p.y * inv, p.z * inv, p.w * inv });
+        }
+    }
+
+    void Gather(const PointView& view, points_soa& out)
+    {
+        out.resize(view.count);
+        f32* x = out.d[0].data();
+        f32* y = out.d[1].data();
+        f32* z = out.d[2].data();
+        for (u32 i = 0; i < view.count; ++i)
+        {
+            const Vec3& v = view[i];
+            x[i] = v.x;
+            y[i] = v.y;
+            z[i] = v.z;
+        }
+    }
+
+    void Scatter(const points_soa& in, const PointView& view)
+    {
+        const f32* x = in.d[0].data();
+        const f32* y = in.d[1].data();
+        const f32* z = in.d[2].data();
+        const u32 count = std::min(view.count, (u32)in.size());
+        for (u32 i = 0; i < count; ++i)
+            view[i] = Vec3{ x[i], y[i], z[i] };
+    }
+
+    void Transform(const even_t& motor, const PointView& in, const PointView& out)
+    {
+        // Reused per thread so hot loops don't allocate
+        thread_local points_soa scratch;
+        Gather(in, scratch);
+        sandwich(motor, scratch, scratch);
+        Scatter(scratch, out);
+    }
+}
@@ -1,6 +1,8 @@
 #include <engine/runtime.hpp>
 #include <engine/engine.hpp>
 
+#include <terrain_benchmark.hpp>
+
 #ifdef EDITOR_BUILD
 #include <editor/game_editor.hpp>
 #else
@@ -9,6 +11,11 @@
 
 int RuntimeMain(int argc, char** args)
 {
+    // Headless, runs without the engine loop or a window
+    TerrainBenchmark::Options benchmark{};
+    if (TerrainBenchmark::ParseArgs(argc, args, benchmark))
+        return TerrainBenchmark::Run(benchmark);
+
 #ifdef EDITOR_BUILD
     SkyPiEditor editor;
     return Engine::Get().Run(argc, args, editor);
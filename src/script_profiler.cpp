@@ -0,0 +1,136 @@
+#include <script_profiler.hpp>
+
+#include <algorithm>
+
+// Weight of the newest frame in the running average
+static constexpr f32 AverageWeight = 0.05f;
+
+ScriptProfiler& ScriptProfiler::Get()
+{
+    static ScriptProfiler s_instance;
+    return s_instance;
+}
+
+ScriptProfiler::~ScriptProfiler()
+{
+    SetEnabled(false);
+}
+
+void ScriptProfiler::SetEnabled(bool enabled)
+{
+    if (enabled == m_enabled)
+        return;
+
+    m_enabled = enabled;
+    if (enabled)
+    {
+        m_sampling = true;
+        m_sampler = std::thread([this]() { SamplerMain(); });
+    }
+    else
+    {
+        m_sampling = false;
+        if (m_sampler.joinable())
+            m_sampler.join();
+
+        m_stack.clear();
+        m_current = Invalid;
+    }
+}
+
+u32 ScriptProfiler::Register(StringView name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    String key(name);
+    auto it = m_byName.find(key);
+    if (it != m_byName.end())
+        return it->second;
+
+    const u32 id = (u32)m_counters.size();
+    m_counters.emplace_back().name = key;
+    m_byName.emplace(std::move(key), id);
+    return id;
+}
+
+void ScriptProfiler::Enter(u32 id)
+{
+    if (!m_enabled)
+        return;
+
+    if (id >= m_resolved.size())
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = m_resolved.size(); i < m_counters.size(); ++i)
+            m_resolved.emplace_back(&m_counters[i]);
+
+        if (id >= m_resolved.size())
+            return;
+    }
+
+    m_stack.emplace_back(Frame{ id, m_resolved[id], Clock::now() });
+    m_current.store(id, std::memory_order_relaxed);
+}
+
+void ScriptProfiler::Leave()
+{
+    if (!m_enabled || m_stack.empty())
+        return;
+
+    const Frame frame = m_stack.back();
+    m_stack.pop_back();
+
+    ++frame.counter->calls;
+    frame.counter->time += Clock::now() - frame.start;
+
+    m_current.store(m_stack.empty() ? Invalid : m_stack.back().id, std::memory_order_relaxed);
+}
+
+void ScriptProfiler::EndFrame()
+{
+    m_frame.clear();
+    m_frameSamples = 0;
+    if (!m_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& counter : m_counters)
+    {
+        Stat stat{};
+        stat.name = counter.name;
+        stat.calls = counter.calls;
+        stat.ms = std::chrono::duration<f32, std::milli>(counter.time).count();
+        stat.samples = counter.samples.exchange(0, std::memory_order_relaxed);
+
+        counter.avgMs += (stat.ms - counter.avgMs) * AverageWeight;
+        stat.avgMs = counter.avgMs;
+
+        counter.calls = 0;
+        counter.time = {};
+
+        m_frameSamples += stat.samples;
+        if (stat.calls > 0 || stat.samples > 0)
+            m_frame.emplace_back(std::move(stat));
+    }
+
+    std::sort(m_frame.begin(), m_frame.end(), [](const Stat& a, const Stat& b) { return a.ms > b.ms; });
+}
+
+void ScriptProfiler::SamplerMain()
+{
+    const auto interval = std::chrono::microseconds(1000000 / SampleRate);
+    auto next = Clock::now();
+
+    while (m_sampling)
+    {
+        next += interval;
+        std::this_thread::sleep_until(next);
+
+        const u32 id = m_current.load(std::memory_order_relaxed);
+        if (id == Invalid)
+            continue;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_counters[id].samples.fetch_add(1, std::memory_order_relaxed);
+    }
+}
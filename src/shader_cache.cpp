@@ -0,0 +1,150 @@
+#include <shader_cache.hpp>
+#include <asset_pack.hpp>
+
+#include <engine/file.hpp>
+#include <engine/debug.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+static u64 Hash(u64 hash, const void* data, size_t size)
+{
+    // FNV-1a
+    const u8* bytes = (const u8*)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static constexpr u64 HashSeed = 0xCBF29CE484222325ull;
+
+ShaderCache& ShaderCache::Get()
+{
+    static ShaderCache s_instance;
+    return s_instance;
+}
+
+const ShaderCache::Source* ShaderCache::GetSource(StringView path)
+{
+    String key(path);
+    auto it = m_sources.find(key);
+    if (it != m_sources.end())
+        return &it->second;
+
+    Source source{};
+
+    AssetPack::Blob blob{};
+    if (AssetPack::Resolve(path, blob))
+    {
+        source.text.assign((const char*)blob.data, (size_t)blob.size);
+    }
+    else
+    {
+        const auto filepath = File::Get().GetPath(path);
+        std::ifstream file(filepath.c_str(), std::ios::in);
+        if (!file.is_open())
+        {
+            BX_LOGE(Log, "Failed to open shader: {}", filepath.c_str());
+            return nullptr;
+        }
+
+        std::ostringstream content;
+        content << file.rdbuf();
+        source.text = content.str();
+    }
+
+    source.hash = Hash(HashSeed, source.text.data(), source.text.size());
+    return &m_sources.emplace(std::move(key), std::move(source)).first->second;
+}
+
+GraphicsHandle ShaderCache::Acquire(StringView path, ShaderType stage, std::initializer_list<StringView> defines)
+{
+    const Source* source = GetSource(path);
+    if (source == nullptr)
+        return INVALID_GRAPHICS_HANDLE;
+
+    // Sorted so the order defines are listed in doesn't make a new permutation
+    List<StringView> sorted(defines.begin(), defines.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    String preamble{};
+    for (const auto& define : sorted)
+    {
+        preamble += "#define ";
+        preamble += define;
+        preamble += "\n";
+    }
+
+    u64 key = Hash(HashSeed, &source->hash, sizeof(source->hash));
+    key = Hash(key, &stage, sizeof(stage));
+    key = Hash(key, preamble.data(), preamble.size());
+
+    for (auto& shader : m_shaders)
+    {
+        if (shader.key == key)
+        {
+            ++shader.refs;
+            return shader.handle;
+        }
+    }
+
+    const String text = preamble + source->text;
+
+    ShaderInfo shaderInfo;
+    shaderInfo.shaderType = stage;
+    shaderInfo.source = text.c_str();
+
+    GraphicsHandle handle = INVALID_GRAPHICS_HANDLE;
+    try
+    {
+        handle = Graphics::Get().CreateShader(shaderInfo);
+    }
+    catch (const std::exception& e)
+    {
+        BX_LOGE(Log, "Failed to compile {}: {}", path, e.what());
+    }
+    ++m_numCompiles;
+
+    if (handle == INVALID_GRAPHICS_HANDLE)
+        return INVALID_GRAPHICS_HANDLE;
+
+    m_shaders.emplace_back(Shader{ key, handle, 1 });
+    return handle;
+}
+
+void ShaderCache::Release(GraphicsHandle shader)
+{
+    if (shader == INVALID_GRAPHICS_HANDLE)
+        return;
+
+    for (auto it = m_shaders.begin(); it != m_shaders.end(); ++it)
+    {
+        if (it->handle != shader)
+            continue;
+
+        if (--it->refs == 0)
+        {
+            Graphics::Get().DestroyShader(it->handle);
+            m_shaders.erase(it);
+        }
+        return;
+    }
+}
+
+void ShaderCache::Invalidate(StringView path)
+{
+    m_sources.erase(String(path));
+}
+
+void ShaderCache::Clear()
+{
+    for (const auto& shader : m_shaders)
+        Graphics::Get().DestroyShader(shader.handle);
+
+    m_shaders.clear();
+    m_sources.clear();
+}
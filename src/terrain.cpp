@@ -1,4 +1,7 @@
 #include <terrain.hpp>
+#include <asset_watcher.hpp>
+#include <shader_cache.hpp>
+#include <job_system.hpp>
 
 #include <engine/guard.hpp>
 #include <engine/debug.hpp>
@@ -6,9 +9,15 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
-#include <fstream>
-#include <sstream>
-#include <stdexcept>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TERRAIN_SSE2
+#include <emmintrin.h>
+#endif
 
 static Image LoadImage(StringView filename)
 {
@@ -54,22 +63,6 @@ Terrain::~Terrain()
 {
 }
 
-static String LoadText(StringView filename)
-{
-    const auto filepath = File::Get().GetPath(filename);
-    std::ifstream file(filepath.c_str(), std::ios::in);
-    if (!file.is_open())
-    {
-        throw std::runtime_error(fmt::format("Failed to open file: {}", filepath.c_str()));
-    }
-
-    std::ostringstream content;
-    content << file.rdbuf();
-
-    file.close();
-    return content.str();
-}
-
 template <u32 LOD>
 static constexpr u32 GetLODCellLength()
 {
@@ -84,6 +77,13 @@ static constexpr u32 GetLODCellSize()
     return ((length - 1) * ((length + 1) * 2));
 }
 
+// Index count of each LOD, what m_indexBuffers[lod].count holds once initialized
+static constexpr u32 LODIndexCounts[] =
+{
+    GetLODCellSize<0>(), GetLODCellSize<1>(), GetLODCellSize<2>(), GetLODCellSize<3>(),
+    GetLODCellSize<4>(), GetLODCellSize<5>(), GetLODCellSize<6>(), GetLODCellSize<7>()
+};
+
 template <u32 LOD>
 using IndexArray = Array<u16, GetLODCellSize<LOD>()>;
 
@@ -139,8 +139,25 @@ static constexpr IndexArray<LOD>& GetIndices()
     indexBuffer.count = (u32)indices.size();\
 }
 
+static f32 ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<f32, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 void Terrain::Initialize()
 {
+    // Create albedo clipmap cache, also baked without graphics so streaming costs the same
+    {
+        m_clipmap.Initialize(!m_nullGraphics);
+
+        TerrainMaterialLayer layer;
+        layer.texturePath = "/assets/midgard-textures/21c.png";
+        m_clipmap.AddLayer(layer);
+    }
+
+    if (m_nullGraphics)
+        return;
+
     // Create draw buffer
     {
         BufferInfo bufferInfo;
@@ -153,20 +170,23 @@ void Terrain::Initialize()
         bufferData.pData = nullptr;
 
         m_drawBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
+        m_shadowBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
+        m_cascadeBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
+        m_clipmapBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
     }
 
     // Create terrain shaders
     {
-        ShaderInfo shaderInfo;
-        String src = LoadText("/assets/terrain.shader");
+        ShaderSet shaders{};
+        const bool compiled = CreateShaders(shaders);
+        BX_ENSURE(compiled);
 
-        shaderInfo.shaderType = ShaderType::VERTEX;
-        shaderInfo.source = src.c_str();
-        m_vertexShader = Graphics::Get().CreateShader(shaderInfo);
+        m_vertexShader = shaders.vertexShader;
+        m_pixelShader = shaders.pixelShader;
+        m_shadowShader = shaders.shadowShader;
 
-        shaderInfo.shaderType = ShaderType::PIXEL;
-        shaderInfo.source = src.c_str();
-        m_pixelShader = Graphics::Get().CreateShader(shaderInfo);
+        // Rebuilt between frames when the file is saved, see AssetWatcher
+        m_shaderWatch = AssetWatcher::Get().Subscribe(ShaderPath, [this](StringView) { ReloadShaders(); });
     }
 
     // Create terrain resource bindings & pipeline
@@ -175,7 +195,13 @@ void Terrain::Initialize()
         {
             ResourceBindingElement { ShaderType::VERTEX, "ConstantBuffer", 1, ResourceBindingType::UNIFORM_BUFFER, ResourceBindingAccess::STATIC },
             ResourceBindingElement { ShaderType::VERTEX, "DrawBuffer", 1, ResourceBindingType::UNIFORM_BUFFER, ResourceBindingAccess::STATIC },
-            ResourceBindingElement { ShaderType::PIXEL, "Albedo", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC }
+            ResourceBindingElement { ShaderType::PIXEL, "Albedo", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC },
+            ResourceBindingElement { ShaderType::PIXEL, "CascadeBuffer", 1, ResourceBindingType::UNIFORM_BUFFER, ResourceBindingAccess::STATIC },
+            ResourceBindingElement { ShaderType::PIXEL, "ShadowMap0", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC },
+            ResourceBindingElement { ShaderType::PIXEL, "ShadowMap1", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC },
+            ResourceBindingElement { ShaderType::PIXEL, "ShadowMap2", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC },
+            ResourceBindingElement { ShaderType::PIXEL, "ClipmapBuffer", 1, ResourceBindingType::UNIFORM_BUFFER, ResourceBindingAccess::STATIC },
+            ResourceBindingElement { ShaderType::PIXEL, "AlbedoCache", 1, ResourceBindingType::TEXTURE, ResourceBindingAccess::DYNAMIC }
         };
 
         ResourceBindingInfo resourceBindingInfo;
@@ -184,30 +210,51 @@ void Terrain::Initialize()
 
         m_resources = Graphics::Get().CreateResourceBinding(resourceBindingInfo);
         Graphics::Get().BindResource(m_resources, "DrawBuffer", m_drawBuffer);
+        Graphics::Get().BindResource(m_resources, "CascadeBuffer", m_cascadeBuffer);
+        Graphics::Get().BindResource(m_resources, "ClipmapBuffer", m_clipmapBuffer);
+        Graphics::Get().BindResource(m_resources, "AlbedoCache", m_clipmap.GetTexture());
 
-        PipelineInfo pipeInfo;
-        pipeInfo.numRenderTargets = 1;
-        pipeInfo.renderTargetFormats[0] = Graphics::Get().GetColorBufferFormat();
-        pipeInfo.depthStencilFormat = Graphics::Get().GetDepthBufferFormat();
-
-        pipeInfo.topology = PipelineTopology::TRIANGLE_STRIP;
-        pipeInfo.faceCull = PipelineFaceCull::CCW;
-        pipeInfo.depthEnable = true;
+        m_pipeline = CreatePipeline(m_vertexShader, m_pixelShader);
+    }
 
-        LayoutElement layoutElems[] =
+    // Create shadow resource bindings, pipeline & cascade targets
+    {
+        ResourceBindingElement resourceElems[] =
         {
-            LayoutElement { 0, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
-            LayoutElement { 1, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
-            LayoutElement { 2, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 }
+            ResourceBindingElement { ShaderType::VERTEX, "ShadowBuffer", 1, ResourceBindingType::UNIFORM_BUFFER, ResourceBindingAccess::STATIC }
         };
 
-        pipeInfo.layoutElements = layoutElems;
-        pipeInfo.numElements = BX_ARRAYSIZE(layoutElems);
+        ResourceBindingInfo resourceBindingInfo;
+        resourceBindingInfo.resources = resourceElems;
+        resourceBindingInfo.numResources = BX_ARRAYSIZE(resourceElems);
+
+        m_shadowResources = Graphics::Get().CreateResourceBinding(resourceBindingInfo);
+        Graphics::Get().BindResource(m_shadowResources, "ShadowBuffer", m_shadowBuffer);
 
-        pipeInfo.vertShader = m_vertexShader;
-        pipeInfo.pixelShader = m_pixelShader;
+        m_shadowPipeline = CreateShadowPipeline(m_shadowShader);
 
-        m_pipeline = Graphics::Get().CreatePipeline(pipeInfo);
+        static const char* shadowMapNames[] = { "ShadowMap0", "ShadowMap1", "ShadowMap2" };
+        static_assert(BX_ARRAYSIZE(shadowMapNames) == TerrainShadowData::NumCascades, "Missing shadow map binding names");
+
+        for (u32 i = 0; i < TerrainShadowData::NumCascades; ++i)
+        {
+            TextureInfo textureInfo;
+            textureInfo.width = ShadowMapSize;
+            textureInfo.height = ShadowMapSize;
+            textureInfo.format = TextureFormat::D32_FLOAT;
+            textureInfo.flags = TextureFlags::DEPTH_STENCIL | TextureFlags::SHADER_RESOURCE;
+
+            BufferData textureData;
+            textureData.dataSize = 0;
+            textureData.pData = nullptr;
+
+            auto& cascade = m_cascades[i];
+            cascade.depthTexture = Graphics::Get().CreateTexture(textureInfo, textureData);
+            cascade.lodBias = (i32)i;
+            cascade.dirty = true;
+
+            Graphics::Get().BindResource(m_resources, shadowMapNames[i], cascade.depthTexture);
+        }
     }
 
     // Create terrain texture
@@ -248,17 +295,173 @@ void Terrain::Initialize()
     }
 }
 
+static void DestroyPipeline(GraphicsHandle& handle)
+{
+    if (handle != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyPipeline(handle);
+    handle = INVALID_GRAPHICS_HANDLE;
+}
+
+void Terrain::ReleaseShaders(ShaderSet& shaders)
+{
+    ShaderCache::Get().Release(shaders.vertexShader);
+    ShaderCache::Get().Release(shaders.pixelShader);
+    ShaderCache::Get().Release(shaders.shadowShader);
+    shaders = {};
+}
+
+bool Terrain::CreateShaders(ShaderSet& shaders)
+{
+    auto& cache = ShaderCache::Get();
+    shaders.vertexShader = cache.Acquire(ShaderPath, ShaderType::VERTEX);
+    shaders.pixelShader = cache.Acquire(ShaderPath, ShaderType::PIXEL);
+
+    // Depth only variant for the shadow cascades
+    shaders.shadowShader = cache.Acquire(ShaderPath, ShaderType::VERTEX, { "SHADOW" });
+
+    if (shaders.vertexShader != INVALID_GRAPHICS_HANDLE && shaders.pixelShader != INVALID_GRAPHICS_HANDLE && shaders.shadowShader != INVALID_GRAPHICS_HANDLE)
+        return true;
+
+    ReleaseShaders(shaders);
+    return false;
+}
+
+GraphicsHandle Terrain::CreatePipeline(GraphicsHandle vertexShader, GraphicsHandle pixelShader)
+{
+    PipelineInfo pipeInfo;
+    pipeInfo.numRenderTargets = 1;
+    pipeInfo.renderTargetFormats[0] = Graphics::Get().GetColorBufferFormat();
+    pipeInfo.depthStencilFormat = Graphics::Get().GetDepthBufferFormat();
+
+    pipeInfo.topology = PipelineTopology::TRIANGLE_STRIP;
+    pipeInfo.faceCull = PipelineFaceCull::CCW;
+    pipeInfo.depthEnable = true;
+
+    LayoutElement layoutElems[] =
+    {
+        LayoutElement { 0, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 1, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 2, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 3, 0, 1, GraphicsValueType::FLOAT32, false, 0, 0 }
+    };
+
+    pipeInfo.layoutElements = layoutElems;
+    pipeInfo.numElements = BX_ARRAYSIZE(layoutElems);
+
+    pipeInfo.vertShader = vertexShader;
+    pipeInfo.pixelShader = pixelShader;
+
+    return Graphics::Get().CreatePipeline(pipeInfo);
+}
+
+GraphicsHandle Terrain::CreateShadowPipeline(GraphicsHandle shadowShader)
+{
+    // Same vertex layout as the main pass but no color targets and no pixel shader
+    PipelineInfo pipeInfo;
+    pipeInfo.numRenderTargets = 0;
+    pipeInfo.depthStencilFormat = TextureFormat::D32_FLOAT;
+
+    pipeInfo.topology = PipelineTopology::TRIANGLE_STRIP;
+    pipeInfo.faceCull = PipelineFaceCull::CCW;
+    pipeInfo.depthEnable = true;
+
+    LayoutElement layoutElems[] =
+    {
+        LayoutElement { 0, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 1, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 2, 0, 3, GraphicsValueType::FLOAT32, false, 0, 0 },
+        LayoutElement { 3, 0, 1, GraphicsValueType::FLOAT32, false, 0, 0 }
+    };
+
+    pipeInfo.layoutElements = layoutElems;
+    pipeInfo.numElements = BX_ARRAYSIZE(layoutElems);
+
+    pipeInfo.vertShader = shadowShader;
+    pipeInfo.pixelShader = INVALID_GRAPHICS_HANDLE;
+
+    return Graphics::Get().CreatePipeline(pipeInfo);
+}
+
+bool Terrain::ReloadShaders()
+{
+    // Everything is built before anything is replaced, a broken edit keeps the current shaders
+    ShaderCache::Get().Invalidate(ShaderPath);
+
+    ShaderSet shaders{};
+    if (!CreateShaders(shaders))
+        return false;
+
+    // Saved without changes, the cache handed back the shaders in use
+    if (shaders.vertexShader == m_vertexShader && shaders.pixelShader == m_pixelShader && shaders.shadowShader == m_shadowShader)
+    {
+        ReleaseShaders(shaders);
+        return true;
+    }
+
+    GraphicsHandle pipeline = CreatePipeline(shaders.vertexShader, shaders.pixelShader);
+    GraphicsHandle shadowPipeline = CreateShadowPipeline(shaders.shadowShader);
+    if (pipeline == INVALID_GRAPHICS_HANDLE || shadowPipeline == INVALID_GRAPHICS_HANDLE)
+    {
+        BX_LOGE(Log, "Failed to rebuild terrain pipelines");
+        DestroyPipeline(pipeline);
+        DestroyPipeline(shadowPipeline);
+        ReleaseShaders(shaders);
+        return false;
+    }
+
+    // Resource bindings don't depend on the shaders and are kept
+    std::swap(m_vertexShader, shaders.vertexShader);
+    std::swap(m_pixelShader, shaders.pixelShader);
+    std::swap(m_shadowShader, shaders.shadowShader);
+    std::swap(m_pipeline, pipeline);
+    std::swap(m_shadowPipeline, shadowPipeline);
+
+    DestroyPipeline(pipeline);
+    DestroyPipeline(shadowPipeline);
+    ReleaseShaders(shaders);
+
+    BX_LOGI(Log, "Reloaded terrain shaders");
+    return true;
+}
+
 void Terrain::Shutdown()
 {
-    if (m_vertexShader != INVALID_GRAPHICS_HANDLE)
-        Graphics::Get().DestroyShader(m_vertexShader);
-    if (m_pixelShader != INVALID_GRAPHICS_HANDLE)
-        Graphics::Get().DestroyShader(m_pixelShader);
+    AssetWatcher::Get().Unsubscribe(m_shaderWatch);
+    m_shaderWatch = 0;
+
+    ShaderCache::Get().Release(m_vertexShader);
+    ShaderCache::Get().Release(m_pixelShader);
     if (m_pipeline != INVALID_GRAPHICS_HANDLE)
         Graphics::Get().DestroyPipeline(m_pipeline);
     if (m_resources != INVALID_GRAPHICS_HANDLE)
         Graphics::Get().DestroyResourceBinding(m_resources);
 
+    ShaderCache::Get().Release(m_shadowShader);
+    if (m_shadowPipeline != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyPipeline(m_shadowPipeline);
+    if (m_shadowResources != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyResourceBinding(m_shadowResources);
+
+    if (m_drawBuffer != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyBuffer(m_drawBuffer);
+    if (m_shadowBuffer != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyBuffer(m_shadowBuffer);
+    if (m_cascadeBuffer != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyBuffer(m_cascadeBuffer);
+    if (m_clipmapBuffer != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyBuffer(m_clipmapBuffer);
+    m_drawBuffer = INVALID_GRAPHICS_HANDLE;
+    m_shadowBuffer = INVALID_GRAPHICS_HANDLE;
+    m_cascadeBuffer = INVALID_GRAPHICS_HANDLE;
+    m_clipmapBuffer = INVALID_GRAPHICS_HANDLE;
+
+    for (auto& cascade : m_cascades)
+    {
+        if (cascade.depthTexture != INVALID_GRAPHICS_HANDLE)
+            Graphics::Get().DestroyTexture(cascade.depthTexture);
+        cascade.depthTexture = INVALID_GRAPHICS_HANDLE;
+    }
+
     //for (const auto& cell : m_cells)
     //{
     //    if (cell.vertexBuffer != INVALID_GRAPHICS_HANDLE)
@@ -269,9 +472,73 @@ void Terrain::Shutdown()
 
     if (m_texture != INVALID_GRAPHICS_HANDLE)
         Graphics::Get().DestroyTexture(m_texture);
+
+    m_clipmap.Shutdown();
 }
 
-void Terrain::Import(StringView srcPath, StringView dstPath)
+// Horizon based ambient occlusion for every heightmap texel, rows are split across jobs
+static void BakeOcclusion(const u16* data, i32 width, i32 height, List<u8>& occlusion)
+{
+    constexpr i32 NumDirections = 8;
+    constexpr i32 NumSteps = 16;
+    constexpr f32 yScale = Terrain::Cell::HeightScale;
+    constexpr f32 Pi = 3.14159265f;
+
+    // Exponentially growing steps along every direction, rounded to whole texel offsets. The
+    // slope divides by the length of the rounded offset so diagonals aren't skewed, offsets that
+    // round to the texel itself are skipped
+    i32 offsetX[NumDirections][NumSteps], offsetY[NumDirections][NumSteps];
+    f32 offsetDist[NumDirections][NumSteps];
+    for (i32 d = 0; d < NumDirections; ++d)
+    {
+        const f32 angle = (2.f * Pi * d) / NumDirections;
+        for (i32 s = 0; s < NumSteps; ++s)
+        {
+            const f32 dist = pow(1.35f, (f32)s);
+            offsetX[d][s] = (i32)floor(cos(angle) * dist + 0.5f);
+            offsetY[d][s] = (i32)floor(sin(angle) * dist + 0.5f);
+            offsetDist[d][s] = sqrt((f32)(offsetX[d][s] * offsetX[d][s] + offsetY[d][s] * offsetY[d][s]));
+        }
+    }
+
+    occlusion.resize((size_t)width * height);
+
+    JobSystem::Get().ParallelFor(0, height, 0, [&](i32 y)
+    {
+        for (i32 x = 0; x < width; ++x)
+        {
+            const f32 h0 = data[y * width + x] * yScale;
+
+            f32 visibility = 0;
+            for (i32 d = 0; d < NumDirections; ++d)
+            {
+                // Highest horizon slope in this direction
+                f32 maxSlope = 0;
+                for (i32 s = 0; s < NumSteps; ++s)
+                {
+                    if (offsetDist[d][s] == 0)
+                        continue;
+
+                    i32 sx = x + offsetX[d][s];
+                    i32 sy = y + offsetY[d][s];
+                    sx = sx < 0 ? 0 : sx >= width ? width - 1 : sx;
+                    sy = sy < 0 ? 0 : sy >= height ? height - 1 : sy;
+
+                    const f32 slope = (data[sy * width + sx] * yScale - h0) / offsetDist[d][s];
+                    maxSlope = slope > maxSlope ? slope : maxSlope;
+                }
+
+                // 1 - sin(horizon angle)
+                visibility += 1.f - maxSlope / sqrt(1.f + maxSlope * maxSlope);
+            }
+
+            visibility /= NumDirections;
+            occlusion[(size_t)y * width + x] = (u8)(Math::Clamp(visibility, 0.f, 1.f) * 255.f + 0.5f);
+        }
+    });
+}
+
+void Terrain::Import(StringView srcPath, StringView dstPath, bool bakeOcclusion)
 {
     Image heightmap = LoadImage(srcPath);
     BX_ENSURE(heightmap.is_16bit);
@@ -285,14 +552,21 @@ void Terrain::Import(StringView srcPath, StringView dstPath)
     const i32 cellSize = Cell::Length;
     const i32 cellsX = (width + cellSize - 1) / cellSize;
     const i32 cellsY = (height + cellSize - 1) / cellSize;
+    const u32 flags = bakeOcclusion ? FILE_FLAGS_OCCLUSION : FILE_FLAGS_NONE;
+
+    List<u8> occlusion{};
+    if (bakeOcclusion)
+        BakeOcclusion(data, width, height, occlusion);
 
     // Write header
     outFile.seekp(0);
     outFile.write((char*)&cellsX, sizeof(i32));
     outFile.write((char*)&cellsY, sizeof(i32));
+    outFile.write((char*)&flags, sizeof(u32));
 
     // Write cells
     static Cell::HeightData cellHeightData{};
+    static Cell::OcclusionData cellOcclusionData{};
     for (i32 cy = 0; cy < cellsY; ++cy)
     {
         for (i32 cx = 0; cx < cellsX; ++cx)
@@ -325,6 +599,22 @@ void Terrain::Import(StringView srcPath, StringView dstPath)
             outFile.write((char*)&cy, sizeof(i32));
             outFile.write((char*)&avgHeight, sizeof(u32));
             outFile.write((char*)cellHeightData.data(), sizeof(Cell::HeightData));
+
+            if (bakeOcclusion)
+            {
+                idx = 0;
+                for (i32 i = globalY; i < (globalY + cellSize); ++i)
+                {
+                    for (i32 j = globalX; j < (globalX + cellSize); ++j)
+                    {
+                        i32 y = i >= height ? height - 1 : i;
+                        i32 x = j >= width ? width - 1 : j;
+                        cellOcclusionData[idx++] = occlusion[(size_t)y * width + x];
+                    }
+                }
+
+                outFile.write((char*)cellOcclusionData.data(), sizeof(Cell::OcclusionData));
+            }
         }
     }
 
@@ -332,15 +622,84 @@ void Terrain::Import(StringView srcPath, StringView dstPath)
     UnloadImage(heightmap);
 }
 
+static u32 GetBoundsOffset(u32 level)
+{
+    static const auto offsets = []()
+    {
+        Array<u32, Terrain::Cell::NumBoundsLevels> res{};
+        u32 offset = 0;
+        for (u32 l = 0; l < Terrain::Cell::NumBoundsLevels; ++l)
+        {
+            res[l] = offset;
+            const u32 n = Terrain::Cell::NumQuads >> l;
+            offset += n * n;
+        }
+        return res;
+    }();
+    return offsets[level];
+}
+
+static void BuildHeightPyramid(Terrain::Cell& cell)
+{
+    constexpr u32 L = Terrain::Cell::Length;
+    constexpr u32 N = Terrain::Cell::NumQuads;
+
+    for (u32 qz = 0; qz < N; ++qz)
+    {
+        for (u32 qx = 0; qx < N; ++qx)
+        {
+            const f32 h00 = cell.vertices[(qz + 0) * L + (qx + 0)].position.y;
+            const f32 h10 = cell.vertices[(qz + 0) * L + (qx + 1)].position.y;
+            const f32 h01 = cell.vertices[(qz + 1) * L + (qx + 0)].position.y;
+            const f32 h11 = cell.vertices[(qz + 1) * L + (qx + 1)].position.y;
+
+            auto& bounds = cell.heightBounds[qz * N + qx];
+            bounds.min = std::min(std::min(h00, h10), std::min(h01, h11));
+            bounds.max = std::max(std::max(h00, h10), std::max(h01, h11));
+        }
+    }
+
+    for (u32 l = 1; l < Terrain::Cell::NumBoundsLevels; ++l)
+    {
+        const u32 n = N >> l;
+        const u32 childN = n * 2;
+        const auto* children = cell.heightBounds.data() + GetBoundsOffset(l - 1);
+        auto* nodes = cell.heightBounds.data() + GetBoundsOffset(l);
+
+        for (u32 z = 0; z < n; ++z)
+        {
+            for (u32 x = 0; x < n; ++x)
+            {
+                const auto& c00 = children[(z * 2 + 0) * childN + (x * 2 + 0)];
+                const auto& c10 = children[(z * 2 + 0) * childN + (x * 2 + 1)];
+                const auto& c01 = children[(z * 2 + 1) * childN + (x * 2 + 0)];
+                const auto& c11 = children[(z * 2 + 1) * childN + (x * 2 + 1)];
+
+                auto& node = nodes[z * n + x];
+                node.min = std::min(std::min(c00.min, c10.min), std::min(c01.min, c11.min));
+                node.max = std::max(std::max(c00.max, c10.max), std::max(c01.max, c11.max));
+            }
+        }
+    }
+}
+
 static void SeekCellData(InputFileStream& stream, u32 stride, i32 cellsX, i32 cx, i32 cy)
 {
-    const u32 headerSize = sizeof(i32) * 2;
-    const u32 cellDataSize = sizeof(i32) * 2 + stride;
+    const u32 headerSize = sizeof(i32) * 2 + sizeof(u32);
+    const u32 cellDataSize = sizeof(i32) * 2 + sizeof(u32) + stride;
     const u32 cellIndex = cy * cellsX + cx;
     const u32 offset = headerSize + (cellIndex * cellDataSize);
     stream.seekg(offset);
 }
 
+static u32 GetCellDataStride(u32 fileFlags)
+{
+    u32 stride = sizeof(Terrain::Cell::HeightData);
+    if (fileFlags & Terrain::FILE_FLAGS_OCCLUSION)
+        stride += sizeof(Terrain::Cell::OcclusionData);
+    return stride;
+}
+
 void Terrain::OpenStream(StringView heightmapPath)
 {
     const auto filepath = File::Get().GetPath(heightmapPath);
@@ -349,6 +708,7 @@ void Terrain::OpenStream(StringView heightmapPath)
     m_fileStream.seekg(0);
     m_fileStream.read((char*)&m_cellsX, sizeof(i32));
     m_fileStream.read((char*)&m_cellsY, sizeof(i32));
+    m_fileStream.read((char*)&m_fileFlags, sizeof(u32));
     
     // Load meta data
     m_metaCells.resize(m_cellsX * m_cellsY);
@@ -357,7 +717,7 @@ void Terrain::OpenStream(StringView heightmapPath)
         for (i32 cx = 0; cx < m_cellsX; ++cx)
         {
             // Read cell data
-            SeekCellData(m_fileStream, sizeof(Cell::HeightData), m_cellsX, cx, cy);
+            SeekCellData(m_fileStream, GetCellDataStride(m_fileFlags), m_cellsX, cx, cy);
 
             auto& metaCell = m_metaCells[cy * m_cellsX + cx];
             m_fileStream.read((char*)&metaCell.x, sizeof(i32));
@@ -370,6 +730,7 @@ void Terrain::OpenStream(StringView heightmapPath)
     // Reserve cell data
     //m_cells.resize(m_maxCells * m_maxCells);
     m_cells.resize(m_cellsX * m_cellsY);
+    m_cellBoxes.resize(m_cells.size());
 
     for (i32 cy = 0; cy < m_cellsY; ++cy)
     {
@@ -384,6 +745,9 @@ void Terrain::CloseStream()
 {
     m_fileStream.close();
     m_cells.clear();
+    m_metaCells.clear();
+    m_cellBoxes.clear();
+    m_clipmap.Invalidate();
 }
 
 void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
@@ -392,7 +756,7 @@ void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
     BX_ENSURE(cx < m_cellsX && cy < m_cellsY);
 
     // Read cell data
-    SeekCellData(m_fileStream, sizeof(Cell::HeightData), m_cellsX, cx, cy);
+    SeekCellData(m_fileStream, GetCellDataStride(m_fileFlags), m_cellsX, cx, cy);
 
     i32 cellX = 0, cellY = 0;
     u32 avgHeight = 0;
@@ -402,9 +766,15 @@ void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
 
     //ENSURE(cellX == cx && cellY == cy); // Validate cell coordinates
 
-    static Cell::HeightData cellHeightData{};
+    auto& cellHeightData = cell.heights;
     m_fileStream.read((char*)cellHeightData.data(), sizeof(Cell::HeightData));
 
+    static Cell::OcclusionData cellOcclusionData{};
+    if (m_fileFlags & FILE_FLAGS_OCCLUSION)
+        m_fileStream.read((char*)cellOcclusionData.data(), sizeof(Cell::OcclusionData));
+    else
+        cellOcclusionData.fill(0xFF);
+
     // Update terrain buffers
     BufferData bufferData;
 
@@ -413,7 +783,7 @@ void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
     const u16* d = cellHeightData.data();
 
     // Vertex buffer
-    const f32 yScale = 1000.f / 0xFFFF;
+    const f32 yScale = Cell::HeightScale;
     const f32 worldX = cx * (Cell::Length - 1);
     const f32 worldY = cy * (Cell::Length - 1);
 
@@ -442,6 +812,8 @@ void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
 
     cell.center = (cell.aabb.max + cell.aabb.min) * 0.5f;
 
+    BuildHeightPyramid(cell);
+
     // Calculate normals and tangents
     for (i32 i = 1; i < h - 1; i++)
     {
@@ -456,96 +828,563 @@ void Terrain::ReadCell(u32 cx, u32 cy, Terrain::Cell& cell)
             Vec3 tangentX{ 1.0f, (hr - hl) * yScale, 0.0f };
             Vec3 tangentZ{ 0.0f, (hd - hu) * yScale, 1.0f };
 
-            auto& v = cell.vertices[(i - 1) * Cell::Length + (j - 1)];
+            const u32 vi = (i - 1) * Cell::Length + (j - 1);
+            auto& v = cell.vertices[vi];
             v.normal = Vec3::Cross(tangentZ, tangentX).Normalized();
             v.tangent = tangentX.Normalized();
+            v.occlusion = cellOcclusionData[vi] / 255.f;
         }
     }
 
     bufferData.dataSize = sizeof(Cell::VertexArray);
     bufferData.pData = cell.vertices.data();
 
-    if (cell.vertexBuffer == INVALID_GRAPHICS_HANDLE)
+    // Without graphics the vertices only live on the CPU
+    if (!m_nullGraphics)
     {
-        BufferInfo bufferInfo;
-        bufferInfo.type = BufferType::VERTEX_BUFFER;
-        bufferInfo.usage = BufferUsage::DYNAMIC;
-        bufferInfo.access = BufferAccess::WRITE;
-        bufferInfo.strideBytes = sizeof(Vertex);
+        if (cell.vertexBuffer == INVALID_GRAPHICS_HANDLE)
+        {
+            BufferInfo bufferInfo;
+            bufferInfo.type = BufferType::VERTEX_BUFFER;
+            bufferInfo.usage = BufferUsage::DYNAMIC;
+            bufferInfo.access = BufferAccess::WRITE;
+            bufferInfo.strideBytes = sizeof(Vertex);
 
-        cell.vertexBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
+            cell.vertexBuffer = Graphics::Get().CreateBuffer(bufferInfo, bufferData);
+        }
+        else
+        {
+            Graphics::Get().UpdateBuffer(cell.vertexBuffer, bufferData);
+        }
     }
-    else
+
+    cell.idx = cy * m_cellsX + cx;
+    m_metaCells[cell.idx].isLoaded = true;
+
+    // Culling reads the boxes every frame, they only change here
     {
-        Graphics::Get().UpdateBuffer(cell.vertexBuffer, bufferData);
+        const Vec3 e = (cell.aabb.max - cell.aabb.min) * 0.5f;
+        const f32 extent[3] = { e.x, e.y, e.z };
+        m_cellBoxes.set(cell.idx, Pga3d::ToPoint((cell.aabb.min + cell.aabb.max) * 0.5f), extent);
     }
+
+    // Cached cascades and clipmap no longer match the resident geometry
+    for (auto& cascade : m_cascades)
+        cascade.dirty = true;
+    m_clipmap.Invalidate(cell.aabb);
 }
 
-void Terrain::Update(const Camera& camera)
+// Clips [t0, t1] to the ray's interval inside the slab [lo, hi] along one axis
+static inline bool ClipSlab(f32 origin, f32 dir, f32 lo, f32 hi, f32& t0, f32& t1)
 {
-    if (!m_fileStream.is_open())
-        return;
+    if (dir == 0)
+        return origin >= lo && origin <= hi;
 
-    if (m_updateCamera)
-        m_cameraPos = Vec3(camera.GetInvView()[3].x, camera.GetInvView()[3].y, camera.GetInvView()[3].z);
+    const f32 invDir = 1.f / dir;
+    f32 ta = (lo - origin) * invDir;
+    f32 tb = (hi - origin) * invDir;
+    if (ta > tb)
+    {
+        const f32 tmp = ta;
+        ta = tb;
+        tb = tmp;
+    }
 
-    i32 camCellX = static_cast<i32>(floor(m_cameraPos.x / Cell::Length));
-    i32 camCellY = static_cast<i32>(floor(m_cameraPos.z / Cell::Length));
-    u32 idx = (u32)(camCellY * m_cellsX + camCellX);
+    t0 = ta > t0 ? ta : t0;
+    t1 = tb < t1 ? tb : t1;
+    return t0 <= t1;
+}
 
-    //auto& meta = m_metaCells[idx];
-    
-    //for (auto& cell : m_cells)
-    //{
-    //    f32 delta = (m_cameraPos - cell.center).Magnitude();
-    //    // TODO: Check if a non loaded cell is closer to camera and if so replace current cell with non loaded cell with:
-    //    // ReadCell(cellx, celly, cell);
-    //
-    //    cell.lod = Math::Clamp((i32)ceil(pow(delta, 1.3f) / 5000.f) - 1, 0, 7);
-    //}
+static inline bool RayTriangle(const Vec3& origin, const Vec3& dir, const Vec3& p0, const Vec3& p1, const Vec3& p2, f32& t)
+{
+    constexpr f32 eps = 1e-7f;
+
+    const Vec3 e1 = p1 - p0;
+    const Vec3 e2 = p2 - p0;
+    const Vec3 p = Vec3::Cross(dir, e2);
+    const f32 det = Vec3::Dot(e1, p);
+    if (fabs(det) < eps)
+        return false;
+
+    const f32 invDet = 1.f / det;
+    const Vec3 s = origin - p0;
+    const f32 u = Vec3::Dot(s, p) * invDet;
+    if (u < 0 || u > 1)
+        return false;
+
+    const Vec3 q = Vec3::Cross(s, e1);
+    const f32 v = Vec3::Dot(dir, q) * invDet;
+    if (v < 0 || u + v > 1)
+        return false;
+
+    t = Vec3::Dot(e2, q) * invDet;
+    return true;
 }
 
-void Terrain::Render(const Camera& camera)
+bool Terrain::RaycastCell(const Cell& cell, i32 cx, i32 cy, const Vec3& origin, const Vec3& dir, f32 tMin, f32 tMax, RaycastHit& hit) const
 {
+    constexpr u32 L = Cell::Length;
+    constexpr u32 N = Cell::NumQuads;
+    constexpr f32 eps = 1e-4f;
+
+    // Cells start one unit in, see ReadCell
+    const f32 cellX = (f32)(cx * (i32)N) + 1.f;
+    const f32 cellZ = (f32)(cy * (i32)N) + 1.f;
+
+    struct Node
+    {
+        u16 level;
+        u16 x;
+        u16 z;
+    };
+
+    // Children are pushed back to front so the first leaf hit is the nearest one
+    Node stack[4 * Cell::NumBoundsLevels];
+    u32 stackSize = 0;
+    stack[stackSize++] = Node{ (u16)(Cell::NumBoundsLevels - 1), 0, 0 };
+
+    const u16 nearX = dir.x >= 0 ? 0 : 1;
+    const u16 nearZ = dir.z >= 0 ? 0 : 1;
+
+    while (stackSize > 0)
+    {
+        const Node node = stack[--stackSize];
+        const f32 size = (f32)(1u << node.level);
+        const f32 x0 = cellX + node.x * size;
+        const f32 z0 = cellZ + node.z * size;
+
+        f32 t0 = tMin, t1 = tMax;
+        if (!ClipSlab(origin.x, dir.x, x0, x0 + size, t0, t1) || !ClipSlab(origin.z, dir.z, z0, z0 + size, t0, t1))
+            continue;
+
+        // Skip nodes the ray passes entirely above
+        const u32 n = N >> node.level;
+        const auto& bounds = cell.heightBounds[GetBoundsOffset(node.level) + node.z * n + node.x];
+        const f32 y0 = origin.y + dir.y * t0;
+        const f32 y1 = origin.y + dir.y * t1;
+        if ((y0 < y1 ? y0 : y1) > bounds.max)
+            continue;
+
+        if (node.level > 0)
+        {
+            const u16 level = node.level - 1;
+            const u16 x = node.x * 2;
+            const u16 z = node.z * 2;
+            stack[stackSize++] = Node{ level, (u16)(x + (1 - nearX)), (u16)(z + (1 - nearZ)) };
+            stack[stackSize++] = Node{ level, (u16)(x + (1 - nearX)), (u16)(z + nearZ) };
+            stack[stackSize++] = Node{ level, (u16)(x + nearX), (u16)(z + (1 - nearZ)) };
+            stack[stackSize++] = Node{ level, (u16)(x + nearX), (u16)(z + nearZ) };
+            continue;
+        }
+
+        // Leaf quad, same diagonal as the index buffers
+        const Vec3& p00 = cell.vertices[(node.z + 0) * L + (node.x + 0)].position;
+        const Vec3& p10 = cell.vertices[(node.z + 0) * L + (node.x + 1)].position;
+        const Vec3& p01 = cell.vertices[(node.z + 1) * L + (node.x + 0)].position;
+        const Vec3& p11 = cell.vertices[(node.z + 1) * L + (node.x + 1)].position;
+
+        f32 tBest = t1 + eps;
+        Vec3 a{}, b{}, c{};
+        bool found = false;
+
+        f32 t = 0;
+        if (RayTriangle(origin, dir, p00, p01, p10, t) && t >= t0 - eps && t < tBest)
+        {
+            tBest = t;
+            a = p00; b = p01; c = p10;
+            found = true;
+        }
+        if (RayTriangle(origin, dir, p10, p01, p11, t) && t >= t0 - eps && t < tBest)
+        {
+            tBest = t;
+            a = p10; b = p01; c = p11;
+            found = true;
+        }
+
+        if (found)
+        {
+            Vec3 normal = Vec3::Cross(b - a, c - a).Normalized();
+            if (normal.y < 0)
+                normal = normal * -1.f;
+
+            hit.distance = tBest;
+            hit.position = origin + dir * tBest;
+            hit.normal = normal;
+            hit.cell = cell.idx;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Terrain::Raycast(const Vec3& origin, const Vec3& direction, f32 maxDist, RaycastHit& hit) const
+{
+    if (m_cells.empty())
+        return false;
+
+    constexpr f32 span = (f32)(Cell::Length - 1);
+    const Vec3 dir = direction.Normalized();
+
+    // Clip to the terrain's extent, cells start one unit in
+    f32 t0 = 0, t1 = maxDist;
+    if (!ClipSlab(origin.x, dir.x, 1.f, 1.f + m_cellsX * span, t0, t1) || !ClipSlab(origin.z, dir.z, 1.f, 1.f + m_cellsY * span, t0, t1))
+        return false;
+
+    // 2D DDA over the cell grid
+    const f32 lx = origin.x - 1.f + dir.x * t0;
+    const f32 lz = origin.z - 1.f + dir.z * t0;
+    i32 cx = Math::Clamp((i32)floor(lx / span), 0, m_cellsX - 1);
+    i32 cy = Math::Clamp((i32)floor(lz / span), 0, m_cellsY - 1);
+
+    const i32 stepX = dir.x >= 0 ? 1 : -1;
+    const i32 stepY = dir.z >= 0 ? 1 : -1;
+    f32 tMaxX = dir.x != 0 ? (((cx + (stepX > 0 ? 1 : 0)) * span + 1.f) - origin.x) / dir.x : Math::F32Max;
+    f32 tMaxY = dir.z != 0 ? (((cy + (stepY > 0 ? 1 : 0)) * span + 1.f) - origin.z) / dir.z : Math::F32Max;
+    const f32 tDeltaX = dir.x != 0 ? span / fabs(dir.x) : Math::F32Max;
+    const f32 tDeltaY = dir.z != 0 ? span / fabs(dir.z) : Math::F32Max;
+
+    f32 tCell = t0;
+    while (tCell <= t1)
+    {
+        const f32 tNext = std::min(std::min(tMaxX, tMaxY), t1);
+        const u32 idx = cy * m_cellsX + cx;
+
+        if (m_metaCells[idx].isLoaded)
+        {
+            const auto& cell = m_cells[idx];
+            const f32 y0 = origin.y + dir.y * tCell;
+            const f32 y1 = origin.y + dir.y * tNext;
+            if (std::min(y0, y1) <= cell.aabb.max.y && RaycastCell(cell, cx, cy, origin, dir, tCell, tNext, hit))
+                return true;
+        }
+
+        if (tMaxX < tMaxY)
+        {
+            cx += stepX;
+            tCell = tMaxX;
+            tMaxX += tDeltaX;
+        }
+        else
+        {
+            cy += stepY;
+            tCell = tMaxY;
+            tMaxY += tDeltaY;
+        }
+
+        if (cx < 0 || cy < 0 || cx >= m_cellsX || cy >= m_cellsY)
+            break;
+    }
+
+    return false;
+}
+
+bool Terrain::HasLineOfSight(const Vec3& from, const Vec3& to) const
+{
+    const Vec3 delta = to - from;
+    const f32 dist = delta.Magnitude();
+    if (dist <= 0)
+        return true;
+
+    RaycastHit hit;
+    return !Raycast(from, delta * (1.f / dist), dist, hit);
+}
+
+// Bilinear kernels over a cell's bordered u16 heights, lx/lz are cell local coordinates
+struct SampleKernel
+{
+    static constexpr i32 W = Terrain::Cell::Length + 2;
+    static constexpr f32 MaxCoord = (f32)(Terrain::Cell::Length - 1) - 1e-3f;
+
+    static inline void Corners(const u16* heights, f32 lx, f32 lz, f32& fx, f32& fz, f32 h[4])
+    {
+        lx = lx < 0 ? 0 : lx > MaxCoord ? MaxCoord : lx;
+        lz = lz < 0 ? 0 : lz > MaxCoord ? MaxCoord : lz;
+        const i32 ix = (i32)lx, iz = (i32)lz;
+        fx = lx - ix;
+        fz = lz - iz;
+
+        const u16* p = heights + (iz + 1) * W + (ix + 1);
+        h[0] = p[0];
+        h[1] = p[1];
+        h[2] = p[W];
+        h[3] = p[W + 1];
+    }
+
+    static inline f32 Height(const u16* heights, f32 lx, f32 lz)
+    {
+        f32 fx, fz, h[4];
+        Corners(heights, lx, lz, fx, fz, h);
+        const f32 top = h[0] + (h[1] - h[0]) * fx;
+        const f32 bottom = h[2] + (h[3] - h[2]) * fx;
+        return (top + (bottom - top) * fz) * Terrain::Cell::HeightScale;
+    }
+
+    static inline Vec3 Normal(const u16* heights, f32 lx, f32 lz)
+    {
+        f32 fx, fz, h[4];
+        Corners(heights, lx, lz, fx, fz, h);
+        const f32 dx = ((h[1] - h[0]) + ((h[3] - h[2]) - (h[1] - h[0])) * fz) * Terrain::Cell::HeightScale;
+        const f32 dz = ((h[2] - h[0]) + ((h[3] - h[1]) - (h[2] - h[0])) * fx) * Terrain::Cell::HeightScale;
+        return Vec3{ -dx, 1.f, -dz }.Normalized();
+    }
+
+    // Contiguous points of one cell, 4 at a time with SSE2 for the index math and interpolation
+    template <bool Normals>
+    static void Run(const u16* heights, const f32* lx, const f32* lz, u32 count, f32* outHeights, Vec3* outNormals)
+    {
+        u32 i = 0;
+#ifdef TERRAIN_SSE2
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 maxCoord = _mm_set1_ps(MaxCoord);
+        const __m128 scale = _mm_set1_ps(Terrain::Cell::HeightScale);
+        const __m128 stride = _mm_set1_ps((f32)W);
+        const __m128 one = _mm_set1_ps(1.f);
+
+        alignas(16) i32 base[4];
+        alignas(16) f32 h00[4], h10[4], h01[4], h11[4];
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(lx + i), zero), maxCoord);
+            const __m128 z = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(lz + i), zero), maxCoord);
+            const __m128 ixf = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+            const __m128 izf = _mm_cvtepi32_ps(_mm_cvttps_epi32(z));
+            const __m128 fx = _mm_sub_ps(x, ixf);
+            const __m128 fz = _mm_sub_ps(z, izf);
+
+            // Row major index of the top left corner, exact in f32
+            const __m128 idx = _mm_add_ps(_mm_mul_ps(_mm_add_ps(izf, one), stride), _mm_add_ps(ixf, one));
+            _mm_store_si128((__m128i*)base, _mm_cvttps_epi32(idx));
+
+            for (u32 k = 0; k < 4; ++k)
+            {
+                const u16* p = heights + base[k];
+                h00[k] = p[0];
+                h10[k] = p[1];
+                h01[k] = p[W];
+                h11[k] = p[W + 1];
+            }
+
+            const __m128 a = _mm_load_ps(h00);
+            const __m128 b = _mm_load_ps(h10);
+            const __m128 c = _mm_load_ps(h01);
+            const __m128 d = _mm_load_ps(h11);
+
+            if constexpr (!Normals)
+            {
+                const __m128 top = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), fx));
+                const __m128 bottom = _mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(d, c), fx));
+                const __m128 h = _mm_mul_ps(_mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), fz)), scale);
+                _mm_storeu_ps(outHeights + i, h);
+            }
+            else
+            {
+                const __m128 ab = _mm_sub_ps(b, a);
+                const __m128 ac = _mm_sub_ps(c, a);
+                const __m128 dx = _mm_mul_ps(_mm_add_ps(ab, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(d, c), ab), fz)), scale);
+                const __m128 dz = _mm_mul_ps(_mm_add_ps(ac, _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(d, b), ac), fx)), scale);
+                const __m128 invLen = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(one, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz)))));
+
+                alignas(16) f32 nx[4], ny[4], nz[4];
+                _mm_store_ps(nx, _mm_mul_ps(_mm_sub_ps(zero, dx), invLen));
+                _mm_store_ps(ny, invLen);
+                _mm_store_ps(nz, _mm_mul_ps(_mm_sub_ps(zero, dz), invLen));
+                for (u32 k = 0; k < 4; ++k)
+                    outNormals[i + k] = Vec3{ nx[k], ny[k], nz[k] };
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if constexpr (!Normals)
+                outHeights[i] = Height(heights, lx[i], lz[i]);
+            else
+                outNormals[i] = Normal(heights, lx[i], lz[i]);
+        }
+    }
+};
+
+bool Terrain::FindCell(f32 x, f32 z, u32& idx, f32& lx, f32& lz) const
+{
+    // Cells share their border vertices and start one unit in
+    constexpr i32 span = Cell::Length - 1;
+    const i32 cx = (i32)floor((x - 1.f) / span);
+    const i32 cy = (i32)floor((z - 1.f) / span);
+    if (cx < 0 || cy < 0 || cx >= m_cellsX || cy >= m_cellsY || !m_metaCells[cy * m_cellsX + cx].isLoaded)
+        return false;
+
+    idx = cy * m_cellsX + cx;
+    lx = x - 1.f - cx * span;
+    lz = z - 1.f - cy * span;
+    return true;
+}
+
+bool Terrain::SampleHeight(f32 x, f32 z, f32& height) const
+{
+    u32 idx;
+    f32 lx, lz;
+    if (!FindCell(x, z, idx, lx, lz))
+        return false;
+
+    height = SampleKernel::Height(m_cells[idx].heights.data(), lx, lz);
+    return true;
+}
+
+bool Terrain::SampleNormal(f32 x, f32 z, Vec3& normal) const
+{
+    u32 idx;
+    f32 lx, lz;
+    if (!FindCell(x, z, idx, lx, lz))
+        return false;
+
+    normal = SampleKernel::Normal(m_cells[idx].heights.data(), lx, lz);
+    return true;
+}
+
+bool Terrain::SampleSurface(f32 x, f32 z, f32& height, Vec3& normal) const
+{
+    return SampleHeight(x, z, height) && SampleNormal(x, z, normal);
+}
+
+template <bool Normals>
+u32 Terrain::SampleBatch(const f32* xs, const f32* zs, u32 count, f32* outHeights, Vec3* outNormals, u8* outResident) const
+{
+    const u32 numCells = (u32)(m_cellsX * m_cellsY);
+    const u32 notResident = numCells;
+
+    // Per thread scratch so the batch API stays allocation free once warmed up
+    thread_local List<u32> cellOf{};
+    thread_local List<u32> offsets{};
+    thread_local List<u32> order{};
+    thread_local List<f32> pointX{};
+    thread_local List<f32> pointZ{};
+    thread_local List<f32> localX{};
+    thread_local List<f32> localZ{};
+    thread_local List<f32> heights{};
+    thread_local List<Vec3> normals{};
+
+    cellOf.resize(count);
+    offsets.assign(numCells + 2, 0);
+    order.resize(count);
+    pointX.resize(count);
+    pointZ.resize(count);
+    localX.resize(count);
+    localZ.resize(count);
+    if constexpr (Normals)
+        normals.resize(count);
+    else
+        heights.resize(count);
+
+    // Bucket points by cell (counting sort), non resident points go to the last bucket
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 cell;
+        if (!FindCell(xs[i], zs[i], cell, pointX[i], pointZ[i]))
+            cell = notResident;
+
+        cellOf[i] = cell;
+        offsets[cell + 1]++;
+    }
+
+    for (u32 c = 0; c < numCells + 1; ++c)
+        offsets[c + 1] += offsets[c];
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        const u32 cell = cellOf[i];
+        const u32 slot = offsets[cell]++;
+        order[slot] = i;
+        localX[slot] = pointX[i];
+        localZ[slot] = pointZ[i];
+    }
+
+    // offsets[c] now holds the end of bucket c
+    u32 begin = 0;
+    for (u32 c = 0; c < numCells; ++c)
+    {
+        const u32 end = offsets[c];
+        if (end > begin)
+        {
+            SampleKernel::Run<Normals>(m_cells[c].heights.data(), localX.data() + begin, localZ.data() + begin, end - begin,
+                Normals ? nullptr : heights.data() + begin, Normals ? normals.data() + begin : nullptr);
+        }
+        begin = end;
+    }
+    const u32 numResident = begin;
+
+    // Scatter back to the caller's order
+    for (u32 slot = 0; slot < count; ++slot)
+    {
+        const u32 i = order[slot];
+        const bool resident = slot < numResident;
+
+        if constexpr (Normals)
+            outNormals[i] = resident ? normals[slot] : Vec3{};
+        else
+            outHeights[i] = resident ? heights[slot] : 0.f;
+
+        if (outResident)
+            outResident[i] = resident ? 1 : 0;
+    }
+
+    return numResident;
+}
+
+u32 Terrain::SampleHeights(const f32* xs, const f32* zs, u32 count, f32* outHeights, u8* outResident) const
+{
+    return SampleBatch<false>(xs, zs, count, outHeights, nullptr, outResident);
+}
+
+u32 Terrain::SampleNormals(const f32* xs, const f32* zs, u32 count, Vec3* outNormals, u8* outResident) const
+{
+    return SampleBatch<true>(xs, zs, count, nullptr, outNormals, outResident);
+}
+
+void Terrain::Update(const Camera& camera)
+{
+    Update(camera.GetInvView());
+}
+
+void Terrain::Update(const Mat4& invView)
+{
+    m_frameStats = {};
     if (!m_fileStream.is_open())
         return;
 
-    BufferData bufferData;
-    bufferData.dataSize = sizeof(TerrainDrawData);
-    bufferData.pData = &m_drawData;
-    Graphics::Get().UpdateBuffer(m_drawBuffer, bufferData);
+    if (m_updateCamera)
+        m_cameraPos = Vec3(invView[3].x, invView[3].y, invView[3].z);
 
-    Graphics::Get().SetPipeline(m_pipeline);
-    Graphics::Get().CommitResources(m_pipeline, m_resources);
+    auto start = std::chrono::steady_clock::now();
 
-    if (m_updateFrustum)
-        m_frustum = camera.GetFrustum();
-    if (m_debugDraw) {} // TODO: Draw frustum
+    JobSystem::Get().ParallelFor(0, (i32)m_cells.size(), CellsPerJob, [&](i32 i)
+    {
+        auto& cell = m_cells[i];
+        const f32 delta = (m_cameraPos - cell.center).Magnitude();
+        cell.lod = Math::Clamp((i32)ceil(pow(delta, 1.3f) / 5000.f) - 1, 0, 7);
+    });
+    m_frameStats.lodMs = ElapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    m_clipmap.Update(*this, m_cameraPos);
+    m_frameStats.streamMs = ElapsedMs(start);
+}
 
+template <typename CullFn>
+void Terrain::DrawCells(i32 lodBias, CullFn&& isVisible)
+{
     for (const auto& cell : m_cells)
     {
-        if (m_debugDraw)
-            Debug::Get().DrawBox(cell.aabb, 0xFFFFFFFF);
+        if (cell.vertexBuffer == INVALID_GRAPHICS_HANDLE && !m_nullGraphics)
+            continue;
 
-        if (cell.vertexBuffer == INVALID_GRAPHICS_HANDLE)
+        if (!isVisible(cell))
             continue;
 
-        //if (m_debugDraw)
-        //{
-        //    i32 cellSize = Cell::Length;
-        //    for (i32 i = 0; i < Cell::Length - 1; i++)
-        //    {
-        //        for (i32 j = 0; j < Cell::Length - 1; j++)
-        //        {
-        //            DebugDraw::Get().Line(cell.vertices[(i + 0) * cellSize + (j + 0)].position, cell.vertices[(i + 1) * cellSize + (j + 0)].position, 0xFFFFFFFF);
-        //            DebugDraw::Get().Line(cell.vertices[(i + 0) * cellSize + (j + 0)].position, cell.vertices[(i + 0) * cellSize + (j + 1)].position, 0xFFFFFFFF);
-        //            DebugDraw::Get().Line(cell.vertices[(i + 1) * cellSize + (j + 1)].position, cell.vertices[(i + 1) * cellSize + (j + 0)].position, 0xFFFFFFFF);
-        //            DebugDraw::Get().Line(cell.vertices[(i + 1) * cellSize + (j + 1)].position, cell.vertices[(i + 0) * cellSize + (j + 1)].position, 0xFFFFFFFF);
-        //        }
-        //    }
-        //}
-
-        if (!Shape::Overlaps(m_frustum, cell.aabb))
+        const i32 lod = Math::Clamp((m_lod != -1 ? m_lod : cell.lod) + lodBias, 0, 7);
+        ++m_frameStats.draws;
+        m_frameStats.indices += LODIndexCounts[lod];
+        if (m_nullGraphics)
             continue;
 
         const u64 offset = 0;
@@ -553,7 +1392,6 @@ void Terrain::Render(const Camera& camera)
 
         Graphics::Get().SetVertexBuffers(0, 1, pBuffers, &offset);
 
-        const i32 lod = m_lod != -1 ? m_lod : cell.lod;
         const auto& indexBuffer = m_indexBuffers[lod];
         Graphics::Get().SetIndexBuffer(indexBuffer.buffer, 0);
 
@@ -566,4 +1404,284 @@ void Terrain::Render(const Camera& camera)
         //attribs.numVertices = (Cell::Length + 1) * (Cell::Length + 1);
         //Graphics::Get().Draw(attribs);
     }
+}
+
+void Terrain::UpdateCascades()
+{
+    // Light basis, any change in direction invalidates every cascade
+    Vec3 forward = m_drawData.lightDir.Normalized();
+    if (forward.x != m_lightForward.x || forward.y != m_lightForward.y || forward.z != m_lightForward.z)
+    {
+        for (auto& cascade : m_cascades)
+            cascade.dirty = true;
+    }
+
+    const Vec3 upRef = fabs(forward.y) > 0.99f ? Vec3{ 1, 0, 0 } : Vec3{ 0, 1, 0 };
+    m_lightForward = forward;
+    m_lightRight = Vec3::Cross(upRef, forward).Normalized();
+    m_lightUp = Vec3::Cross(forward, m_lightRight);
+
+    const Vec3 lightCamPos
+    {
+        Vec3::Dot(m_cameraPos, m_lightRight),
+        Vec3::Dot(m_cameraPos, m_lightUp),
+        Vec3::Dot(m_cameraPos, m_lightForward)
+    };
+
+    for (u32 i = 0; i < TerrainShadowData::NumCascades; ++i)
+    {
+        auto& cascade = m_cascades[i];
+
+        // Quadratic split distribution, each cascade is a camera centered sphere so it
+        // stays valid while the camera rotates and only has to be redrawn when it moves
+        const f32 t = (f32)(i + 1) / TerrainShadowData::NumCascades;
+        const f32 radius = m_shadowDistance * t * t;
+
+        // Snap to shadow map texels to avoid shimmering and to keep the cache stable
+        const f32 texelSize = (2.f * radius) / ShadowMapSize;
+        const Vec3 center
+        {
+            floor(lightCamPos.x / texelSize) * texelSize,
+            floor(lightCamPos.y / texelSize) * texelSize,
+            floor(lightCamPos.z / radius) * radius
+        };
+
+        if (radius != cascade.radius || center.x != cascade.center.x || center.y != cascade.center.y || center.z != cascade.center.z)
+        {
+            cascade.radius = radius;
+            cascade.center = center;
+            cascade.dirty = true;
+        }
+
+        // Orthographic light view projection. z is snapped down by up to a radius so the
+        // sphere around the camera reaches as far as center.z + 2 * radius
+        const f32 zNear = center.z - m_shadowDepthRange;
+        const f32 zFar = center.z + 2.f * radius;
+        const f32 invR = 1.f / radius;
+        const f32 invZ = 2.f / (zFar - zNear);
+
+        auto& viewProj = m_shadowData.viewProj[i];
+        viewProj[0] = Vec4{ m_lightRight.x * invR, m_lightUp.x * invR, m_lightForward.x * invZ, 0 };
+        viewProj[1] = Vec4{ m_lightRight.y * invR, m_lightUp.y * invR, m_lightForward.y * invZ, 0 };
+        viewProj[2] = Vec4{ m_lightRight.z * invR, m_lightUp.z * invR, m_lightForward.z * invZ, 0 };
+        viewProj[3] = Vec4{ -center.x * invR, -center.y * invR, -zNear * invZ - 1.f, 1 };
+
+        m_shadowData.splits[i] = radius;
+    }
+
+    m_shadowData.cameraPos = Vec4{ m_cameraPos.x, m_cameraPos.y, m_cameraPos.z, 1 };
+}
+
+void Terrain::RenderShadows()
+{
+    if (!m_fileStream.is_open())
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    m_shadowData.params.x = m_shadowsEnabled ? 1.f : 0.f;
+
+    if (m_shadowsEnabled)
+    {
+        UpdateCascades();
+
+        if (!m_nullGraphics)
+            Graphics::Get().SetPipeline(m_shadowPipeline);
+
+        for (u32 i = 0; i < TerrainShadowData::NumCascades; ++i)
+        {
+            auto& cascade = m_cascades[i];
+            if (!cascade.dirty)
+                continue;
+
+            if (!m_nullGraphics)
+            {
+                BufferData bufferData;
+                bufferData.dataSize = sizeof(Mat4);
+                bufferData.pData = &m_shadowData.viewProj[i];
+                Graphics::Get().UpdateBuffer(m_shadowBuffer, bufferData);
+
+                Graphics::Get().CommitResources(m_shadowPipeline, m_shadowResources);
+                Graphics::Get().SetRenderTargets(0, nullptr, cascade.depthTexture);
+                Graphics::Get().ClearDepthStencil(cascade.depthTexture, 1.f);
+            }
+
+            const f32 radius = cascade.radius;
+            const f32 zNear = cascade.center.z - m_shadowDepthRange;
+            const f32 zFar = cascade.center.z + 2.f * radius;
+
+            // Same cell culling as the main pass but against the cascade's light space box,
+            // far cascades also use a coarser LOD
+            DrawCells(cascade.lodBias, [&](const Cell& cell)
+            {
+                const Vec3 c = cell.center;
+                const Vec3 e = (cell.aabb.max - cell.aabb.min) * 0.5f;
+
+                const f32 cx = Vec3::Dot(c, m_lightRight) - cascade.center.x;
+                const f32 cy = Vec3::Dot(c, m_lightUp) - cascade.center.y;
+                const f32 cz = Vec3::Dot(c, m_lightForward);
+
+                const f32 ex = fabs(m_lightRight.x) * e.x + fabs(m_lightRight.y) * e.y + fabs(m_lightRight.z) * e.z;
+                const f32 ey = fabs(m_lightUp.x) * e.x + fabs(m_lightUp.y) * e.y + fabs(m_lightUp.z) * e.z;
+                const f32 ez = fabs(m_lightForward.x) * e.x + fabs(m_lightForward.y) * e.y + fabs(m_lightForward.z) * e.z;
+
+                return fabs(cx) <= radius + ex && fabs(cy) <= radius + ey && cz + ez >= zNear && cz - ez <= zFar;
+            });
+
+            cascade.dirty = false;
+        }
+    }
+
+    if (!m_nullGraphics)
+    {
+        BufferData bufferData;
+        bufferData.dataSize = sizeof(TerrainShadowData);
+        bufferData.pData = &m_shadowData;
+        Graphics::Get().UpdateBuffer(m_cascadeBuffer, bufferData);
+    }
+
+    m_frameStats.submitMs += ElapsedMs(start);
+}
+
+void Terrain::Render(const Camera& camera)
+{
+    if (m_updateFrustum)
+        m_frustum = camera.GetFrustum();
+
+    Render(camera.GetProj(), camera.GetInvView());
+}
+
+void Terrain::Render(const Mat4& proj, const Mat4& invView)
+{
+    if (!m_fileStream.is_open())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (!m_nullGraphics)
+    {
+        BufferData bufferData;
+        bufferData.dataSize = sizeof(TerrainDrawData);
+        bufferData.pData = &m_drawData;
+        Graphics::Get().UpdateBuffer(m_drawBuffer, bufferData);
+
+        bufferData.dataSize = sizeof(TerrainClipmapData);
+        bufferData.pData = &m_clipmap.GetData();
+        Graphics::Get().UpdateBuffer(m_clipmapBuffer, bufferData);
+
+        Graphics::Get().SetPipeline(m_pipeline);
+        Graphics::Get().CommitResources(m_pipeline, m_resources);
+    }
+
+    m_frameStats.submitMs += ElapsedMs(start);
+    start = std::chrono::steady_clock::now();
+
+    if (m_updateFrustum)
+    {
+        // Planes are only extracted when the projection changes, moving the camera sandwiches them
+        if (std::memcmp(&proj, &m_cullProj, sizeof(Mat4)) != 0)
+        {
+            m_cullProj = proj;
+            Pga3d::FrustumPlanes(proj, m_viewPlanes);
+        }
+        m_cameraMotor = Pga3d::ToMotor(invView);
+        sandwich(m_cameraMotor, m_viewPlanes, m_cullPlanes, 6);
+    }
+
+    if (m_debugDraw)
+    {
+        for (const auto& cell : m_cells)
+            Debug::Get().DrawBox(cell.aabb, 0xFFFFFFFF);
+    }
+
+    // Both paths test the world space planes of proj and invView from above
+    m_frameStats.visibleCells = m_pgaCulling ? CullCells() : CullCellsSerial();
+    m_frameStats.cullMs = ElapsedMs(start);
+    start = std::chrono::steady_clock::now();
+
+    DrawCells(0, [&](const Cell& cell)
+    {
+        return m_cellVisible[&cell - &m_cells[0]] != 0;
+    });
+
+    m_frameStats.submitMs += ElapsedMs(start);
+}
+
+u32 Terrain::CullCells()
+{
+    const u32 count = (u32)m_cells.size();
+    m_cellVisible.resize(count);
+
+    // Ranges stay a multiple of the lane group so no two jobs write the same one
+    static_assert(CellsPerJob % box_soa::Lanes == 0);
+    std::atomic<u32> numVisible{ 0 };
+    JobSystem::Get().ParallelRanges(0, (i32)count, CellsPerJob, [&](i32 from, i32 to)
+    {
+        numVisible += (u32)cull(m_cullPlanes, 6, m_cellBoxes, from, to, m_cellVisible.data());
+    });
+
+    return numVisible;
+}
+
+u32 Terrain::CullCellsSerial()
+{
+    m_cellVisible.resize(m_cells.size());
+
+    u32 numVisible = 0;
+    for (size_t i = 0; i < m_cells.size(); ++i)
+    {
+        const Box3& aabb = m_cells[i].aabb;
+        const point_t center = Pga3d::ToPoint((aabb.min + aabb.max) * 0.5f);
+        const Vec3 e = (aabb.max - aabb.min) * 0.5f;
+        const f32 extent[3] = { e.x, e.y, e.z };
+
+        bool visible = true;
+        for (u32 p = 0; p < 6 && visible; ++p)
+            visible = box_distance(m_cullPlanes[p], center, extent) >= 0.f;
+
+        m_cellVisible[i] = visible ? 1 : 0;
+        numVisible += visible ? 1 : 0;
+    }
+
+    return numVisible;
+}
+
+Terrain::CullBenchmark Terrain::BenchmarkCulling(u32 iterations)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    CullBenchmark result;
+    result.cells = (u32)m_cells.size();
+    result.iterations = iterations;
+    if (m_cells.empty() || iterations == 0)
+        return result;
+
+    // Every row tests the same world space planes, moving them is per frame and not per cell
+    sandwich(m_cameraMotor, m_viewPlanes, m_cullPlanes, 6);
+
+    auto start = Clock::now();
+    for (u32 i = 0; i < iterations; ++i)
+    {
+        u32 visible = 0;
+        for (const auto& cell : m_cells)
+            visible += Shape::Overlaps(m_frustum, cell.aabb) ? 1 : 0;
+        result.overlapsVisible = visible;
+    }
+    result.overlapsMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+    start = Clock::now();
+    for (u32 i = 0; i < iterations; ++i)
+        result.pgaSerialVisible = CullCellsSerial();
+    result.pgaSerialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+    start = Clock::now();
+    for (u32 i = 0; i < iterations; ++i)
+        result.pgaParallelVisible = CullCells();
+    result.pgaParallelMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+    BX_LOGI(Log, "Terrain culling, {} cells: Shape::Overlaps {} ms ({} visible), pga3d {} ms ({} visible), "
+        "pga3d batched on {} threads {} ms ({} visible)", result.cells, result.overlapsMs, result.overlapsVisible,
+        result.pgaSerialMs, result.pgaSerialVisible, JobSystem::Get().GetNumThreads(), result.pgaParallelMs, result.pgaParallelVisible);
+
+    return result;
 }
\ No newline at end of file
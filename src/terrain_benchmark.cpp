@@ -0,0 +1,217 @@
+#include <terrain_benchmark.hpp>
+#include <terrain.hpp>
+#include <job_system.hpp>
+
+#include <engine/file.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+
+static constexpr f32 Pi = 3.14159265f;
+static constexpr f32 NearPlane = 0.5f;
+static constexpr f32 FarPlane = 4000.f;
+static constexpr f32 Pitch = 20.f * Pi / 180.f;
+
+// Camera to world, looking down -z like the projection below
+static Mat4 LookAlong(const Vec3& position, const Vec3& forward)
+{
+    const Vec3 right = Vec3::Cross(forward, Vec3{ 0, 1, 0 }).Normalized();
+    const Vec3 up = Vec3::Cross(right, forward);
+
+    Mat4 m{};
+    m[0] = Vec4{ right.x, right.y, right.z, 0 };
+    m[1] = Vec4{ up.x, up.y, up.z, 0 };
+    m[2] = Vec4{ -forward.x, -forward.y, -forward.z, 0 };
+    m[3] = Vec4{ position.x, position.y, position.z, 1 };
+    return m;
+}
+
+// Right handed perspective with -1..1 clip depth, what Pga3d::FrustumPlanes expects by default
+static Mat4 Perspective(f32 fovDegrees, f32 aspect, f32 zNear, f32 zFar)
+{
+    const f32 f = 1.f / tan(fovDegrees * Pi / 360.f);
+
+    Mat4 m{};
+    m[0] = Vec4{ f / aspect, 0, 0, 0 };
+    m[1] = Vec4{ 0, f, 0, 0 };
+    m[2] = Vec4{ 0, 0, (zFar + zNear) / (zNear - zFar), -1 };
+    m[3] = Vec4{ 0, 0, 2.f * zFar * zNear / (zNear - zFar), 0 };
+    return m;
+}
+
+// Figure eight over the middle of the terrain, t in [0, 1) is one lap
+static Vec3 FlightPath(const Terrain& terrain, f32 t, f32 altitude)
+{
+    const f32 sizeX = (f32)(terrain.GetCellsX() * (Terrain::Cell::Length - 1));
+    const f32 sizeZ = (f32)(terrain.GetCellsY() * (Terrain::Cell::Length - 1));
+    const f32 angle = 2.f * Pi * t;
+
+    Vec3 position
+    {
+        sizeX * (0.5f + 0.4f * sin(angle)),
+        0,
+        sizeZ * (0.5f + 0.2f * sin(2.f * angle))
+    };
+
+    f32 ground = 0;
+    terrain.SampleHeight(position.x, position.z, ground);
+    position.y = ground + altitude;
+    return position;
+}
+
+struct PhaseSummary
+{
+    f32 mean{ 0 };
+    f32 p50{ 0 };
+    f32 p95{ 0 };
+    f32 max{ 0 };
+};
+
+static PhaseSummary Summarize(List<f32> samples)
+{
+    PhaseSummary summary;
+    if (samples.empty())
+        return summary;
+
+    std::sort(samples.begin(), samples.end());
+
+    f32 total = 0;
+    for (f32 ms : samples)
+        total += ms;
+
+    const size_t n = samples.size();
+    summary.mean = total / n;
+    summary.p50 = samples[n / 2];
+    summary.p95 = samples[std::min(n - 1, (size_t)(n * 0.95f))];
+    summary.max = samples.back();
+    return summary;
+}
+
+bool TerrainBenchmark::ParseArgs(int argc, char** args, Options& options)
+{
+    bool enabled = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(args[i], "--benchmark") == 0 && hasValue)
+        {
+            enabled = true;
+            options.terrainPath = args[++i];
+        }
+        else if (std::strcmp(args[i], "--frames") == 0 && hasValue)
+            options.frames = (u32)std::strtoul(args[++i], nullptr, 10);
+        else if (std::strcmp(args[i], "--warmup") == 0 && hasValue)
+            options.warmup = (u32)std::strtoul(args[++i], nullptr, 10);
+        else if (std::strcmp(args[i], "--threads") == 0 && hasValue)
+            options.threads = (i32)std::strtol(args[++i], nullptr, 10);
+        else if (std::strcmp(args[i], "--csv") == 0 && hasValue)
+            options.csvPath = args[++i];
+    }
+    return enabled;
+}
+
+int TerrainBenchmark::Run(const Options& options)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (options.frames == 0)
+    {
+        std::fprintf(stderr, "benchmark: --frames must be at least 1\n");
+        return 1;
+    }
+
+    JobSystem::Get().Initialize(options.threads);
+
+    Terrain terrain;
+    terrain.SetNullGraphics(true);
+    terrain.Initialize();
+
+    auto start = Clock::now();
+    terrain.OpenStream(options.terrainPath);
+    const f32 loadMs = std::chrono::duration<f32, std::milli>(Clock::now() - start).count();
+
+    if (terrain.GetCellsX() <= 0 || terrain.GetCellsY() <= 0)
+    {
+        std::fprintf(stderr, "benchmark: can't read terrain '%s'\n", options.terrainPath.c_str());
+        terrain.Shutdown();
+        JobSystem::Get().Shutdown();
+        return 1;
+    }
+
+    OutputFileStream csv{};
+    if (!options.csvPath.empty())
+    {
+        csv.open(File::Get().GetPath(options.csvPath));
+        csv << "frame,stream_ms,lod_ms,cull_ms,submit_ms,frame_ms,visible_cells,draws,indices\n";
+    }
+
+    const Mat4 proj = Perspective(options.fov, options.aspect, NearPlane, FarPlane);
+
+    List<f32> stream{}, lod{}, cull{}, submit{}, frame{};
+    u64 totalVisible = 0, totalDraws = 0;
+
+    const u32 numFrames = options.warmup + options.frames;
+    for (u32 i = 0; i < numFrames; ++i)
+    {
+        // Faces along the path, looking down by a fixed pitch
+        const f32 t = (f32)i / numFrames;
+        const Vec3 position = FlightPath(terrain, t, options.altitude);
+        Vec3 heading = FlightPath(terrain, t + 0.001f, options.altitude) - position;
+        heading.y = 0;
+        heading = heading.Normalized();
+
+        const Vec3 forward{ heading.x * cos(Pitch), -sin(Pitch), heading.z * cos(Pitch) };
+        const Mat4 invView = LookAlong(position, forward);
+
+        start = Clock::now();
+        terrain.Update(invView);
+        terrain.RenderShadows();
+        terrain.Render(proj, invView);
+        const f32 frameMs = std::chrono::duration<f32, std::milli>(Clock::now() - start).count();
+
+        if (i < options.warmup)
+            continue;
+
+        const auto& stats = terrain.GetFrameStats();
+        stream.emplace_back(stats.streamMs);
+        lod.emplace_back(stats.lodMs);
+        cull.emplace_back(stats.cullMs);
+        submit.emplace_back(stats.submitMs);
+        frame.emplace_back(frameMs);
+        totalVisible += stats.visibleCells;
+        totalDraws += stats.draws;
+
+        if (csv.is_open())
+        {
+            csv << (i - options.warmup) << ',' << stats.streamMs << ',' << stats.lodMs << ',' << stats.cullMs << ','
+                << stats.submitMs << ',' << frameMs << ',' << stats.visibleCells << ',' << stats.draws << ',' << stats.indices << '\n';
+        }
+    }
+
+    std::printf("Terrain benchmark: %s, %dx%d cells, %u frames, %u job threads, load %.2f ms\n",
+        options.terrainPath.c_str(), terrain.GetCellsX(), terrain.GetCellsY(), options.frames,
+        JobSystem::Get().GetNumThreads(), loadMs);
+    std::printf("%-10s %10s %10s %10s %10s\n", "phase", "mean ms", "p50 ms", "p95 ms", "max ms");
+
+    const std::pair<const char*, const List<f32>*> phases[] =
+    {
+        { "stream", &stream }, { "lod", &lod }, { "cull", &cull }, { "submit", &submit }, { "frame", &frame }
+    };
+    for (const auto& [name, samples] : phases)
+    {
+        const PhaseSummary summary = Summarize(*samples);
+        std::printf("%-10s %10.3f %10.3f %10.3f %10.3f\n", name, summary.mean, summary.p50, summary.p95, summary.max);
+    }
+
+    std::printf("visible cells %.1f, draws %.1f per frame\n",
+        (double)totalVisible / options.frames, (double)totalDraws / options.frames);
+
+    terrain.CloseStream();
+    terrain.Shutdown();
+    JobSystem::Get().Shutdown();
+    return 0;
+}
@@ -0,0 +1,450 @@
+#include <terrain_clipmap.hpp>
+#include <terrain.hpp>
+#include <asset_pack.hpp>
+#include <job_system.hpp>
+
+#include <engine/guard.hpp>
+#include <engine/debug.hpp>
+#include <engine/file.hpp>
+
+#include <stb_image.h>
+
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+static inline i32 WrapTexel(i32 t)
+{
+    const i32 m = t % (i32)TerrainClipmap::LevelSize;
+    return m < 0 ? m + (i32)TerrainClipmap::LevelSize : m;
+}
+
+static inline f32 Ramp(f32 v, f32 lo, f32 hi, f32 soft)
+{
+    const f32 inside = (v - lo) < (hi - v) ? (v - lo) : (hi - v);
+    return Math::Clamp(inside / soft + 1.f, 0.f, 1.f);
+}
+
+static inline void SampleMip(const List<u32>& texels, i32 width, i32 height, f32 u, f32 v, f32 weight, f32 rgba[4])
+{
+    i32 x = (i32)floor(u * width) % width;
+    i32 y = (i32)floor(v * height) % height;
+    x = x < 0 ? x + width : x;
+    y = y < 0 ? y + height : y;
+
+    const u32 c = texels[(size_t)y * width + x];
+    rgba[0] += weight * ((c >> 0) & 0xFF);
+    rgba[1] += weight * ((c >> 8) & 0xFF);
+    rgba[2] += weight * ((c >> 16) & 0xFF);
+    rgba[3] += weight * ((c >> 24) & 0xFF);
+}
+
+void TerrainClipmap::Initialize(bool createTexture)
+{
+    if (createTexture)
+    {
+        TextureInfo textureInfo;
+        textureInfo.width = LevelSize * TerrainClipmapData::NumLevels;
+        textureInfo.height = LevelSize;
+        textureInfo.format = TextureFormat::RGBA8_UNORM;
+        textureInfo.flags = TextureFlags::SHADER_RESOURCE;
+
+        BufferData textureData;
+        textureData.dataSize = 0;
+        textureData.pData = nullptr;
+
+        m_texture = Graphics::Get().CreateTexture(textureInfo, textureData);
+    }
+
+    for (u32 i = 0; i < TerrainClipmapData::NumLevels; ++i)
+    {
+        auto& level = m_levels[i];
+        level.density = m_baseDensity / (f32)(1 << i);
+        level.valid = false;
+        level.texels.resize(LevelSize * LevelSize);
+    }
+
+    m_uploadScratch.resize(LevelSize * LevelSize);
+}
+
+void TerrainClipmap::Shutdown()
+{
+    if (m_texture != INVALID_GRAPHICS_HANDLE)
+        Graphics::Get().DestroyTexture(m_texture);
+    m_texture = INVALID_GRAPHICS_HANDLE;
+
+    m_layers.clear();
+    for (auto& level : m_levels)
+    {
+        level.valid = false;
+        level.texels.clear();
+    }
+}
+
+void TerrainClipmap::AddLayer(const TerrainMaterialLayer& desc)
+{
+    BX_ENSURE(m_layers.size() < MaxLayers);
+
+    i32 width = 0, height = 0, channels = 0;
+    u8* data = nullptr;
+
+    AssetPack::Blob blob{};
+    if (AssetPack::Resolve(desc.texturePath, blob))
+    {
+        data = stbi_load_from_memory(blob.data, (i32)blob.size, &width, &height, &channels, 4);
+    }
+    else
+    {
+        const auto filepath = File::Get().GetPath(desc.texturePath);
+        data = stbi_load(filepath, &width, &height, &channels, 4);
+    }
+
+    if (data == nullptr)
+    {
+        BX_LOGE(Log, "Failed to load terrain material: {}", desc.texturePath);
+        return;
+    }
+
+    Layer layer{};
+    layer.desc = desc;
+
+    // Box filtered mip chain so coarse levels don't alias
+    MipImage mip0{};
+    mip0.width = width;
+    mip0.height = height;
+    mip0.texels.resize((size_t)width * height);
+    memcpy(mip0.texels.data(), data, mip0.texels.size() * sizeof(u32));
+    layer.mips.emplace_back(std::move(mip0));
+    stbi_image_free(data);
+
+    while (layer.mips.back().width > 1 && layer.mips.back().height > 1)
+    {
+        const auto& src = layer.mips.back();
+
+        MipImage mip{};
+        mip.width = src.width / 2;
+        mip.height = src.height / 2;
+        mip.texels.resize((size_t)mip.width * mip.height);
+
+        for (i32 y = 0; y < mip.height; ++y)
+        {
+            for (i32 x = 0; x < mip.width; ++x)
+            {
+                const u32 c[4] =
+                {
+                    src.texels[(size_t)(y * 2 + 0) * src.width + (x * 2 + 0)],
+                    src.texels[(size_t)(y * 2 + 0) * src.width + (x * 2 + 1)],
+                    src.texels[(size_t)(y * 2 + 1) * src.width + (x * 2 + 0)],
+                    src.texels[(size_t)(y * 2 + 1) * src.width + (x * 2 + 1)]
+                };
+
+                u32 res = 0;
+                for (u32 ch = 0; ch < 32; ch += 8)
+                {
+                    const u32 sum = ((c[0] >> ch) & 0xFF) + ((c[1] >> ch) & 0xFF) + ((c[2] >> ch) & 0xFF) + ((c[3] >> ch) & 0xFF);
+                    res |= ((sum + 2) / 4) << ch;
+                }
+                mip.texels[(size_t)y * mip.width + x] = res;
+            }
+        }
+
+        layer.mips.emplace_back(std::move(mip));
+    }
+
+    m_layers.emplace_back(std::move(layer));
+    Invalidate();
+}
+
+void TerrainClipmap::SetBaseDensity(f32 baseDensity)
+{
+    m_baseDensity = baseDensity;
+    for (u32 i = 0; i < TerrainClipmapData::NumLevels; ++i)
+        m_levels[i].density = m_baseDensity / (f32)(1 << i);
+
+    Invalidate();
+}
+
+void TerrainClipmap::Invalidate()
+{
+    for (auto& level : m_levels)
+    {
+        level.valid = false;
+        level.dirty = false;
+    }
+}
+
+void TerrainClipmap::Invalidate(const Box3& bounds)
+{
+    for (auto& level : m_levels)
+    {
+        // Invalid levels are baked in full anyway
+        if (!level.valid)
+            continue;
+
+        // One texel of padding for the bilinear normals along the edges
+        const i32 minX = (i32)floor(bounds.min.x * level.density) - 1;
+        const i32 minZ = (i32)floor(bounds.min.z * level.density) - 1;
+        const i32 maxX = (i32)ceil(bounds.max.x * level.density) + 1;
+        const i32 maxZ = (i32)ceil(bounds.max.z * level.density) + 1;
+
+        if (!level.dirty)
+        {
+            level.dirty = true;
+            level.dirtyMinX = minX;
+            level.dirtyMinZ = minZ;
+            level.dirtyMaxX = maxX;
+            level.dirtyMaxZ = maxZ;
+        }
+        else
+        {
+            level.dirtyMinX = std::min(level.dirtyMinX, minX);
+            level.dirtyMinZ = std::min(level.dirtyMinZ, minZ);
+            level.dirtyMaxX = std::max(level.dirtyMaxX, maxX);
+            level.dirtyMaxZ = std::max(level.dirtyMaxZ, maxZ);
+        }
+    }
+}
+
+u32 TerrainClipmap::BakeTexel(const Terrain& terrain, const Level& level, i32 tx, i32 tz) const
+{
+    const f32 x = (tx + 0.5f) / level.density;
+    const f32 z = (tz + 0.5f) / level.density;
+
+    f32 h = 0;
+    Vec3 n{};
+    if (!terrain.SampleSurface(x, z, h, n))
+        return 0; // Zero alpha falls back to the default albedo
+
+    // Layer weights from height and slope
+    const f32 slope = 1.f - fabs(n.y);
+
+    f32 weights[MaxLayers]{};
+    f32 weightSum = 0;
+    for (u32 i = 0; i < m_layers.size(); ++i)
+    {
+        const auto& desc = m_layers[i].desc;
+        const f32 heightSoft = desc.blend * (desc.maxHeight - desc.minHeight) + 1e-3f;
+        const f32 slopeSoft = desc.blend + 1e-3f;
+        weights[i] = Ramp(h, desc.minHeight, desc.maxHeight, heightSoft) * Ramp(slope, desc.minSlope, desc.maxSlope, slopeSoft);
+        weightSum += weights[i];
+    }
+
+    if (weightSum <= 0)
+    {
+        weights[0] = 1;
+        weightSum = 1;
+    }
+
+    // Triplanar projection weights, steep texels use the side projections instead of stretching
+    f32 px = n.x * n.x, py = n.y * n.y, pz = n.z * n.z;
+    px *= px; py *= py; pz *= pz;
+    const f32 pSum = px + py + pz;
+    px /= pSum; py /= pSum; pz /= pSum;
+
+    f32 rgba[4]{};
+    for (u32 i = 0; i < m_layers.size(); ++i)
+    {
+        const f32 w = weights[i] / weightSum;
+        if (w < (1.f / 255.f))
+            continue;
+
+        const auto& layer = m_layers[i];
+        const f32 tiling = layer.desc.tiling;
+
+        // Pick the mip whose texel footprint matches a cache texel
+        const f32 footprint = (tiling * layer.mips[0].width) / level.density;
+        u32 mipIdx = footprint > 1.f ? (u32)log2(footprint) : 0;
+        mipIdx = mipIdx < layer.mips.size() ? mipIdx : (u32)layer.mips.size() - 1;
+        const auto& mip = layer.mips[mipIdx];
+
+        if (py > 0.01f)
+            SampleMip(mip.texels, mip.width, mip.height, x * tiling, z * tiling, w * py, rgba);
+        if (px > 0.01f)
+            SampleMip(mip.texels, mip.width, mip.height, z * tiling, h * tiling, w * px, rgba);
+        if (pz > 0.01f)
+            SampleMip(mip.texels, mip.width, mip.height, x * tiling, h * tiling, w * pz, rgba);
+    }
+
+    const u32 r = (u32)Math::Clamp(rgba[0] + 0.5f, 0.f, 255.f);
+    const u32 g = (u32)Math::Clamp(rgba[1] + 0.5f, 0.f, 255.f);
+    const u32 b = (u32)Math::Clamp(rgba[2] + 0.5f, 0.f, 255.f);
+    return r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
+
+void TerrainClipmap::BakeColumns(const Terrain& terrain, u32 levelIdx, i32 fromX, i32 toX, bool parallel)
+{
+    auto& level = m_levels[levelIdx];
+
+    auto bakeRow = [&](i32 tz)
+    {
+        u32* row = level.texels.data() + (size_t)WrapTexel(tz) * LevelSize;
+        for (i32 tx = fromX; tx < toX; ++tx)
+            row[WrapTexel(tx)] = BakeTexel(terrain, level, tx, tz);
+    };
+
+    if (parallel)
+    {
+        JobSystem::Get().ParallelFor(level.originZ, level.originZ + (i32)LevelSize, 0, bakeRow);
+    }
+    else
+    {
+        for (i32 tz = level.originZ; tz < level.originZ + (i32)LevelSize; ++tz)
+            bakeRow(tz);
+    }
+
+    // Toroidal column range may wrap around the level
+    const u32 x0 = (u32)WrapTexel(fromX);
+    const u32 width = (u32)(toX - fromX);
+    const u32 first = width < (LevelSize - x0) ? width : (LevelSize - x0);
+    Upload(levelIdx, x0, 0, first, LevelSize);
+    if (first < width)
+        Upload(levelIdx, 0, 0, width - first, LevelSize);
+}
+
+void TerrainClipmap::BakeRows(const Terrain& terrain, u32 levelIdx, i32 fromZ, i32 toZ)
+{
+    auto& level = m_levels[levelIdx];
+
+    for (i32 tz = fromZ; tz < toZ; ++tz)
+    {
+        u32* row = level.texels.data() + (size_t)WrapTexel(tz) * LevelSize;
+        for (i32 tx = level.originX; tx < level.originX + (i32)LevelSize; ++tx)
+            row[WrapTexel(tx)] = BakeTexel(terrain, level, tx, tz);
+    }
+
+    const u32 y0 = (u32)WrapTexel(fromZ);
+    const u32 height = (u32)(toZ - fromZ);
+    const u32 first = height < (LevelSize - y0) ? height : (LevelSize - y0);
+    Upload(levelIdx, 0, y0, LevelSize, first);
+    if (first < height)
+        Upload(levelIdx, 0, 0, LevelSize, height - first);
+}
+
+void TerrainClipmap::BakeDirty(const Terrain& terrain, u32 levelIdx)
+{
+    auto& level = m_levels[levelIdx];
+    level.dirty = false;
+
+    // Only the part inside the resident window
+    const i32 minX = std::max(level.dirtyMinX, level.originX);
+    const i32 minZ = std::max(level.dirtyMinZ, level.originZ);
+    const i32 maxX = std::min(level.dirtyMaxX, level.originX + (i32)LevelSize);
+    const i32 maxZ = std::min(level.dirtyMaxZ, level.originZ + (i32)LevelSize);
+    if (minX >= maxX || minZ >= maxZ)
+        return;
+
+    JobSystem::Get().ParallelFor(minZ, maxZ, 0, [&](i32 tz)
+    {
+        u32* row = level.texels.data() + (size_t)WrapTexel(tz) * LevelSize;
+        for (i32 tx = minX; tx < maxX; ++tx)
+            row[WrapTexel(tx)] = BakeTexel(terrain, level, tx, tz);
+    });
+
+    // The region may wrap around the level on both axes
+    const u32 x0 = (u32)WrapTexel(minX);
+    const u32 z0 = (u32)WrapTexel(minZ);
+    const u32 width = (u32)(maxX - minX);
+    const u32 height = (u32)(maxZ - minZ);
+    const u32 firstX = std::min(width, LevelSize - x0);
+    const u32 firstZ = std::min(height, LevelSize - z0);
+
+    Upload(levelIdx, x0, z0, firstX, firstZ);
+    Upload(levelIdx, 0, z0, width - firstX, firstZ);
+    Upload(levelIdx, x0, 0, firstX, height - firstZ);
+    Upload(levelIdx, 0, 0, width - firstX, height - firstZ);
+}
+
+void TerrainClipmap::Upload(u32 levelIdx, u32 x, u32 y, u32 width, u32 height)
+{
+    // Baked on the CPU only, see Initialize
+    if (width == 0 || height == 0 || m_texture == INVALID_GRAPHICS_HANDLE)
+        return;
+
+    const auto& level = m_levels[levelIdx];
+    for (u32 row = 0; row < height; ++row)
+        memcpy(m_uploadScratch.data() + (size_t)row * width, level.texels.data() + (size_t)(y + row) * LevelSize + x, width * sizeof(u32));
+
+    TextureRegion region;
+    region.x = levelIdx * LevelSize + x;
+    region.y = y;
+    region.width = width;
+    region.height = height;
+
+    BufferData textureData;
+    textureData.dataSize = width * height * sizeof(u32);
+    textureData.pData = m_uploadScratch.data();
+
+    Graphics::Get().UpdateTexture(m_texture, region, textureData);
+}
+
+void TerrainClipmap::Update(const Terrain& terrain, const Vec3& cameraPos)
+{
+    m_data.params = Vec4{ 0, (f32)LevelSize, (f32)TerrainClipmapData::NumLevels, 0 };
+    if (!m_enabled || m_layers.empty())
+        return;
+
+    m_data.params.x = 1;
+
+    // Full rebakes are threaded but still expensive, only allow one per frame
+    bool fullBake = false;
+    u32 budget = m_texelBudget;
+
+    for (u32 i = 0; i < TerrainClipmapData::NumLevels; ++i)
+    {
+        auto& level = m_levels[i];
+
+        // The window moves in steps so strip updates are batched
+        const i32 step = (i32)UpdateStep;
+        const i32 originX = (i32)floor(cameraPos.x * level.density / step) * step - (i32)LevelSize / 2;
+        const i32 originZ = (i32)floor(cameraPos.z * level.density / step) * step - (i32)LevelSize / 2;
+
+        const i32 dx = originX - level.originX;
+        const i32 dz = originZ - level.originZ;
+
+        if (level.valid && (abs(dx) >= (i32)LevelSize || abs(dz) >= (i32)LevelSize))
+            level.valid = false;
+
+        if (!level.valid)
+        {
+            if (!fullBake)
+            {
+                fullBake = true;
+                level.originX = originX;
+                level.originZ = originZ;
+                BakeColumns(terrain, i, originX, originX + (i32)LevelSize, true);
+                level.valid = true;
+                level.dirty = false;
+            }
+        }
+        else if (dx != 0 || dz != 0)
+        {
+            const u32 cost = (u32)(abs(dx) + abs(dz)) * LevelSize;
+            if (cost <= budget)
+            {
+                budget -= cost;
+
+                if (dx != 0)
+                {
+                    const i32 fromX = dx > 0 ? level.originX + (i32)LevelSize : originX;
+                    const i32 toX = dx > 0 ? originX + (i32)LevelSize : level.originX;
+                    level.originX = originX;
+                    BakeColumns(terrain, i, fromX, toX, false);
+                }
+
+                if (dz != 0)
+                {
+                    const i32 fromZ = dz > 0 ? level.originZ + (i32)LevelSize : originZ;
+                    const i32 toZ = dz > 0 ? originZ + (i32)LevelSize : level.originZ;
+                    level.originZ = originZ;
+                    BakeRows(terrain, i, fromZ, toZ);
+                }
+            }
+        }
+
+        // Cells read since the last update, after the window moved so only what's resident is baked
+        if (level.valid && level.dirty)
+            BakeDirty(terrain, i);
+
+        m_data.levels[i] = Vec4{ (f32)level.originX, (f32)level.originZ, level.density, level.valid ? 1.f : 0.f };
+    }
+}
@@ -0,0 +1,52 @@
+#include <unit_bindings.hpp>
+#include <components.hpp>
+
+#include <wren.h>
+
+#include <cstring>
+#include <initializer_list>
+
+static EntityStore* s_store = nullptr;
+
+static void UnitsCount(WrenVM* vm)
+{
+    wrenSetSlotDouble(vm, 0, s_store != nullptr ? (double)s_store->Count<UnitTransform>() : 0.0);
+}
+
+static void UnitsPositions(WrenVM* vm)
+{
+    wrenEnsureSlots(vm, 2);
+    wrenSetSlotNewList(vm, 0);
+    if (s_store == nullptr)
+        return;
+
+    s_store->EachChunk<UnitTransform>([vm](u32 count, const Entity*, UnitTransform* transforms)
+    {
+        for (u32 i = 0; i < count; ++i)
+        {
+            const Vec3& p = transforms[i].position;
+            for (f32 value : { p.x, p.y, p.z })
+            {
+                wrenSetSlotDouble(vm, 1, value);
+                wrenInsertInList(vm, 0, -1, 1);
+            }
+        }
+    });
+}
+
+void UnitBindings::SetStore(EntityStore* store)
+{
+    s_store = store;
+}
+
+WrenForeignMethodFn UnitBindings::Bind(const char* module, const char* className, bool isStatic, const char* signature)
+{
+    if (!isStatic || std::strcmp(module, "units") != 0 || std::strcmp(className, "Units") != 0)
+        return nullptr;
+
+    if (std::strcmp(signature, "count") == 0)
+        return &UnitsCount;
+    if (std::strcmp(signature, "positions") == 0)
+        return &UnitsPositions;
+    return nullptr;
+}
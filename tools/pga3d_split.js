@@ -0,0 +1,256 @@
+// Lays out the single pga3d.hpp that GAmphetamine.js writes as the headers under include/pga3d/.
+//
+//   node tools/pga3d_split.js <generated pga3d.hpp> [include dir]
+//
+// The include dir defaults to include/ next to this script. Writes include/pga3d.hpp (the umbrella),
+// pga3d/types.hpp and one header per operator, add, sub, gp, reverse, sw and inverse also get an
+// _core.hpp with the overloads whose operands are all core types (see pga3d/core.hpp).
+//
+// Every edit the engine needs on top of the generator output is made here so regenerating never
+// loses it: the SIMD build configuration and alignment in types.hpp, PGA3D_TYPE_LIST, and
+// #if !PGA3D_SIMD_KERNELS around each generated overload that simd.hpp replaces. Those are the
+// "// <op> between <a> and <b>" lines in simd.hpp, the same header line as the generated overload.
+// The hand written headers (core, simd, soa, motor, expr, cull) aren't touched.
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+const Header = '// Written by GAmphetamine.js';
+const Regenerate = '// Laid out by tools/pga3d_split.js, regenerate instead of editing (see pga3d.hpp)';
+
+// Generation order, also the include order of the umbrella
+const Operators = [
+    { name: 'add', title: 'Addition', core: true },
+    { name: 'sub', title: 'Subtraction', core: true },
+    { name: 'gp', title: 'Geometric product', core: true },
+    { name: 'op', title: 'Outer product (meet)' },
+    { name: 'ip', title: 'Inner product' },
+    { name: 'lip', title: 'Left contraction' },
+    { name: 'rip', title: 'Right contraction' },
+    { name: 'reverse', title: 'Reverse', core: true },
+    { name: 'involute', title: 'Grade involution' },
+    { name: 'conjugate', title: 'Clifford conjugate' },
+    { name: 'dual', title: 'Dual' },
+    { name: 'undual', title: 'Undual' },
+    { name: 'prj', title: 'Projection' },
+    { name: 'rp', title: 'Regressive product (join)' },
+    { name: 'cp', title: 'Commutator product' },
+    { name: 'sw', title: 'Sandwich product', core: true },
+    { name: 'inverse', title: 'Inverse', core: true },
+];
+
+// Points, directions and motors
+const CoreTypes = new Set([
+    'scalar', 'vector', 'bivector', 'ebivector', 'ibivector', 'point', 'direction', 'rotation', 'translation', 'even',
+]);
+
+// Register sized types, 4 or 8 floats, aligned when the SIMD kernels are on
+const Alignment = { vector: 4, point: 4, rotation: 4, even: 8, odd: 8 };
+
+const SimdConfig = `// Optional SIMD backend, define PGA3D_SIMD before including to replace the hot 4 and 8 wide
+// products with the lane-wise kernels in simd.hpp. Falls back to scalar code when the
+// target has no SSE2. The replaced operators are not constexpr.
+#if defined(PGA3D_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PGA3D_SIMD_KERNELS 1
+#if defined(__AVX__)
+#define PGA3D_SIMD_AVX 1
+#define PGA3D_ALIGN8 alignas(32)
+#else
+#define PGA3D_SIMD_AVX 0
+#define PGA3D_ALIGN8 alignas(16)
+#endif
+#define PGA3D_ALIGN4 alignas(16)
+#else
+#define PGA3D_SIMD_KERNELS 0
+#define PGA3D_SIMD_AVX 0
+#define PGA3D_ALIGN4
+#define PGA3D_ALIGN8
+#endif
+`;
+
+function fail(message) {
+    console.error(`pga3d_split: ${message}`);
+    process.exit(1);
+}
+
+// Generated output up to the first operator, and the operators as { op, a, b, lines } in order.
+// b is undefined for unary operators ("// reverse of even")
+function parse(source) {
+    const lines = source.replace(/\r\n/g, '\n').split('\n');
+    const isRule = (line) => line.startsWith('////////');
+
+    const starts = [];
+    for (let i = 0; i + 1 < lines.length; ++i) {
+        if (isRule(lines[i]) && /^\/\/ \w+ (between|of) /.test(lines[i + 1]))
+            starts.push(i);
+    }
+    if (starts.length === 0)
+        fail('no operators found, is this GAmphetamine.js output?');
+
+    const trim = (block) => {
+        while (block.length && block[block.length - 1].trim() === '')
+            block.pop();
+        return block;
+    };
+
+    const blocks = starts.map((start, k) => {
+        const block = trim(lines.slice(start, k + 1 < starts.length ? starts[k + 1] : lines.length));
+        const m = block[1].match(/^\/\/ (\w+) (?:between (\w+) and (\w+)|of (\w+))\s*$/);
+        if (!m)
+            fail(`can't read operator header '${block[1].trim()}'`);
+        return { op: m[1], a: m[2] || m[4], b: m[3], lines: block };
+    });
+
+    return { preamble: trim(lines.slice(0, starts[0])), blocks };
+}
+
+// "op a b" for every overload simd.hpp replaces
+function readSimdOverrides(simdPath) {
+    const overrides = new Set();
+    for (const line of fs.readFileSync(simdPath, 'utf8').split(/\r?\n/)) {
+        const m = line.match(/^\/\/ (\w+) between (\w+) and (\w+)\s*$/);
+        if (m)
+            overrides.add(`${m[1]} ${m[2]} ${m[3]}`);
+    }
+    return overrides;
+}
+
+function typesHeader(preamble) {
+    const out = [];
+    let typeNames = [];
+    let inTypeComment = false;
+
+    for (const line of preamble) {
+        if (line === '/////') {
+            inTypeComment = !inTypeComment;
+        } else if (inTypeComment) {
+            const m = line.match(/^\/\/ (\w+)\s/);
+            if (m)
+                typeNames.push(m[1]);
+        }
+
+        if (line === '// Type definition section')
+            out.push(...SimdConfig.split('\n'));
+
+        const struct = line.match(/^struct (\w+)_t \{$/);
+        if (struct && Alignment[struct[1]]) {
+            out.push(`struct PGA3D_ALIGN${Alignment[struct[1]]} ${struct[1]}_t {`);
+            continue;
+        }
+
+        out.push(line);
+        if (line === Header)
+            out.push('// Types, basis blades and build configuration shared by every pga3d header', Regenerate);
+    }
+
+    if (typeNames.length === 0)
+        fail('no type list in the generated header');
+
+    // Six per line
+    const entries = typeNames.map((name) => `X(${name}_t)`);
+    const rows = [];
+    for (let i = 0; i < entries.length; i += 6)
+        rows.push('    ' + entries.slice(i, i + 6).join(' '));
+
+    out.push(
+        '',
+        '// Every type in generation order, X(type) per entry, for code that has to cover all of them',
+        '#define PGA3D_TYPE_LIST(X) \\',
+        rows.join(' \\\n'),
+        '',
+        '#if PGA3D_SIMD_KERNELS',
+        '#include "simd.hpp"',
+        '#endif');
+    return out.join('\n') + '\n';
+}
+
+function operatorHeader(title, includes, blocks, overrides, used) {
+    const out = [Header, `// ${title}`, Regenerate, '', '#pragma once', ''];
+    for (const include of includes)
+        out.push(`#include "${include}"`);
+
+    for (const block of blocks) {
+        const key = `${block.op} ${block.a} ${block.b}`;
+        let lines = block.lines;
+        if (overrides.has(key)) {
+            used.add(key);
+            const signature = lines.findIndex((line) => line.startsWith('CONSTEXPR '));
+            if (signature < 0)
+                fail(`no signature for ${key}`);
+            lines = [...lines.slice(0, signature), '#if !PGA3D_SIMD_KERNELS', ...lines.slice(signature), '#endif'];
+        }
+        out.push('', ...lines);
+    }
+    return out.join('\n') + '\n';
+}
+
+function umbrellaHeader() {
+    const out = [
+        Header,
+        '// Umbrella header, every type and operator. The generated code is split per operator under',
+        '// pga3d/, include pga3d/core.hpp (points, directions and motors) or single operator headers',
+        '// to keep parse times down.',
+        '//',
+        '// Regenerating: write pga3d.hpp with GAmphetamine.js, then lay it out here with',
+        '//   node tools/pga3d_split.js <generated pga3d.hpp>',
+        '// which also puts back the SIMD configuration and the guards around the overloads simd.hpp',
+        '// replaces. Edits to the generated headers belong in that script, by hand they are lost.',
+        '',
+        '#pragma once',
+        '',
+        '#include "pga3d/types.hpp"',
+    ];
+    for (const operator of Operators)
+        out.push(`#include "pga3d/${operator.name}.hpp"`);
+    return out.join('\n') + '\n';
+}
+
+function main() {
+    const [input, includeArg] = process.argv.slice(2);
+    if (!input)
+        fail('usage: node tools/pga3d_split.js <generated pga3d.hpp> [include dir]');
+
+    const includeDir = includeArg || path.join(__dirname, '..', 'include');
+    const outDir = path.join(includeDir, 'pga3d');
+    const source = fs.readFileSync(input, 'utf8');
+    if (!source.startsWith(Header))
+        fail(`${input} doesn't start with '${Header}'`);
+
+    const { preamble, blocks } = parse(source);
+    const overrides = readSimdOverrides(path.join(outDir, 'simd.hpp'));
+    const used = new Set();
+
+    const files = { 'types.hpp': typesHeader(preamble) };
+    for (const operator of Operators) {
+        const own = blocks.filter((block) => block.op === operator.name);
+        if (own.length === 0)
+            fail(`no ${operator.name} operators in the generated header`);
+
+        const isCore = (block) => CoreTypes.has(block.a) && (block.b === undefined || CoreTypes.has(block.b));
+        if (operator.core) {
+            files[`${operator.name}_core.hpp`] = operatorHeader(`${operator.title}, points, directions and motors only`,
+                ['types.hpp'], own.filter(isCore), overrides, used);
+            files[`${operator.name}.hpp`] = operatorHeader(operator.title,
+                ['types.hpp', `${operator.name}_core.hpp`], own.filter((block) => !isCore(block)), overrides, used);
+        } else {
+            files[`${operator.name}.hpp`] = operatorHeader(operator.title, ['types.hpp'], own, overrides, used);
+        }
+    }
+
+    // A kernel without a generated overload to replace would be a second definition
+    for (const key of overrides) {
+        if (!used.has(key))
+            fail(`simd.hpp replaces '${key}' but the generator didn't emit it`);
+    }
+
+    for (const [name, text] of Object.entries(files))
+        fs.writeFileSync(path.join(outDir, name), text);
+    fs.writeFileSync(path.join(includeDir, 'pga3d.hpp'), umbrellaHeader());
+
+    console.log(`pga3d_split: ${blocks.length} operators in ${Object.keys(files).length + 1} headers, ` +
+        `${used.size} replaced by simd.hpp`);
+}
+
+main();